@@ -47,6 +47,7 @@
 #include <librepcb/core/project/board/boardpickplacegenerator.h>
 #include <librepcb/core/project/board/boardplanefragmentsbuilder.h>
 #include <librepcb/core/project/board/drc/boarddesignrulecheck.h>
+#include <librepcb/core/project/board/items/bi_netsegment.h>
 #include <librepcb/core/project/bomgenerator.h>
 #include <librepcb/core/project/circuit/assemblyvariant.h>
 #include <librepcb/core/project/circuit/circuit.h>
@@ -56,11 +57,16 @@
 #include <librepcb/core/project/projectattributelookup.h>
 #include <librepcb/core/project/projectloader.h>
 #include <librepcb/core/project/schematic/schematicpainter.h>
+#include <librepcb/core/project/syntheticprojectgenerator.h>
+#include <librepcb/core/utils/memoryreport.h>
 #include <librepcb/core/utils/toolbox.h>
+#include <librepcb/core/utils/tracer.h>
 
+#include <QtConcurrent>
 #include <QtCore>
 
 #include <algorithm>
+#include <atomic>
 
 /*******************************************************************************
  *  Namespace
@@ -92,6 +98,9 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
        {tr("Open a STEP model to execute STEP-related tasks outside of a "
            "library."),
         "open-step [command_options]"}},  // no tr()!
+      {"generate-project",
+       {tr("Generate a large synthetic project for scaling tests."),
+        "generate-project [command_options]"}},  // no tr()!
   };
 
   // Add global options
@@ -106,6 +115,13 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
   parser.addOption(versionOption);
   QCommandLineOption verboseOption({"v", "verbose"}, tr("Verbose output."));
   parser.addOption(verboseOption);
+  QCommandLineOption traceFileOption(
+      "trace-file",
+      tr("Record the duration of internal operations and write them to this "
+         "file in the Chrome trace event format (viewable with "
+         "https://ui.perfetto.dev)."),
+      tr("file"));
+  parser.addOption(traceFileOption);
   parser.addPositionalArgument("command",
                                tr("The command to execute (see list below)."));
   positionalArgNames.append("command");
@@ -240,6 +256,10 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
       tr("Fail if the project files are not strictly canonical, i.e. "
          "there would be changes when saving the project. Note that "
          "this option is not available for *.lppz files."));
+  QCommandLineOption prjMemoryReportOption(
+      "memory-report",
+      tr("Print the approximate memory usage of the project after all other "
+         "actions, broken down by schematics, boards and library elements."));
 
   // Define options for "open-library"
   QCommandLineOption libAllOption(
@@ -262,6 +282,27 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
       "strict",
       tr("Fail if the opened files are not strictly canonical, i.e. "
          "there would be changes when saving the library elements."));
+  QCommandLineOption libJobsOption(
+      "jobs",
+      tr("Number of library elements to process in parallel (default: number "
+         "of CPU cores). The console output is the same for any value."),
+      tr("n"));
+  QCommandLineOption libShardOption(
+      "shard",
+      tr("Only process the i-th of n equally sized parts of the library "
+         "elements (e.g. '2/4'), to split '--all' across multiple machines."),
+      tr("i/n"));
+  QCommandLineOption libChangedSinceOption(
+      "changed-since",
+      tr("Only process library elements containing files which were modified "
+         "since the given Git revision (requires 'git' to be installed)."),
+      tr("revision"));
+  QCommandLineOption libChangedFilesOption(
+      "changed-files",
+      tr("Only process library elements containing any of the files listed "
+         "in the given text file (one path per line, relative to the library "
+         "directory)."),
+      tr("file"));
 
   // Define options for "open-step"
   QCommandLineOption stepMinifyOption(
@@ -281,11 +322,53 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
           .arg("--minify"),
       tr("file"));
 
+  // Define options for "generate-project"
+  // Note: Not using tr() for this command as it is basically intended for
+  // developers, not end users.
+  const SyntheticProjectGenerator::Settings genDefaults;
+  QCommandLineOption genSeedOption(
+      "seed", "Seed of the random generator (default: 0).", "n", "0");
+  QCommandLineOption genDevicesOption(
+      "devices", QString("Number of devices (default: %1).")
+                     .arg(genDefaults.deviceCount),
+      "n", QString::number(genDefaults.deviceCount));
+  QCommandLineOption genPadsOption(
+      "pads",
+      QString("Number of pads per synthetic device (default: %1).")
+          .arg(genDefaults.padsPerDevice),
+      "n", QString::number(genDefaults.padsPerDevice));
+  QCommandLineOption genNetsOption(
+      "nets", QString("Number of nets (default: %1).")
+                  .arg(genDefaults.netCount),
+      "n", QString::number(genDefaults.netCount));
+  QCommandLineOption genTracesOption(
+      "traces", QString("Maximum number of traces (default: %1).")
+                    .arg(genDefaults.traceCount),
+      "n", QString::number(genDefaults.traceCount));
+  QCommandLineOption genViasOption(
+      "vias", QString("Maximum number of vias (default: %1).")
+                  .arg(genDefaults.viaCount),
+      "n", QString::number(genDefaults.viaCount));
+  QCommandLineOption genPlanesOption(
+      "planes", QString("Number of planes (default: %1).")
+                    .arg(genDefaults.planeCount),
+      "n", QString::number(genDefaults.planeCount));
+  QCommandLineOption genLayersOption(
+      "layers", QString("Number of copper layers (default: %1).")
+                    .arg(genDefaults.copperLayerCount),
+      "n", QString::number(genDefaults.copperLayerCount));
+  QCommandLineOption genLibraryOption(
+      "library",
+      "Take devices from this library (*.lplib) instead of generating "
+      "synthetic ones. Can be given multiple times, e.g. for each library "
+      "of the workspace.",
+      "dir");
+
   // Build help text.
   const QString executable = args.value(0);
   QString helpText = parser.helpText() % "\n" % tr("Commands:") % "\n";
   for (auto it = commands.constBegin(); it != commands.constEnd(); ++it) {
-    helpText += "  " % it.key().leftJustified(15) % it.value().first % "\n";
+    helpText += "  " % it.key().leftJustified(18) % it.value().first % "\n";
   }
   helpText += "\n" % tr("List command-specific options:") % "\n  " %
       executable % " <command> --help";
@@ -330,6 +413,7 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
     parser.addOption(setDefaultAssemblyVariantOption);
     parser.addOption(saveOption);
     parser.addOption(prjStrictOption);
+    parser.addOption(prjMemoryReportOption);
   } else if (command == "open-library") {
     parser.addPositionalArgument(command, commands[command].first,
                                  commands[command].second);
@@ -341,6 +425,10 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
     parser.addOption(libMinifyStepOption);
     parser.addOption(libSaveOption);
     parser.addOption(libStrictOption);
+    parser.addOption(libJobsOption);
+    parser.addOption(libShardOption);
+    parser.addOption(libChangedSinceOption);
+    parser.addOption(libChangedFilesOption);
   } else if (command == "open-step") {
     parser.addPositionalArgument(command, commands[command].first,
                                  commands[command].second);
@@ -350,6 +438,21 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
     parser.addOption(stepMinifyOption);
     parser.addOption(stepTesselateOption);
     parser.addOption(stepSaveToOption);
+  } else if (command == "generate-project") {
+    parser.addPositionalArgument(command, commands[command].first,
+                                 commands[command].second);
+    parser.addPositionalArgument(
+        "project", "Path to the project file to create (*.lpp).");
+    positionalArgNames.append("project");
+    parser.addOption(genSeedOption);
+    parser.addOption(genDevicesOption);
+    parser.addOption(genPadsOption);
+    parser.addOption(genNetsOption);
+    parser.addOption(genTracesOption);
+    parser.addOption(genViasOption);
+    parser.addOption(genPlanesOption);
+    parser.addOption(genLayersOption);
+    parser.addOption(genLibraryOption);
   } else if (!command.isEmpty()) {
     printErr(tr("Unknown command '%1'.").arg(command));
     printErr(usageHelpText);
@@ -379,6 +482,12 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
     OccModel::setVerboseOutput(true);
   }
 
+  // --trace-file
+  if (parser.isSet(traceFileOption)) {
+    const QString path = parser.value(traceFileOption);
+    Tracer::start(FilePath(QFileInfo(path).absoluteFilePath()));
+  }
+
   // --help (also shown if no arguments supplied)
   if (parser.isSet(helpOption) || (args.count() <= 1)) {
     print(helpText);
@@ -448,7 +557,8 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
         parser.values(assemblyVariantIndexOption),  // assembly variant indices
         parser.value(setDefaultAssemblyVariantOption),  // set default AV
         parser.isSet(saveOption),  // save project
-        parser.isSet(prjStrictOption)  // strict mode
+        parser.isSet(prjStrictOption),  // strict mode
+        parser.isSet(prjMemoryReportOption)  // memory report
     );
   } else if (command == "open-library") {
     cmdSuccess = openLibrary(positionalArgs.value(1),  // library directory
@@ -456,7 +566,11 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
                              parser.isSet(libCheckOption),  // run check
                              parser.isSet(libMinifyStepOption),  // minify STEP
                              parser.isSet(libSaveOption),  // save
-                             parser.isSet(libStrictOption)  // strict mode
+                             parser.isSet(libStrictOption),  // strict mode
+                             parser.value(libJobsOption),  // parallel jobs
+                             parser.value(libShardOption),  // shard
+                             parser.value(libChangedSinceOption),  // Git rev.
+                             parser.value(libChangedFilesOption)  // file list
     );
   } else if (command == "open-step") {
     cmdSuccess = openStep(positionalArgs.value(1),  // STEP file path
@@ -464,6 +578,47 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
                           parser.isSet(stepTesselateOption),  // tesselate
                           parser.value(stepSaveToOption)  // save to
     );
+  } else if (command == "generate-project") {
+    // Note: Not using tr() for this command as it is basically intended for
+    // developers, not end users.
+    bool settingsValid = true;
+    auto parseCount = [&](const QCommandLineOption& option, int min) {
+      const QString value = parser.value(option);
+      bool ok = false;
+      const int count = value.toInt(&ok);
+      if ((!ok) || (count < min)) {
+        printErr(QString("ERROR: Invalid value '%1' for '--%2', expected an "
+                         "integer >= %3.")
+                     .arg(value, option.names().first())
+                     .arg(min));
+        settingsValid = false;
+      }
+      return count;
+    };
+    SyntheticProjectGenerator::Settings settings;
+    bool seedOk = false;
+    settings.seed = parser.value(genSeedOption).toUInt(&seedOk);
+    if (!seedOk) {
+      printErr(QString("ERROR: Invalid value '%1' for '--seed', expected an "
+                       "unsigned integer.")
+                   .arg(parser.value(genSeedOption)));
+      settingsValid = false;
+    }
+    settings.deviceCount = parseCount(genDevicesOption, 1);
+    settings.padsPerDevice = parseCount(genPadsOption, 2);
+    settings.netCount = parseCount(genNetsOption, 1);
+    settings.traceCount = parseCount(genTracesOption, 0);
+    settings.viaCount = parseCount(genViasOption, 0);
+    settings.planeCount = parseCount(genPlanesOption, 0);
+    settings.copperLayerCount = parseCount(genLayersOption, 2);
+    foreach (const QString& dir, parser.values(genLibraryOption)) {
+      settings.libraries.append(FilePath(QFileInfo(dir).absoluteFilePath()));
+    }
+    if (settingsValid) {
+      cmdSuccess = generateProject(positionalArgs.value(1),  // project path
+                                   settings  // generator settings
+      );
+    }
   } else {
     printErr("Internal failure.");  // No tr() because this cannot occur.
   }
@@ -492,7 +647,8 @@ bool CommandLineInterface::openProject(
     const QStringList& exportNetlistFiles, const QStringList& boardNames,
     const QStringList& boardIndices, bool removeOtherBoards,
     const QStringList& avNames, const QStringList& avIndices,
-    const QString& setDefaultAv, bool save, bool strict) const noexcept {
+    const QString& setDefaultAv, bool save, bool strict,
+    bool memoryReport) const noexcept {
   try {
     bool success = true;
     QMap<FilePath, int> writtenFilesCounter;
@@ -512,11 +668,16 @@ bool CommandLineInterface::openProject(
           projectFileName = fn;
         }
       }
+    } else if (save) {
+      projectFs = TransactionalFileSystem::openRW(projectFp.getParentDir());
+      projectFileName = projectFp.getFilename();
     } else {
-      projectFs = TransactionalFileSystem::open(projectFp.getParentDir(), save);
+      // Files are never written back, thus map them instead of reading them.
+      projectFs = TransactionalFileSystem::openMapped(projectFp.getParentDir());
       projectFileName = projectFp.getFilename();
     }
     ProjectLoader loader;
+    loader.setLazyLibraryLoading(!strict);  // Strict mode checks all files.
     std::unique_ptr<Project> project =
         loader.open(std::unique_ptr<TransactionalDirectory>(
                         new TransactionalDirectory(projectFs)),
@@ -1023,6 +1184,18 @@ bool CommandLineInterface::openProject(
       }
     }
 
+    // Print memory report
+    if (memoryReport) {
+      print(tr("Memory report (approximate):"));
+      MemoryReport report;
+      project->reportMemoryUsage(report);
+      foreach (const QString& line, report.toLines("  ")) {
+        print(line);
+      }
+      const qint64 total = report.getTotalBytes();
+      print("  " % tr("Total: %1").arg(MemoryReport::formatBytes(total)));
+    }
+
     // Fail if some files were written multiple times
     bool filesOverwritten = false;
     for (auto it = writtenFilesCounter.begin(); it != writtenFilesCounter.end();
@@ -1052,12 +1225,50 @@ bool CommandLineInterface::openProject(
   }
 }
 
-bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
-                                       bool runCheck, bool minifyStepFiles,
-                                       bool save, bool strict) const noexcept {
+bool CommandLineInterface::openLibrary(
+    const QString& libDir, bool all, bool runCheck, bool minifyStepFiles,
+    bool save, bool strict, const QString& jobs, const QString& shard,
+    const QString& changedSince, const QString& changedFilesList)
+    const noexcept {
   try {
     bool success = true;
 
+    // Parse number of parallel jobs, if given.
+    if (!jobs.isEmpty()) {
+      bool ok = false;
+      const int jobCount = jobs.toInt(&ok);
+      if ((!ok) || (jobCount < 1)) {
+        throw RuntimeError(__FILE__, __LINE__,
+                           tr("Invalid number of jobs '%1', expected a "
+                              "positive integer.")
+                               .arg(jobs));
+      }
+      QThreadPool::globalInstance()->setMaxThreadCount(jobCount);
+    }
+
+    // Parse shard, if given.
+    int shardIndex = 0;
+    int shardCount = 1;
+    if (!shard.isEmpty()) {
+      const QStringList parts = shard.split('/');
+      bool indexOk = false, countOk = false;
+      shardIndex = parts.value(0).toInt(&indexOk) - 1;
+      shardCount = parts.value(1).toInt(&countOk);
+      if ((parts.count() != 2) || (!indexOk) || (!countOk) ||
+          (shardCount < 1) || (shardIndex < 0) || (shardIndex >= shardCount)) {
+        throw RuntimeError(__FILE__, __LINE__,
+                           tr("Invalid shard '%1', expected 'i/n' with "
+                              "1 <= i <= n.")
+                               .arg(shard));
+      }
+    }
+
+    // Refuse saving early to not print the same error for every element.
+    if (save && failIfFileFormatUnstable()) {
+      success = false;
+      save = false;
+    }
+
     // Open library
     FilePath libFp(QFileInfo(libDir).absoluteFilePath());
     print(tr("Open library '%1'...").arg(prettyPath(libFp, libDir)));
@@ -1067,143 +1278,187 @@ bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
     std::unique_ptr<Library> lib =
         Library::open(std::unique_ptr<TransactionalDirectory>(
             new TransactionalDirectory(libFs)));  // can throw
-    processLibraryElement(libDir, *libFs, *lib, runCheck, minifyStepFiles, save,
-                          strict,
-                          success);  // can throw
 
-    // Open all component categories
-    if (all) {
-      QStringList elements = lib->searchForElements<ComponentCategory>();
-      elements.sort();  // For deterministic console output.
-      print(tr("Process %1 component categories...").arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo().noquote() << tr("Open '%1'...").arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        std::unique_ptr<ComponentCategory> element =
-            ComponentCategory::open(std::unique_ptr<TransactionalDirectory>(
-                new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, *element, runCheck, minifyStepFiles,
-                              save, strict,
-                              success);  // can throw
-      }
+    // Search all elements (sorted for deterministic console output).
+    const bool filterChanged =
+        (!changedSince.isEmpty()) || (!changedFilesList.isEmpty());
+    auto search = [](QStringList elements) {
+      elements.sort();
+      return elements;
+    };
+    QList<QStringList> elements;
+    if (all || filterChanged) {
+      elements.append(search(lib->searchForElements<ComponentCategory>()));
+      elements.append(search(lib->searchForElements<PackageCategory>()));
+      elements.append(search(lib->searchForElements<Symbol>()));
+      elements.append(search(lib->searchForElements<Package>()));
+      elements.append(search(lib->searchForElements<Component>()));
+      elements.append(search(lib->searchForElements<Device>()));
     }
 
-    // Open all package categories
-    if (all) {
-      QStringList elements = lib->searchForElements<PackageCategory>();
-      elements.sort();  // For deterministic console output.
-      print(tr("Process %1 package categories...").arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo().noquote() << tr("Open '%1'...").arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        std::unique_ptr<PackageCategory> element =
-            PackageCategory::open(std::unique_ptr<TransactionalDirectory>(
-                new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, *element, runCheck, minifyStepFiles,
-                              save, strict,
-                              success);  // can throw
+    // Limit to changed elements, if requested. Changed files not belonging
+    // to any element are considered as modifications of the library itself.
+    bool processLib = (shardIndex == 0);
+    if (filterChanged) {
+      QSet<QString> allDirs;
+      foreach (const QStringList& dirs, elements) {
+        allDirs |= Toolbox::toSet(dirs);
+      }
+      QSet<QString> changedDirs;
+      bool libChanged = false;
+      foreach (const QString& file, getChangedLibraryFiles(
+                   libFp, changedSince, changedFilesList)) {  // can throw
+        const QString dir = file.section('/', 0, 1);
+        if (allDirs.contains(dir)) {
+          changedDirs.insert(dir);
+        } else {
+          libChanged = true;
+        }
       }
+      processLib = processLib && libChanged;
+      for (QStringList& dirs : elements) {
+        dirs = Toolbox::toList(Toolbox::toSet(dirs) & changedDirs);
+        dirs.sort();
+      }
+    }
+    if (!all) {
+      elements.clear();
     }
 
-    // Open all symbols
-    if (all) {
-      QStringList elements = lib->searchForElements<Symbol>();
-      elements.sort();  // For deterministic console output.
-      print(tr("Process %1 symbols...").arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo().noquote() << tr("Open '%1'...").arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        std::unique_ptr<Symbol> element =
-            Symbol::open(std::unique_ptr<TransactionalDirectory>(
-                new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, *element, runCheck, minifyStepFiles,
-                              save, strict,
-                              success);  // can throw
+    // Limit to the requested shard, if any. Elements are distributed
+    // round-robin over all element types to get equally sized shards.
+    int elementIndex = 0;
+    for (QStringList& dirs : elements) {
+      QStringList shardDirs;
+      foreach (const QString& dir, dirs) {
+        if ((elementIndex++ % shardCount) == shardIndex) {
+          shardDirs.append(dir);
+        }
       }
+      dirs = shardDirs;
     }
 
-    // Open all packages
-    if (all) {
-      QStringList elements = lib->searchForElements<Package>();
-      elements.sort();  // For deterministic console output.
-      print(tr("Process %1 packages...").arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo().noquote() << tr("Open '%1'...").arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        std::unique_ptr<Package> element =
-            Package::open(std::unique_ptr<TransactionalDirectory>(
-                new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, *element, runCheck, minifyStepFiles,
-                              save, strict,
-                              success);  // can throw
+    // Process library
+    if (processLib) {
+      LibraryElementOutput output;
+      processLibraryElement(libDir, *libFs, *lib, runCheck, minifyStepFiles,
+                            save, strict, output);  // can throw
+      foreach (const QString& line, output.stdOut) {
+        print(line);
       }
+      foreach (const QString& line, output.stdErr) {
+        printErr(line);
+      }
+      success = success && output.success;
     }
 
-    // Open all components
+    // Process all elements
     if (all) {
-      QStringList elements = lib->searchForElements<Component>();
-      elements.sort();  // For deterministic console output.
-      print(tr("Process %1 components...").arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo().noquote() << tr("Open '%1'...").arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        std::unique_ptr<Component> element =
-            Component::open(std::unique_ptr<TransactionalDirectory>(
-                new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, *element, runCheck, minifyStepFiles,
-                              save, strict,
-                              success);  // can throw
-      }
+      print(tr("Process %1 component categories...")
+                .arg(elements.value(0).count()));
+      processLibraryElements<ComponentCategory>(
+          libDir, libFp, elements.value(0), runCheck, minifyStepFiles, save,
+          strict, success);  // can throw
+      print(tr("Process %1 package categories...")
+                .arg(elements.value(1).count()));
+      processLibraryElements<PackageCategory>(
+          libDir, libFp, elements.value(1), runCheck, minifyStepFiles, save,
+          strict, success);  // can throw
+      print(tr("Process %1 symbols...").arg(elements.value(2).count()));
+      processLibraryElements<Symbol>(libDir, libFp, elements.value(2),
+                                     runCheck, minifyStepFiles, save, strict,
+                                     success);  // can throw
+      print(tr("Process %1 packages...").arg(elements.value(3).count()));
+      processLibraryElements<Package>(libDir, libFp, elements.value(3),
+                                      runCheck, minifyStepFiles, save, strict,
+                                      success);  // can throw
+      print(tr("Process %1 components...").arg(elements.value(4).count()));
+      processLibraryElements<Component>(libDir, libFp, elements.value(4),
+                                        runCheck, minifyStepFiles, save,
+                                        strict, success);  // can throw
+      print(tr("Process %1 devices...").arg(elements.value(5).count()));
+      processLibraryElements<Device>(libDir, libFp, elements.value(5),
+                                     runCheck, minifyStepFiles, save, strict,
+                                     success);  // can throw
     }
 
-    // Open all devices
-    if (all) {
-      QStringList elements = lib->searchForElements<Device>();
-      elements.sort();  // For deterministic console output.
-      print(tr("Process %1 devices...").arg(elements.count()));
-      foreach (const QString& dir, elements) {
+    return success;
+  } catch (const Exception& e) {
+    printErr(tr("ERROR: %1").arg(e.getMsg()));
+    return false;
+  }
+}
+
+template <typename ElementType>
+void CommandLineInterface::processLibraryElements(
+    const QString& libDir, const FilePath& libFp, const QStringList& dirs,
+    bool runCheck, bool minifyStepFiles, bool save, bool strict,
+    bool& success) const {
+  // Process all elements in the thread pool, but print their output in the
+  // order of the passed directories to keep the console output deterministic.
+  std::atomic<bool> abort(false);
+  QList<QFuture<LibraryElementOutput>> futures;
+  foreach (const QString& dir, dirs) {
+    futures.append(QtConcurrent::run([&, dir]() {
+      LibraryElementOutput output;
+      if (abort) {
+        return output;
+      }
+      try {
         FilePath fp = libFp.getPathTo(dir);
         qInfo().noquote() << tr("Open '%1'...").arg(prettyPath(fp, libDir));
         std::shared_ptr<TransactionalFileSystem> fs =
             TransactionalFileSystem::open(fp, save);  // can throw
-        std::unique_ptr<Device> element =
-            Device::open(std::unique_ptr<TransactionalDirectory>(
+        std::unique_ptr<ElementType> element =
+            ElementType::open(std::unique_ptr<TransactionalDirectory>(
                 new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, *element, runCheck, minifyStepFiles,
-                              save, strict,
-                              success);  // can throw
+        processLibraryElement(libDir, *fs, *element, runCheck,
+                              minifyStepFiles, save, strict,
+                              output);  // can throw
+      } catch (const Exception& e) {
+        output.error = e.getMsg();
       }
-    }
+      return output;
+    }));
+  }
 
-    return success;
-  } catch (const Exception& e) {
-    printErr(tr("ERROR: %1").arg(e.getMsg()));
-    return false;
+  // Note: All futures must be finished before leaving this scope since they
+  // are referencing local variables.
+  QString error;
+  for (QFuture<LibraryElementOutput>& future : futures) {
+    const LibraryElementOutput output = future.result();
+    if (!error.isEmpty()) {
+      continue;
+    }
+    foreach (const QString& line, output.stdOut) {
+      print(line);
+    }
+    foreach (const QString& line, output.stdErr) {
+      printErr(line);
+    }
+    success = success && output.success;
+    if (!output.error.isEmpty()) {
+      error = output.error;
+      abort = true;
+    }
+  }
+  if (!error.isEmpty()) {
+    throw RuntimeError(__FILE__, __LINE__, error);
   }
 }
 
 void CommandLineInterface::processLibraryElement(
     const QString& libDir, TransactionalFileSystem& fs,
     LibraryBaseElement& element, bool runCheck, bool minifyStepFiles, bool save,
-    bool strict, bool& success) const {
+    bool strict, LibraryElementOutput& output) const {
   // Helper function to print an error header to console only once, if
   // there is at least one error.
   bool errorHeaderPrinted = false;
-  auto printErrorHeaderOnce = [&errorHeaderPrinted, &element]() {
+  auto printErrorHeaderOnce = [&errorHeaderPrinted, &element, &output]() {
     if (!errorHeaderPrinted) {
-      printErr(QString("  - %1 (%2):")
-                   .arg(*element.getNames().getDefaultValue(),
-                        element.getUuid().toStr()));
+      output.stdErr.append(QString("  - %1 (%2):")
+                               .arg(*element.getNames().getDefaultValue(),
+                                    element.getUuid().toStr()));
       errorHeaderPrinted = true;
     }
   };
@@ -1224,18 +1479,19 @@ void CommandLineInterface::processLibraryElement(
           const QByteArray minified =
               OccModel::minifyStep(content);  // can throw
           if (minified != content) {
-            print(tr("  - Minified '%1' from %2 to %3 bytes")
-                      .arg(fp)
-                      .arg(content.size())
-                      .arg(minified.size()));
+            output.stdOut.append(tr("  - Minified '%1' from %2 to %3 bytes")
+                                     .arg(fp)
+                                     .arg(content.size())
+                                     .arg(minified.size()));
             OccModel::loadStep(minified);  // throws if STEP is invalid
             fs.write(file, minified);
           }
         } catch (const Exception& e) {
           printErrorHeaderOnce();
-          printErr(QString("    - Failed to minify STEP model '%1': %2")
-                       .arg(fp, e.getMsg()));
-          success = false;
+          output.stdErr.append(
+              QString("    - Failed to minify STEP model '%1': %2")
+                  .arg(fp, e.getMsg()));
+          output.success = false;
         }
       }
     }
@@ -1252,10 +1508,10 @@ void CommandLineInterface::processLibraryElement(
       std::sort(paths.begin(), paths.end());
       printErrorHeaderOnce();
       foreach (const QString& path, paths) {
-        printErr(QString("    - Non-canonical file: '%1'")
-                     .arg(prettyPath(fs.getAbsPath(path), libDir)));
+        output.stdErr.append(QString("    - Non-canonical file: '%1'")
+                                 .arg(prettyPath(fs.getAbsPath(path), libDir)));
       }
-      success = false;
+      output.success = false;
     }
   }
 
@@ -1273,8 +1529,8 @@ void CommandLineInterface::processLibraryElement(
             tr("Non-approved messages: %1").arg(nonApproved.count());
     foreach (const QString& msg, nonApproved) {
       printErrorHeaderOnce();
-      printErr("    - " % msg);
-      success = false;
+      output.stdErr.append("    - " % msg);
+      output.success = false;
     }
   }
 
@@ -1282,11 +1538,7 @@ void CommandLineInterface::processLibraryElement(
   if (save) {
     qInfo().noquote()
         << tr("Save '%1'...").arg(prettyPath(fs.getPath(), libDir));
-    if (failIfFileFormatUnstable()) {
-      success = false;
-    } else {
-      fs.save();  // can throw
-    }
+    fs.save();  // can throw
   }
 
   // Do not propagate changes in the transactional file system to the
@@ -1294,6 +1546,66 @@ void CommandLineInterface::processLibraryElement(
   fs.discardChanges();
 }
 
+QStringList CommandLineInterface::getChangedLibraryFiles(
+    const FilePath& libFp, const QString& changedSince,
+    const QString& changedFilesList) {
+  QStringList files;
+
+  // Files modified since the given Git revision, including untracked files.
+  if (!changedSince.isEmpty()) {
+    const QList<QStringList> commands = {
+        {"diff", "--name-only", "--relative", "-z", changedSince, "--"},
+        {"ls-files", "--others", "--exclude-standard", "-z"},
+    };
+    foreach (const QStringList& args, commands) {
+      QProcess process;
+      process.setWorkingDirectory(libFp.toStr());
+      process.start("git", args);
+      if ((!process.waitForFinished(-1)) ||
+          (process.exitStatus() != QProcess::NormalExit) ||
+          (process.exitCode() != 0)) {
+        QString msg = QString::fromLocal8Bit(process.readAllStandardError());
+        if (msg.trimmed().isEmpty()) {
+          msg = process.errorString();
+        }
+        throw RuntimeError(
+            __FILE__, __LINE__,
+            tr("Failed to determine files changed since '%1': %2")
+                .arg(changedSince, msg.trimmed()));
+      }
+      foreach (const QByteArray& path,
+               process.readAllStandardOutput().split('\0')) {
+        if (!path.isEmpty()) {
+          files.append(QString::fromUtf8(path));
+        }
+      }
+    }
+  }
+
+  // Files listed in a text file, either absolute or relative to the library.
+  if (!changedFilesList.isEmpty()) {
+    const FilePath fp(QFileInfo(changedFilesList).absoluteFilePath());
+    const QString content =
+        QString::fromUtf8(FileUtils::readFile(fp));  // can throw
+    foreach (QString path, content.split('\n')) {
+      path = path.trimmed();
+      if (QDir::isAbsolutePath(path)) {
+        const FilePath absPath(path);
+        path = absPath.isLocatedInDir(libFp) ? absPath.toRelative(libFp)
+                                             : QString();
+      }
+      if (!path.isEmpty()) {
+        files.append(path);
+      }
+    }
+  }
+
+  for (QString& file : files) {
+    file = TransactionalFileSystem::cleanPath(file);
+  }
+  return files;
+}
+
 bool CommandLineInterface::openStep(const QString& filePath, bool minify,
                                     bool tesselate,
                                     const QString& saveTo) const noexcept {
@@ -1370,8 +1682,57 @@ bool CommandLineInterface::openStep(const QString& filePath, bool minify,
   }
 }
 
+bool CommandLineInterface::generateProject(
+    const QString& projectFile,
+    const SyntheticProjectGenerator::Settings& settings) const noexcept {
+  try {
+    // Note: Not using tr() for this command as it is basically intended for
+    // developers, not end users.
+
+    const FilePath projectFp(QFileInfo(projectFile).absoluteFilePath());
+    if (projectFp.getSuffix() != "lpp") {
+      printErr("ERROR: The project file must have the suffix '.lpp'.");
+      return false;
+    }
+    print(QString("Generate project '%1'...")
+              .arg(prettyPath(projectFp, projectFile)));
+    std::shared_ptr<TransactionalFileSystem> fs =
+        TransactionalFileSystem::openRW(projectFp.getParentDir());  // can throw
+    SyntheticProjectGenerator generator(settings);
+    std::unique_ptr<Project> project = generator.generate(
+        std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(fs)),
+        projectFp.getFilename());  // can throw
+
+    // Print statistics.
+    const Board& board = *project->getBoards().first();
+    int traces = 0;
+    int vias = 0;
+    foreach (const BI_NetSegment* segment, board.getNetSegments()) {
+      traces += segment->getNetLines().count();
+      vias += segment->getVias().count();
+    }
+    print(QString(" - %1 devices, %2 nets, %3 traces, %4 vias, %5 planes on "
+                  "%6 copper layers")
+              .arg(board.getDeviceInstances().count())
+              .arg(project->getCircuit().getNetSignals().count())
+              .arg(traces)
+              .arg(vias)
+              .arg(board.getPlanes().count())
+              .arg(board.getCopperLayers().count()));
+
+    // Save project.
+    print("Save project...");
+    project->save();  // can throw
+    fs->save();  // can throw
+    return true;
+  } catch (const Exception& e) {
+    printErr(tr("ERROR: %1").arg(e.getMsg()));
+    return false;
+  }
+}
+
 QStringList CommandLineInterface::prepareRuleCheckMessages(
-    RuleCheckMessageList messages, const QSet<SExpression>& approvals,
+    RuleCheckMessageList messages, const QSet<RuleCheckApproval>& approvals,
     int& approvedMsgCount) noexcept {
   // Sort messages to increases readability of console output.
   Toolbox::sortNumeric(
@@ -23,6 +23,7 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
+#include <librepcb/core/project/syntheticprojectgenerator.h>
 #include <librepcb/core/rulecheck/rulecheckmessage.h>
 
 #include <QtCore>
@@ -57,6 +58,20 @@ public:
   // General Methods
   int execute(const QStringList& args) noexcept;
 
+private:  // Types
+  /**
+   * @brief Console output and result of processing a single library element
+   *
+   * Library elements are processed in parallel, thus their output is
+   * collected first and printed afterwards in a deterministic order.
+   */
+  struct LibraryElementOutput {
+    QStringList stdOut;  ///< Lines to be printed to stdout
+    QStringList stdErr;  ///< Lines to be printed to stderr
+    QString error;  ///< Message of a fatal error (aborts processing)
+    bool success = true;  ///< Whether the element passed all checks
+  };
+
 private:  // Methods
   bool openProject(
       const QString& projectFile, bool runErc, bool runDrc,
@@ -71,17 +86,32 @@ private:  // Methods
       const QStringList& exportNetlistFiles, const QStringList& boardNames,
       const QStringList& boardIndices, bool removeOtherBoards,
       const QStringList& avNames, const QStringList& avIndices,
-      const QString& setDefaultAv, bool save, bool strict) const noexcept;
+      const QString& setDefaultAv, bool save, bool strict,
+      bool memoryReport) const noexcept;
   bool openLibrary(const QString& libDir, bool all, bool runCheck,
-                   bool minifyStepFiles, bool save, bool strict) const noexcept;
+                   bool minifyStepFiles, bool save, bool strict,
+                   const QString& jobs, const QString& shard,
+                   const QString& changedSince,
+                   const QString& changedFilesList) const noexcept;
+  template <typename ElementType>
+  void processLibraryElements(const QString& libDir, const FilePath& libFp,
+                              const QStringList& dirs, bool runCheck,
+                              bool minifyStepFiles, bool save, bool strict,
+                              bool& success) const;
   void processLibraryElement(const QString& libDir, TransactionalFileSystem& fs,
                              LibraryBaseElement& element, bool runCheck,
                              bool minifyStepFiles, bool save, bool strict,
-                             bool& success) const;
+                             LibraryElementOutput& output) const;
+  static QStringList getChangedLibraryFiles(const FilePath& libFp,
+                                            const QString& changedSince,
+                                            const QString& changedFilesList);
   bool openStep(const QString& filePath, bool minify, bool tesselate,
                 const QString& saveTo) const noexcept;
+  bool generateProject(
+      const QString& projectFile,
+      const SyntheticProjectGenerator::Settings& settings) const noexcept;
   static QStringList prepareRuleCheckMessages(
-      RuleCheckMessageList messages, const QSet<SExpression>& approvals,
+      RuleCheckMessageList messages, const QSet<RuleCheckApproval>& approvals,
       int& approvedMsgCount) noexcept;
   static QString prettyPath(const FilePath& path,
                             const QString& style) noexcept;
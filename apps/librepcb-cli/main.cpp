@@ -24,6 +24,7 @@
 
 #include <librepcb/core/application.h>
 #include <librepcb/core/debug.h>
+#include <librepcb/core/utils/tracer.h>
 
 #include <QtCore>
 #include <QtGui>
@@ -64,7 +65,15 @@ int main(int argc, char* argv[]) {
   Application::loadBundledFonts();
   Application::setTranslationLocale(QLocale::system());
 
+  // Enable tracing if requested by the LIBREPCB_TRACE_FILE environment
+  // variable. It may also be enabled later with the "--trace-file" option.
+  Tracer::startFromEnvironment();
+
   // Run application
   cli::CommandLineInterface cli;
-  return cli.execute(app.arguments());
+  const int retval = cli.execute(app.arguments());
+
+  // Write trace file, if enabled
+  Tracer::stop();
+  return retval;
 }
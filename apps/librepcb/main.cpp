@@ -24,6 +24,7 @@
 #include <librepcb/core/debug.h>
 #include <librepcb/core/exceptions.h>
 #include <librepcb/core/network/networkaccessmanager.h>
+#include <librepcb/core/utils/tracer.h>
 #include <librepcb/core/workspace/workspace.h>
 #include <librepcb/core/workspace/workspacesettings.h>
 #include <librepcb/editor/dialogs/directorylockhandlerdialog.h>
@@ -74,6 +75,10 @@ int main(int argc, char* argv[]) {
   // (organization + name).
   Debug::instance();
 
+  // Enable tracing if requested by the LIBREPCB_TRACE_FILE environment
+  // variable. The trace file is written when the application exits.
+  Tracer::startFromEnvironment();
+
   // Configure the application settings format and location used by QSettings
   configureApplicationSettings();
 
@@ -117,6 +122,9 @@ int main(int argc, char* argv[]) {
   // Stop network access manager thread
   networkAccessManager.reset();
 
+  // Write trace file, if enabled
+  Tracer::stop();
+
   qDebug().nospace() << "Exit application with code " << retval << ".";
   return retval;
 }
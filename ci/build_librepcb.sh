@@ -28,6 +28,7 @@ mkdir -p build && pushd build
 cmake .. \
   -DCMAKE_INSTALL_PREFIX=$(pwd)/install/opt \
   -DBUILD_DISALLOW_WARNINGS=1 \
+  -DBUILD_BENCHMARKS=1 \
   -DLIBREPCB_ENABLE_DESKTOP_INTEGRATION=1 \
   -DLIBREPCB_BUILD_AUTHOR="$LIBREPCB_BUILD_AUTHOR" \
   ${CMAKE_OPTIONS-}
@@ -0,0 +1,234 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "meshcache.h"
+
+#include "../exceptions.h"
+#include "../fileio/fileutils.h"
+#include "occmodel.h"
+
+#include <QtCore>
+
+#include <cstring>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+static const char sMagic[6] = {'L', 'P', 'M', 'E', 'S', 'H'};
+static const quint16 sFormatVersion = 1;
+static const quint32 sByteOrderMark = 0x01020304;
+
+static_assert(sizeof(QVector3D) == 3 * sizeof(float),
+              "Unexpected memory layout of QVector3D.");
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+MeshCache::MeshCache(const FilePath& dir, qint64 maxSize) noexcept
+  : mDir(dir), mMaxSize(maxSize) {
+}
+
+MeshCache::~MeshCache() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+tl::optional<MeshCache::Mesh> MeshCache::load(
+    const QByteArray& key) const noexcept {
+  const FilePath fp = getFilePath(key);
+  if (!fp.isExistingFile()) {
+    return tl::nullopt;
+  }
+  QFile file(fp.toStr());
+  if (!file.open(QIODevice::ReadOnly)) {
+    qWarning() << "Failed to open cached 3D model:" << file.errorString();
+    return tl::nullopt;
+  }
+  const qint64 size = file.size();
+  if (uchar* data = file.map(0, size)) {
+    tl::optional<Mesh> mesh =
+        deserialize(reinterpret_cast<const char*>(data), size);
+    file.unmap(data);
+    if (!mesh) {
+      qWarning() << "Ignoring invalid cached 3D model:" << fp.toNative();
+    } else {
+      markAsUsed(fp);
+    }
+    return mesh;
+  } else {
+    // Memory mapping is not supported on all platforms/file systems.
+    const QByteArray content = file.readAll();
+    tl::optional<Mesh> mesh = deserialize(content.constData(), content.size());
+    if (mesh) {
+      markAsUsed(fp);
+    }
+    return mesh;
+  }
+}
+
+void MeshCache::store(const QByteArray& key, const Mesh& mesh) const noexcept {
+  try {
+    // Note: FileUtils::writeFile() writes to a temporary file first, so other
+    // threads or processes never see incomplete files.
+    FileUtils::writeFile(getFilePath(key), serialize(mesh));  // can throw
+  } catch (const Exception& e) {
+    qWarning() << "Failed to write 3D model to cache:" << e.getMsg();
+  }
+  removeLeastRecentlyUsed();
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+QByteArray MeshCache::calcKey(const QByteArray& stepContent) noexcept {
+  // Include the tesselation parameters to not load meshes which were created
+  // with a different OpenCascade version or tesselation algorithm.
+  static const QByteArray tesselationId = OccModel::getTesselationId().toUtf8();
+  QCryptographicHash hash(QCryptographicHash::Sha256);
+  hash.addData(tesselationId);
+  hash.addData(stepContent);
+  return hash.result().toHex();
+}
+
+QByteArray MeshCache::serialize(const Mesh& mesh) noexcept {
+  QByteArray data;
+  auto append = [&data](const void* src, int size) {
+    data.append(static_cast<const char*>(src), size);
+  };
+  qint64 size = sizeof(sMagic) + sizeof(sFormatVersion) +
+      sizeof(sByteOrderMark) + sizeof(quint32);
+  for (auto it = mesh.begin(); it != mesh.end(); it++) {
+    size += 3 * sizeof(double) + sizeof(quint32) +
+        it.value().count() * sizeof(QVector3D);
+  }
+  data.reserve(size);
+  append(sMagic, sizeof(sMagic));
+  append(&sFormatVersion, sizeof(sFormatVersion));
+  append(&sByteOrderMark, sizeof(sByteOrderMark));
+  const quint32 colorCount = mesh.count();
+  append(&colorCount, sizeof(colorCount));
+  for (auto it = mesh.begin(); it != mesh.end(); it++) {
+    const double color[3] = {std::get<0>(it.key()), std::get<1>(it.key()),
+                             std::get<2>(it.key())};
+    append(color, sizeof(color));
+    const quint32 vertexCount = it.value().count();
+    append(&vertexCount, sizeof(vertexCount));
+    append(it.value().constData(), vertexCount * sizeof(QVector3D));
+  }
+  return data;
+}
+
+tl::optional<MeshCache::Mesh> MeshCache::deserialize(const char* data,
+                                                     qint64 size) noexcept {
+  qint64 pos = 0;
+  auto read = [data, size, &pos](void* dst, qint64 n) {
+    if ((n < 0) || ((pos + n) > size)) {
+      return false;
+    }
+    std::memcpy(dst, data + pos, n);
+    pos += n;
+    return true;
+  };
+
+  char magic[sizeof(sMagic)];
+  quint16 version = 0;
+  quint32 bom = 0;
+  quint32 colorCount = 0;
+  if ((!read(magic, sizeof(magic))) ||
+      (std::memcmp(magic, sMagic, sizeof(sMagic)) != 0) ||
+      (!read(&version, sizeof(version))) || (version != sFormatVersion) ||
+      (!read(&bom, sizeof(bom))) || (bom != sByteOrderMark) ||
+      (!read(&colorCount, sizeof(colorCount)))) {
+    return tl::nullopt;
+  }
+  Mesh mesh;
+  for (quint32 i = 0; i < colorCount; ++i) {
+    double color[3];
+    quint32 vertexCount = 0;
+    if ((!read(color, sizeof(color))) ||
+        (!read(&vertexCount, sizeof(vertexCount))) ||
+        ((pos + qint64(vertexCount) * qint64(sizeof(QVector3D))) > size)) {
+      return tl::nullopt;
+    }
+    QVector<QVector3D> vertices(vertexCount);
+    read(vertices.data(), qint64(vertexCount) * sizeof(QVector3D));
+    mesh.insert(std::make_tuple(color[0], color[1], color[2]), vertices);
+  }
+  if (pos != size) {
+    return tl::nullopt;
+  }
+  return mesh;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+FilePath MeshCache::getFilePath(const QByteArray& key) const noexcept {
+  return mDir.getPathTo(QString::fromLatin1(key) + ".mesh");
+}
+
+void MeshCache::markAsUsed(const FilePath& fp) const noexcept {
+  // The modification time is used to determine the least recently used
+  // files. To avoid a write access on every load, it is only updated once
+  // per day.
+  const QDateTime now = QDateTime::currentDateTimeUtc();
+  if (QFileInfo(fp.toStr()).lastModified().secsTo(now) < 24 * 3600) {
+    return;
+  }
+  QFile file(fp.toStr());
+  if ((!file.open(QIODevice::ReadWrite)) ||
+      (!file.setFileTime(now, QFileDevice::FileModificationTime))) {
+    qWarning() << "Failed to update time of cached 3D model:"
+               << file.errorString();
+  }
+}
+
+void MeshCache::removeLeastRecentlyUsed() const noexcept {
+  // Avoid several threads cleaning up the directory at the same time.
+  static QMutex mutex;
+  QMutexLocker lock(&mutex);
+
+  // Note: The list is sorted by modification time, newest first.
+  const QFileInfoList files =
+      QDir(mDir.toStr()).entryInfoList({"*.mesh"}, QDir::Files, QDir::Time);
+  qint64 totalSize = 0;
+  foreach (const QFileInfo& info, files) {
+    totalSize += info.size();
+    if ((totalSize > mMaxSize) && (!QFile::remove(info.absoluteFilePath()))) {
+      qWarning() << "Failed to remove cached 3D model:"
+                 << info.absoluteFilePath();
+    }
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,135 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_MESHCACHE_H
+#define LIBREPCB_CORE_MESHCACHE_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../fileio/filepath.h"
+
+#include <optional/tl/optional.hpp>
+
+#include <QtCore>
+#include <QtGui>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class MeshCache
+ ******************************************************************************/
+
+/**
+ * @brief Persistent on-disk cache of tesselated 3D models
+ *
+ * Loading and tesselating STEP models (see ::librepcb::OccModel) is very
+ * slow, so the resulting meshes are stored in a directory (one file per
+ * model, named by a SHA-256 hash of the STEP file content and the
+ * tesselation parameters) to make them available immediately the next time
+ * the same model is needed.
+ *
+ * The total size of the directory is limited. When exceeded, the least
+ * recently used files are removed. Files are considered as used when they
+ * were written or loaded (with a resolution of one day to avoid writing on
+ * every load).
+ *
+ * The files use a simple binary format in native byte order (files with a
+ * different byte order or format version are just ignored):
+ *
+ *   - Magic bytes "LPMESH" followed by a 16-bit format version
+ *   - 32-bit byte order mark (0x01020304)
+ *   - 32-bit number of colors, then for each color:
+ *     - Red, green and blue color components (3x 64-bit float)
+ *     - 32-bit number of vertices
+ *     - X, Y and Z coordinates of each vertex (3x 32-bit float)
+ *
+ * Files are memory-mapped when reading them, so no intermediate copy of the
+ * file content is needed.
+ *
+ * @note All methods are thread-safe.
+ */
+class MeshCache final {
+public:
+  // Types
+  typedef std::tuple<qreal, qreal, qreal> Color;
+  typedef QMap<Color, QVector<QVector3D>> Mesh;
+
+  // Constants
+  static const qint64 sDefaultMaxSize = 512 * 1024 * 1024;  ///< 512 MiB
+
+  // Constructors / Destructor
+  MeshCache() = delete;
+  MeshCache(const MeshCache& other) = delete;
+  explicit MeshCache(const FilePath& dir,
+                     qint64 maxSize = sDefaultMaxSize) noexcept;
+  ~MeshCache() noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Get a mesh from the cache
+   *
+   * @param key   The key as returned by #calcKey().
+   *
+   * @return The cached mesh, or `tl::nullopt` if it is not cached (or the
+   *         cache file is invalid).
+   */
+  tl::optional<Mesh> load(const QByteArray& key) const noexcept;
+
+  /**
+   * @brief Add a mesh to the cache
+   *
+   * If the cache exceeds its maximum size afterwards, the least recently
+   * used files are removed.
+   *
+   * @param key   The key as returned by #calcKey().
+   * @param mesh  The mesh to store. Errors are only logged since the cache
+   *              is not essential.
+   */
+  void store(const QByteArray& key, const Mesh& mesh) const noexcept;
+
+  // Static Methods
+  static QByteArray calcKey(const QByteArray& stepContent) noexcept;
+  static QByteArray serialize(const Mesh& mesh) noexcept;
+  static tl::optional<Mesh> deserialize(const char* data, qint64 size) noexcept;
+
+  // Operator Overloadings
+  MeshCache& operator=(const MeshCache& rhs) = delete;
+
+private:  // Methods
+  FilePath getFilePath(const QByteArray& key) const noexcept;
+  void markAsUsed(const FilePath& fp) const noexcept;
+  void removeLeastRecentlyUsed() const noexcept;
+
+private:  // Data
+  const FilePath mDir;
+  const qint64 mMaxSize;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
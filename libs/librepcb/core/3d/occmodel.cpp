@@ -78,6 +78,13 @@ namespace librepcb {
 
 bool OccModel::sOutputVerbosityConfigured = false;
 
+// Parameters of the tesselation. Increment the version whenever the
+// tesselation algorithm is changed, to invalidate meshes cached with
+// ::librepcb::MeshCache.
+static const int sTesselationVersion = 1;
+static const qreal sTesselationDeflection = 0.01;
+static const qreal sTesselationDeflectionAngle = 20. * 3.141 / 180.;
+
 /*******************************************************************************
  *  Data
  ******************************************************************************/
@@ -97,6 +104,32 @@ struct OccModel::Data {
 
 #if USE_OPENCASCADE
 
+// The XCAF application keeps a list of its documents which is not thread-safe,
+// thus creating and closing documents needs to be serialized since STEP models
+// might be loaded from several threads in parallel.
+static QMutex sDocumentMutex;
+
+// Setting up the STEP reader and parsing the STEP file relies on global state
+// of OpenCascade (e.g. the interface static parameters, the shared
+// protocol/library registries and, in older versions, the STEP parser) which
+// is not thread-safe, thus these steps are serialized for all callers. The
+// transfer into the document and the tesselation work on per-model state
+// only, thus they can run in parallel.
+static QMutex sStepReaderMutex;
+
+static Handle(TDocStd_Document) newDocument() {
+  QMutexLocker lock(&sDocumentMutex);
+  Handle(XCAFApp_Application) app = XCAFApp_Application::GetApplication();
+  Handle(TDocStd_Document) doc;
+  app->NewDocument("MDTV-XCAF", doc);
+  return doc;
+}
+
+static void closeDocument(Handle(TDocStd_Document) doc) {
+  QMutexLocker lock(&sDocumentMutex);
+  doc->Close();
+}
+
 static bool tryGetColor(Handle(XCAFDoc_ColorTool) colorTool,
                         const TopoDS_Shape& shape, Quantity_Color& color) {
   return colorTool->GetColor(shape, XCAFDoc_ColorSurf, color) ||
@@ -117,8 +150,8 @@ static bool tesselateFace(Handle(XCAFDoc_ColorTool) colorTool,
                           QMap<OccModel::Color, QVector<QVector3D>>& result) {
   if (face.IsNull()) return false;
 
-  const Standard_Real deflectionAngle = 20. * 3.141 / 180.;
-  const Standard_Real deflection = 0.01;
+  const Standard_Real deflectionAngle = sTesselationDeflectionAngle;
+  const Standard_Real deflection = sTesselationDeflection;
 
   TopLoc_Location loc;
   Handle(Poly_Triangulation) triangulation =
@@ -292,6 +325,13 @@ OccModel::OccModel(std::unique_ptr<Data> data) : mImpl(std::move(data)) {
 }
 
 OccModel::~OccModel() noexcept {
+#if USE_OPENCASCADE
+  try {
+    closeDocument(mImpl->doc);
+  } catch (const Standard_Failure& e) {
+    qCritical() << "OpenCascade error:" << e.GetMessageString();
+  }
+#endif
 }
 
 /*******************************************************************************
@@ -495,6 +535,14 @@ QString OccModel::getOccVersionString() noexcept {
   return s;
 }
 
+QString OccModel::getTesselationId() noexcept {
+  return QString("%1;v%2;%3;%4")
+      .arg(getOccVersionString())
+      .arg(sTesselationVersion)
+      .arg(sTesselationDeflection)
+      .arg(sTesselationDeflectionAngle);
+}
+
 void OccModel::setVerboseOutput(bool verbose) noexcept {
 #if USE_OPENCASCADE
   const Message_SequenceOfPrinters& printers =
@@ -514,9 +562,7 @@ std::unique_ptr<OccModel> OccModel::createAssembly(const QString& name) {
   try {
     initOpenCascade();
 
-    Handle(XCAFApp_Application) app = XCAFApp_Application::GetApplication();
-    Handle(TDocStd_Document) doc;
-    app->NewDocument("MDTV-XCAF", doc);
+    Handle(TDocStd_Document) doc = newDocument();
     Handle(XCAFDoc_ShapeTool) shapeTool =
         XCAFDoc_DocumentTool::ShapeTool(doc->Main());
     TDF_Label label = shapeTool->NewShape();
@@ -548,9 +594,7 @@ std::unique_ptr<OccModel> OccModel::createBoard(const librepcb::Path& outline,
   try {
     initOpenCascade();
 
-    Handle(XCAFApp_Application) app = XCAFApp_Application::GetApplication();
-    Handle(TDocStd_Document) doc;
-    app->NewDocument("MDTV-XCAF", doc);
+    Handle(TDocStd_Document) doc = newDocument();
     Handle(XCAFDoc_ShapeTool) shapeTool =
         XCAFDoc_DocumentTool::ShapeTool(doc->Main());
 
@@ -624,9 +668,8 @@ std::unique_ptr<OccModel> OccModel::loadStep(const QByteArray content) {
   try {
     initOpenCascade();
 
-    Handle(XCAFApp_Application) app = XCAFApp_Application::GetApplication();
-    Handle(TDocStd_Document) doc;
-    app->NewDocument("MDTV-XCAF", doc);
+    Handle(TDocStd_Document) doc = newDocument();
+    QMutexLocker lock(&sStepReaderMutex);
     STEPCAFControl_Reader stepReader;
     stepReader.SetColorMode(Standard_True);
     stepReader.SetNameMode(Standard_False);
@@ -634,7 +677,7 @@ std::unique_ptr<OccModel> OccModel::loadStep(const QByteArray content) {
 
     STEPControl_Reader& reader = stepReader.ChangeReader();
 #if OCC_VERSION_HEX >= 0x070500
-    std::istringstream is(content.data());
+    std::istringstream is(std::string(content.constData(), content.size()));
     const IFSelect_ReturnStatus ret = reader.ReadStream("stream.step", is);
 #else
     FilePath tmp = FilePath::getRandomTempPath();
@@ -642,12 +685,14 @@ std::unique_ptr<OccModel> OccModel::loadStep(const QByteArray content) {
     const IFSelect_ReturnStatus ret = reader.ReadFile(qPrintable(tmp.toStr()));
     FileUtils::removeFile(tmp);  // can throw
 #endif
+    lock.unlock();
     if (ret != IFSelect_RetDone) {
+      closeDocument(doc);
       throw RuntimeError(__FILE__, __LINE__, tr("Failed to read STEP file!"));
     }
 
     if (!stepReader.Transfer(doc)) {
-      doc->Close();
+      closeDocument(doc);
       throw RuntimeError(__FILE__, __LINE__, "Failed to transfer STEP model.");
     }
     result.reset(
@@ -72,6 +72,7 @@ public:
   // Static Methods
   static bool isAvailable() noexcept;
   static QString getOccVersionString() noexcept;
+  static QString getTesselationId() noexcept;
   static void setVerboseOutput(bool verbose) noexcept;
   static std::unique_ptr<OccModel> createAssembly(const QString& name);
   static std::unique_ptr<OccModel> createBoard(const Path& outline,
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "stepexport.h"
 
+#include "../exceptions.h"
 #include "../fileio/filesystem.h"
 #include "../fileio/fileutils.h"
 #include "../types/pcbcolor.h"
@@ -146,37 +147,82 @@ QString StepExport::run(std::shared_ptr<SceneData3D> data, FilePath fp,
     }
     emit progressPercent(20);
 
-    // Add devices.
-    int deviceErrors = 0;
-    QString lastError;
+    // Read the STEP files of all devices and deduplicate them by content,
+    // since typically many devices share the same model.
+    emit progressStatus(tr("Loading device models..."));
+    QVector<QByteArray> deviceKeys;
+    QHash<QByteArray, QByteArray> uniqueContents;
     if (std::shared_ptr<FileSystem> fs = data->getFileSystem()) {
-      int i = 1;
       for (const auto& obj : data->getDevices()) {
-        try {
-          emit progressStatus(tr("Exporting device %1/%2...")
-                                  .arg(i)
-                                  .arg(data->getDevices().count()));
-          const QByteArray content = fs->readIfExists(obj.stepFile);
-          if (!content.isEmpty()) {
-            Point3D pos = obj.stepPosition;
-            if (!obj.transform.getMirrored()) {
-              std::get<2>(pos) += *data->getThickness();
-            }
-            std::unique_ptr<OccModel> devModel = OccModel::loadStep(content);
-            model->addToAssembly(*devModel, pos, obj.stepRotation,
-                                 obj.transform, obj.name);
+        const QByteArray content = fs->readIfExists(obj.stepFile);
+        const QByteArray key = content.isEmpty()
+            ? QByteArray()
+            : QCryptographicHash::hash(content, QCryptographicHash::Sha256);
+        if ((!key.isEmpty()) && (!uniqueContents.contains(key))) {
+          uniqueContents.insert(key, content);
+        }
+        deviceKeys.append(key);
+      }
+    }
+    if (mAbort) return QString();
+
+    // Load each unique model once, in parallel on the global thread pool.
+    auto loadModel = [this](const QByteArray& content) -> LoadedModel {
+      LoadedModel result;
+      if (mAbort) return result;
+      try {
+        result.model = OccModel::loadStep(content);
+      } catch (const Exception& e) {
+        result.error = e.getMsg();
+      }
+      return result;
+    };
+    QHash<QByteArray, QFuture<LoadedModel>> futures;
+    for (auto it = uniqueContents.begin(); it != uniqueContents.end(); ++it) {
+      futures.insert(it.key(), QtConcurrent::run(loadModel, it.value()));
+    }
+    uniqueContents.clear();  // Free memory.
+    int loadedModels = 0;
+    QHash<QByteArray, LoadedModel> models;
+    for (auto it = futures.begin(); it != futures.end(); ++it) {
+      models.insert(it.key(), it.value().result());  // Blocks.
+      ++loadedModels;
+      emit progressPercent(20 + ((50 * loadedModels) / futures.count()));
+    }
+    futures.clear();
+    if (mAbort) return QString();
+
+    // Add devices to the assembly in their original order.
+    int deviceErrors = 0;
+    QString lastError;
+    for (int i = 0; i < deviceKeys.count(); ++i) {
+      const SceneData3D::DeviceData& obj = data->getDevices().at(i);
+      try {
+        emit progressStatus(tr("Exporting device %1/%2...")
+                                .arg(i + 1)
+                                .arg(data->getDevices().count()));
+        const auto modelIt = models.constFind(deviceKeys.at(i));
+        if (modelIt != models.constEnd()) {
+          if (!modelIt->model) {
+            throw RuntimeError(__FILE__, __LINE__, modelIt->error);
+          }
+          Point3D pos = obj.stepPosition;
+          if (!obj.transform.getMirrored()) {
+            std::get<2>(pos) += *data->getThickness();
           }
-        } catch (const Exception& e) {
-          qCritical().noquote() << "Failed to export STEP model of " << obj.name
-                                << ": " << e.getMsg();
-          ++deviceErrors;
-          lastError = obj.name % ": " % e.getMsg();
+          model->addToAssembly(*modelIt->model, pos, obj.stepRotation,
+                               obj.transform, obj.name);
         }
-        emit progressPercent(20 + ((70 * i) / data->getDevices().count()));
-        if (mAbort) return QString();
-        ++i;
+      } catch (const Exception& e) {
+        qCritical().noquote() << "Failed to export STEP model of " << obj.name
+                              << ": " << e.getMsg();
+        ++deviceErrors;
+        lastError = obj.name % ": " % e.getMsg();
       }
+      emit progressPercent(70 + ((20 * (i + 1)) / deviceKeys.count()));
+      if (mAbort) return QString();
     }
+    models.clear();  // Free memory.
 
     // Save model to file.
     emit progressStatus(tr("Saving..."));
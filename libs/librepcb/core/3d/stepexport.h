@@ -33,6 +33,7 @@
 namespace librepcb {
 
 class FilePath;
+class OccModel;
 class SceneData3D;
 
 /*******************************************************************************
@@ -94,6 +95,12 @@ signals:
   void failed(QString errorMsg);
   void finished();
 
+private:  // Types
+  struct LoadedModel {
+    std::shared_ptr<OccModel> model;  ///< `nullptr` if loading failed
+    QString error;
+  };
+
 private:  // Methods
   QString run(std::shared_ptr<SceneData3D> data, FilePath fp,
               int finishDelayMs) noexcept;
@@ -37,59 +37,96 @@ namespace librepcb {
 
 QString AttributeSubstitutor::substitute(QString str, LookupFunction lookup,
                                          FilterFunction filter) noexcept {
-  int startPos = 0;
-  int length = 0;
-  int outerVariableStart = -1;
-  int outerVariableEnd = -1;  // counted from end of string
-  QString value;
-  QStringList keys;
   QSet<QString> keyBacktrace;  // avoid endless recursion
-  while (searchVariablesInText(str, startPos, startPos, length, keys)) {
-    if (filter && (startPos + length > str.length() - outerVariableEnd)) {
-      applyFilter(str, outerVariableStart, outerVariableEnd, filter);
-    }
-    if (filter && (outerVariableStart < 0)) {
-      outerVariableStart = startPos;
-      outerVariableEnd = str.length() - length - startPos;
+  return substituteRecursive(str, lookup, filter, keyBacktrace);
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+QString AttributeSubstitutor::substituteRecursive(
+    const QString& str, const LookupFunction& lookup,
+    const FilterFunction& filter, QSet<QString>& keyBacktrace) noexcept {
+  if (!str.contains(QLatin1String("{{"))) {
+    return str;  // fast path for texts without variables
+  }
+
+  QString result;
+  const std::shared_ptr<const QVector<Token>> tokens = compile(str);
+  for (const Token& token : *tokens) {
+    if (token.keys.isEmpty()) {
+      result += token.text;
+      continue;
     }
-    bool keyFound = false;
-    foreach (const QString& key, keys) {
+    QString value;
+    foreach (const QString& key, token.keys) {
+      QString keyValue;
       if (key.startsWith('\'') && key.endsWith('\'')) {
-        // replace "{{'VALUE'}}" with "VALUE"
-        str.replace(startPos, length, key.mid(1, key.length() - 2));
-        startPos +=
-            key.length() - 2;  // do not search for variables in the value
-        keyFound = true;
+        // replace "{{'VALUE'}}" with "VALUE" (without substituting VALUE)
+        value = key.mid(1, key.length() - 2);
         break;
-      } else if ((getValueOfKey(key, value, lookup)) &&
+      } else if ((getValueOfKey(key, keyValue, lookup)) &&
                  (!keyBacktrace.contains(key))) {
-        // replace "{{KEY}}" with the value of KEY
-        str.replace(startPos, length, value);
+        // replace "{{KEY}}" with the (substituted) value of KEY
         keyBacktrace.insert(key);
-        keyFound = true;
+        value = substituteRecursive(keyValue, lookup, nullptr, keyBacktrace);
         break;
       }
     }
-    if (!keyFound) {
-      // attribute not found, remove "{{KEY}}" from str
-      str.remove(startPos, length);
+    // If no key was found, the variable is replaced by an empty string. The
+    // filter is applied only to the values of the outermost variables.
+    result += filter ? filter(value) : value;
+  }
+  return result;
+}
+
+std::shared_ptr<const QVector<AttributeSubstitutor::Token>>
+    AttributeSubstitutor::compile(const QString& str) noexcept {
+  static QMutex cacheMutex;
+  static QHash<QString, std::shared_ptr<const QVector<Token>>> cache;
+  static const int maxCacheSize = 10000;
+  static const int maxTemplateLength = 1000;  // don't cache huge templates
+
+  {
+    QMutexLocker lock(&cacheMutex);
+    auto it = cache.constFind(str);
+    if (it != cache.constEnd()) {
+      return *it;
     }
   }
-  if (filter && (outerVariableStart >= 0)) {
-    applyFilter(str, outerVariableStart, outerVariableEnd, filter);
+
+  auto tokens = std::make_shared<QVector<Token>>();
+  int startPos = 0;
+  int pos = 0;
+  int length = 0;
+  QStringList keys;
+  while (searchVariablesInText(str, startPos, pos, length, keys)) {
+    if (pos > startPos) {
+      tokens->append(Token{str.mid(startPos, pos - startPos), QStringList()});
+    }
+    tokens->append(Token{QString(), keys});
+    startPos = pos + length;
+  }
+  if (startPos < str.length()) {
+    tokens->append(Token{str.mid(startPos), QStringList()});
   }
-  return str;
-}
 
-/*******************************************************************************
- *  Private Methods
- ******************************************************************************/
+  if (str.length() <= maxTemplateLength) {
+    QMutexLocker lock(&cacheMutex);
+    if (cache.count() >= maxCacheSize) {
+      cache.clear();  // Avoid unlimited memory consumption.
+    }
+    cache.insert(str, tokens);
+  }
+  return tokens;
+}
 
 bool AttributeSubstitutor::searchVariablesInText(const QString& text,
                                                  int startPos, int& pos,
                                                  int& length,
                                                  QStringList& keys) noexcept {
-  QRegularExpression re("\\{\\{(.*?)\\}\\}");
+  static const QRegularExpression re("\\{\\{(.*?)\\}\\}");
   QRegularExpressionMatch match = re.match(text, startPos);
   if (match.hasMatch() && match.capturedLength() > 0) {
     pos = match.capturedStart();
@@ -110,16 +147,8 @@ bool AttributeSubstitutor::searchVariablesInText(const QString& text,
   }
 }
 
-void AttributeSubstitutor::applyFilter(QString& str, int& start, int& end,
-                                       FilterFunction filter) noexcept {
-  int length = str.length() - end - start;
-  str.replace(start, length, filter(str.mid(start, length)));
-  start = -1;
-  end = -1;
-}
-
-bool AttributeSubstitutor::getValueOfKey(const QString& key, QString& value,
-                                         LookupFunction lookup) noexcept {
+bool AttributeSubstitutor::getValueOfKey(
+    const QString& key, QString& value, const LookupFunction& lookup) noexcept {
   if (lookup) {
     value = lookup(key);
     return !value.isEmpty();
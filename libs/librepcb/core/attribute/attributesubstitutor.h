@@ -26,6 +26,7 @@
 #include <QtCore>
 
 #include <functional>
+#include <memory>
 
 /*******************************************************************************
  *  Namespace / Forward Declarations
@@ -44,6 +45,12 @@ namespace librepcb {
  * Please read the documentation about the @ref doc_attributes_system to get an
  * idea how the @ref doc_attributes_system works in detail.
  *
+ * Templates are parsed only once into a list of text and variable tokens,
+ * which is then cached (keyed by the template string) since usually the
+ * same few templates (e.g. "{{NAME}}") are substituted again and again.
+ * Note that variables are only detected within templates and within
+ * substituted values, but not across their boundaries.
+ *
  * @see ::librepcb::ProjectAttributeLookup
  * @see @ref doc_attributes_system
  *
@@ -84,7 +91,28 @@ public:
   static QString substitute(QString str, LookupFunction lookup = nullptr,
                             FilterFunction filter = nullptr) noexcept;
 
+private:  // Types
+  struct Token {
+    QString text;  ///< Plain text (only if #keys is empty)
+    QStringList keys;  ///< Variable keys (empty if it is plain text)
+  };
+
 private:  // Methods
+  static QString substituteRecursive(const QString& str,
+                                     const LookupFunction& lookup,
+                                     const FilterFunction& filter,
+                                     QSet<QString>& keyBacktrace) noexcept;
+
+  /**
+   * @brief Parse a template into tokens, or get them from the cache
+   *
+   * @param str   The template text.
+   *
+   * @return The tokens of the passed template.
+   */
+  static std::shared_ptr<const QVector<Token>> compile(
+      const QString& str) noexcept;
+
   /**
    * @brief Search the next variables (e.g. "{{KEY or FALLBACK}}") in a given
    * text
@@ -104,11 +132,8 @@ private:  // Methods
   static bool searchVariablesInText(const QString& text, int startPos, int& pos,
                                     int& length, QStringList& keys) noexcept;
 
-  static void applyFilter(QString& str, int& start, int& end,
-                          FilterFunction filter) noexcept;
-
   static bool getValueOfKey(const QString& key, QString& value,
-                            LookupFunction lookup) noexcept;
+                            const LookupFunction& lookup) noexcept;
 };
 
 /*******************************************************************************
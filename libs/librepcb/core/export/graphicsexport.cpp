@@ -24,6 +24,7 @@
 
 #include "../application.h"
 #include "../fileio/fileutils.h"
+#include "../utils/scopeguard.h"
 #include "graphicsexportsettings.h"
 #include "utils/qtmetatyperegistration.h"
 
@@ -45,6 +46,9 @@ namespace librepcb {
 static QtMetaTypeRegistration<QImage> sImageMetaType;
 static QtMetaTypeRegistration<std::shared_ptr<QPicture>> sSharedPictureMetaType;
 
+QMutex GraphicsExport::sCacheMutex;
+QList<GraphicsExport::CachedRecording> GraphicsExport::sCache;
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
@@ -197,6 +201,25 @@ GraphicsExport::Result GraphicsExport::run(RunArgs args) noexcept {
       throw RuntimeError(__FILE__, __LINE__, tr("No pages to export/print."));
     }
 
+    // Record the content of all pages in parallel since painting complex
+    // pages is expensive. The recordings are replayed in order below, thus
+    // the output is identical to painting the pages sequentially. Make sure
+    // all recordings are finished before leaving this method.
+    std::atomic<bool> stopRecording(false);
+    QVector<QFuture<std::shared_ptr<const QPicture>>> recordings;
+    auto recordingsGuard = scopeGuard([&stopRecording, &recordings]() {
+      stopRecording = true;
+      for (auto& future : recordings) {
+        future.waitForFinished();
+      }
+    });
+    foreach (const Page& page, args.pages) {
+      recordings.append(QtConcurrent::run([this, &stopRecording, page]() {
+        return (mAbort || stopRecording) ? std::shared_ptr<const QPicture>()
+                                         : recordPage(page);
+      }));
+    }
+
     // Export all pages.
     QPainter painter;
     for (int index = 0; index < args.pages.count(); ++index) {
@@ -204,12 +227,14 @@ GraphicsExport::Result GraphicsExport::run(RunArgs args) noexcept {
       emit progress(20 + std::ceil(percentPerPage * index), index + 1,
                     args.pages.count());
       const Page& page = args.pages.at(index);
-      if (mAbort) {
+      const std::shared_ptr<const QPicture> recording =
+          recordings.at(index).result();
+      if (mAbort || (!recording)) {
         break;
       }
 
       // Determine source bounding rect.
-      QRectF sourceRectPx = calcSourceRect(*page.first, *page.second);
+      QRectF sourceRectPx = recording->boundingRect();
       QTransform sourceTransform = getSourceTransformation(*page.second);
       QRectF sourceRectTransformedPx = sourceTransform.mapRect(sourceRectPx);
 
@@ -366,7 +391,7 @@ GraphicsExport::Result GraphicsExport::run(RunArgs args) noexcept {
       painter.setTransform(sourceTransform, true);
       painter.scale(scale, scale);
       painter.translate(-sourceRectPx.center().x(), -sourceRectPx.center().y());
-      page.first->paint(painter, *page.second);
+      painter.drawPicture(0, 0, *recording);
       painter.restore();
 
       // Finish painting of current page.
@@ -447,15 +472,54 @@ QTransform GraphicsExport::getSourceTransformation(
   return t;
 }
 
-QRectF GraphicsExport::calcSourceRect(
-    const GraphicsPagePainter& page,
-    const GraphicsExportSettings& settings) noexcept {
-  QPicture picture;
+std::shared_ptr<const QPicture> GraphicsExport::recordPage(
+    const Page& page) noexcept {
+  // Note: This method is called from multiple threads at the same time!
+  const QByteArray contentHash = page.first->getContentHash();
+
+  // Look up the cache. Replaying a QPicture modifies its internal buffer, so
+  // every run gets its own copy of a cached recording to replay it.
+  if (!contentHash.isEmpty()) {
+    QMutexLocker lock(&sCacheMutex);
+    for (auto it = sCache.begin(); it != sCache.end(); ++it) {
+      if ((it->contentHash == contentHash) &&
+          (it->settings == *page.second)) {
+        const CachedRecording entry = *it;
+        sCache.erase(it);
+        sCache.append(entry);
+        lock.unlock();
+        std::shared_ptr<QPicture> picture = std::make_shared<QPicture>();
+        picture->setData(entry.pictureData.constData(),
+                         entry.pictureData.size());
+        return picture;
+      }
+    }
+  }
+
+  // Record the page.
+  std::shared_ptr<QPicture> picture = std::make_shared<QPicture>();
   QPainter painter;
-  painter.begin(&picture);
-  page.paint(painter, settings);
+  painter.begin(picture.get());
+  page.first->paint(painter, *page.second);
   painter.end();
-  return picture.boundingRect();
+
+  // Add a copy of it to the cache, removing least recently used entries if
+  // the cache is too large.
+  if (!contentHash.isEmpty()) {
+    QMutexLocker lock(&sCacheMutex);
+    sCache.append(
+        CachedRecording{contentHash, *page.second,
+                        QByteArray(picture->data(), picture->size())});
+    qint64 cacheSize = 0;
+    for (auto it = sCache.rbegin(); it != sCache.rend(); ++it) {
+      cacheSize += it->pictureData.size();
+      if (cacheSize > sMaxCacheSize) {
+        sCache.erase(sCache.begin(), it.base());
+        break;
+      }
+    }
+  }
+  return picture;
 }
 
 QPageLayout::Orientation GraphicsExport::getOrientation(
@@ -75,6 +75,18 @@ public:
    */
   virtual void paint(QPainter& painter,
                      const GraphicsExportSettings& settings) const noexcept = 0;
+
+  /**
+   * @brief Get a hash of the page content
+   *
+   * ::librepcb::GraphicsExport caches recordings of pages by this hash and
+   * the export settings, so pages with the same content are not painted
+   * again, even if they are provided by different painter objects.
+   *
+   * @return Hash of everything #paint() depends on (except the settings),
+   *         or an empty byte array if the page shall not be cached.
+   */
+  virtual QByteArray getContentHash() const noexcept { return QByteArray(); }
 };
 
 /*******************************************************************************
@@ -86,6 +98,13 @@ public:
  *
  * Used for graphics printing, PDF export, SVG export etc. without blocking
  * the main thread.
+ *
+ * The content of all pages is first recorded into QPicture objects in
+ * parallel, which are then replayed in the original order to the output
+ * device. Recordings are cached by
+ * ::librepcb::GraphicsPagePainter::getContentHash(), so repeated previews or
+ * exports of the same page content with the same settings don't paint it
+ * again.
  */
 class GraphicsExport final : public QObject {
   Q_OBJECT
@@ -204,12 +223,17 @@ private:  // Types
     int copies;
   };
 
+  struct CachedRecording {
+    QByteArray contentHash;
+    GraphicsExportSettings settings;
+    QByteArray pictureData;
+  };
+
 private:  // Methods
   Result run(RunArgs args) noexcept;
   static QTransform getSourceTransformation(
       const GraphicsExportSettings& settings) noexcept;
-  static QRectF calcSourceRect(const GraphicsPagePainter& page,
-                               const GraphicsExportSettings& settings) noexcept;
+  static std::shared_ptr<const QPicture> recordPage(const Page& page) noexcept;
   static QPageLayout::Orientation getOrientation(const QSizeF& size) noexcept;
 
 private:  // Data
@@ -217,6 +241,11 @@ private:  // Data
   QString mDocumentName;
   QFuture<Result> mFuture;
   bool mAbort;
+
+  // Recording cache, shared by all instances
+  static QMutex sCacheMutex;
+  static QList<CachedRecording> sCache;  ///< Most recently used last
+  static const int sMaxCacheSize = 256 * 1024 * 1024;  ///< Bytes
 };
 
 /*******************************************************************************
@@ -23,7 +23,9 @@
 #include "transactionalfilesystem.h"
 
 #include "../serialization/sexpression.h"
+#include "../utils/memoryreport.h"
 #include "../utils/toolbox.h"
+#include "../utils/tracer.h"
 #include "fileutils.h"
 
 #include <quazip/quazip.h>
@@ -47,12 +49,16 @@ TransactionalFileSystem::TransactionalFileSystem(
     mIsWritable(writable),
     mLock(filepath),
     mRestoredFromAutosave(false),
+    mMemoryMapped(false),
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 15, 0))
-    mMutex()
+    mMutex(),
 #else
-    mMutex(QMutex::Recursive)
+    mMutex(QMutex::Recursive),
 #endif
-{
+    mAutosaveMutex(),
+    mAutosaveDirtyFiles(),
+    mAutosaveFilesDir(),
+    mAutosaveOverlay() {
   // Load the backup if there is one (i.e. last save operation has failed).
   FilePath backupFile = mFilePath.getPathTo(".backup/backup.lp");
   if (backupFile.isExistingFile()) {
@@ -85,6 +91,7 @@ TransactionalFileSystem::~TransactionalFileSystem() noexcept {
   // restored but not saved in the meantime, do NOT remove the autosave
   // directory!
   if (mIsWritable && (!mRestoredFromAutosave)) {
+    QMutexLocker autosaveLock(&mAutosaveMutex);
     try {
       removeDiff("autosave");  // can throw
     } catch (const Exception& e) {
@@ -93,6 +100,19 @@ TransactionalFileSystem::~TransactionalFileSystem() noexcept {
   }
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 TransactionalFileSystem::getApproxMemoryUsage() const noexcept {
+  QMutexLocker lock(&mMutex);
+  qint64 bytes = 0;
+  for (auto it = mModifiedFiles.begin(); it != mModifiedFiles.end(); it++) {
+    bytes += MemoryReport::estimate(it.key()) + MemoryReport::estimate(*it);
+  }
+  return bytes;
+}
+
 /*******************************************************************************
  *  Inherited from FileSystem
  ******************************************************************************/
@@ -190,6 +210,12 @@ QByteArray TransactionalFileSystem::readIfExists(const QString& path) const {
   } else if (!isRemoved(cleanedPath)) {
     const FilePath fp = mFilePath.getPathTo(cleanedPath);
     if (fp.isExistingFile()) {
+      if (mMemoryMapped) {
+        const QByteArray content = readMapped(cleanedPath, fp);
+        if (!content.isNull()) {
+          return content;
+        }
+      }
       return FileUtils::readFile(fp);  // can throw
     }
   }
@@ -200,8 +226,13 @@ void TransactionalFileSystem::write(const QString& path,
                                     const QByteArray& content) {
   const QString cleanedPath = cleanPath(path);
   QMutexLocker lock(&mMutex);
+  auto it = mModifiedFiles.constFind(cleanedPath);
+  if ((it != mModifiedFiles.constEnd()) && (*it == content)) {
+    return;  // Content not modified, no need to autosave it again.
+  }
   mModifiedFiles[cleanedPath] = content;
   mRemovedFiles.remove(cleanedPath);
+  mAutosaveDirtyFiles.insert(cleanedPath);
 }
 
 void TransactionalFileSystem::renameFile(const QString& src,
@@ -324,6 +355,7 @@ void TransactionalFileSystem::discardChanges() noexcept {
   mModifiedFiles.clear();
   mRemovedFiles.clear();
   mRemovedDirs.clear();
+  mAutosaveDirtyFiles.clear();
 }
 
 QStringList TransactionalFileSystem::checkForModifications() const {
@@ -359,16 +391,83 @@ QStringList TransactionalFileSystem::checkForModifications() const {
   return modifications;
 }
 
-void TransactionalFileSystem::autosave() {
-  QMutexLocker lock(&mMutex);
-  saveDiff("autosave");  // can throw
+void TransactionalFileSystem::autosave(
+    const QHash<QString, QByteArray>& overlay) {
+  LIBREPCB_TRACE_SCOPE_DETAIL("fileio", "autosave", mFilePath.toNative());
+  QMutexLocker autosaveLock(&mAutosaveMutex);
+
+  // Take a snapshot of the modifications and write it without holding the
+  // main mutex, to allow other threads accessing the file system meanwhile.
+  // Note that copying the containers is cheap thanks to implicit sharing.
+  QHash<QString, QByteArray> modifiedFiles;
+  QSet<QString> removedFiles;
+  QSet<QString> removedDirs;
+  QSet<QString> filesToWrite;
+  {
+    QMutexLocker lock(&mMutex);
+    modifiedFiles = mModifiedFiles;
+    removedFiles = mRemovedFiles;
+    removedDirs = mRemovedDirs;
+    filesToWrite = mAutosaveDirtyFiles;
+    mAutosaveDirtyFiles.clear();
+  }
+
+  // Apply the overlay to the snapshot. Overlay files are written only if
+  // their content differs from the last autosave, and files which are no
+  // longer overlaid are written again with the content of the file system.
+  QHash<QString, QByteArray> newOverlay;
+  for (auto it = overlay.begin(); it != overlay.end(); it++) {
+    const QString path = cleanPath(it.key());
+    modifiedFiles[path] = it.value();
+    removedFiles.remove(path);
+    newOverlay.insert(path, it.value());
+    auto lastIt = mAutosaveOverlay.constFind(path);
+    if ((lastIt == mAutosaveOverlay.constEnd()) || (*lastIt != it.value())) {
+      filesToWrite.insert(path);
+    }
+  }
+  for (auto it = mAutosaveOverlay.begin(); it != mAutosaveOverlay.end();
+       it++) {
+    if (!newOverlay.contains(it.key())) {
+      filesToWrite.insert(it.key());
+    }
+  }
+
+  // If there is no valid autosave yet, write all files into a new directory.
+  // Otherwise only the files modified since the last autosave are written
+  // since all the others are already up to date in the existing directory.
+  if (mAutosaveFilesDir.isEmpty()) {
+    mAutosaveFilesDir =
+        QDateTime::currentDateTime().toString("yyyy-MM-dd_hh-mm-ss-zzz");
+    filesToWrite = Toolbox::toSet(modifiedFiles.keys());
+  }
+  try {
+    saveDiff("autosave", mAutosaveFilesDir, modifiedFiles, removedFiles,
+             removedDirs, filesToWrite);  // can throw
+    mAutosaveOverlay = newOverlay;
+  } catch (...) {
+    mAutosaveFilesDir.clear();  // Write all files on the next attempt.
+    mAutosaveOverlay.clear();
+    throw;
+  }
 }
 
 void TransactionalFileSystem::save() {
+  LIBREPCB_TRACE_SCOPE_DETAIL("fileio", "save", mFilePath.toNative());
+  QMutexLocker autosaveLock(&mAutosaveMutex);
   QMutexLocker lock(&mMutex);
 
+  // Mapped files must not be overwritten while they are in use.
+  if (mMemoryMapped) {
+    throw LogicError(__FILE__, __LINE__,
+                     "Memory-mapped file systems cannot be saved.");
+  }
+
   // save to backup directory
-  saveDiff("backup");  // can throw
+  saveDiff("backup",
+           QDateTime::currentDateTime().toString("yyyy-MM-dd_hh-mm-ss-zzz"),
+           mModifiedFiles, mRemovedFiles, mRemovedDirs,
+           Toolbox::toSet(mModifiedFiles.keys()));  // can throw
 
   // modifications are now saved to the backup directory, so there is no risk
   // of losing a restored autosave backup, thus we can reset its flag
@@ -377,6 +476,8 @@ void TransactionalFileSystem::save() {
   // remove autosave directory because it is now older than the backup content
   // (the user should not be able to restore the outdated autosave backup)
   removeDiff("autosave");  // can throw
+  mAutosaveFilesDir.clear();
+  mAutosaveOverlay.clear();
 
   // remove directories
   foreach (const QString& dir, mRemovedDirs) {
@@ -416,6 +517,14 @@ void TransactionalFileSystem::releaseLock() {
  *  Static Methods
  ******************************************************************************/
 
+std::shared_ptr<TransactionalFileSystem> TransactionalFileSystem::openMapped(
+    const FilePath& filepath, QObject* parent) {
+  std::shared_ptr<TransactionalFileSystem> fs =
+      open(filepath, false, RestoreCallback(), nullptr, parent);  // can throw
+  fs->mMemoryMapped = true;
+  return fs;
+}
+
 QString TransactionalFileSystem::cleanPath(QString path) noexcept {
   return path.trimmed()
       .replace('\\', '/')
@@ -442,6 +551,40 @@ bool TransactionalFileSystem::isRemoved(const QString& path) const noexcept {
   return false;
 }
 
+QByteArray TransactionalFileSystem::readMapped(
+    const QString& path, const FilePath& fp) const noexcept {
+  // Note: The mutex must already be locked by the caller!
+  auto it = mMappedFiles.find(path);
+  if (it == mMappedFiles.end()) {
+    // Small files are read into memory since mapping them has no benefit.
+    if (mMappedFiles.count() >= sMaxMappedFiles) {
+      return QByteArray();
+    }
+    std::shared_ptr<QFile> file = std::make_shared<QFile>(fp.toStr());
+    if ((!file->open(QIODevice::ReadOnly)) ||
+        (file->size() < sMinMappedFileSize) ||
+        (file->size() > std::numeric_limits<int>::max())) {
+      return QByteArray();
+    }
+    const uchar* data = file->map(0, file->size());
+    if (!data) {
+      qWarning() << "Failed to memory-map file:" << fp.toNative();
+      return QByteArray();
+    }
+    // Note: QByteArray::fromRawData() does not copy the data, and any
+    // modification of the returned byte array will detach it. The data is
+    // not NUL-terminated and gets unmapped when this object is destroyed,
+    // see the documentation of openMapped().
+    it = mMappedFiles.insert(
+        path,
+        std::make_pair(file,
+                       QByteArray::fromRawData(
+                           reinterpret_cast<const char*>(data),
+                           static_cast<int>(file->size()))));
+  }
+  return it->second;
+}
+
 void TransactionalFileSystem::exportDirToZip(QuaZipFile& file,
                                              const FilePath& zipFp,
                                              const QString& dir,
@@ -486,32 +629,45 @@ void TransactionalFileSystem::exportDirToZip(QuaZipFile& file,
   }
 }
 
-void TransactionalFileSystem::saveDiff(const QString& type) const {
+void TransactionalFileSystem::saveDiff(
+    const QString& type, const QString& filesDirName,
+    const QHash<QString, QByteArray>& modifiedFiles,
+    const QSet<QString>& removedFiles, const QSet<QString>& removedDirs,
+    const QSet<QString>& filesToWrite) const {
   QDateTime dt = QDateTime::currentDateTime();
   FilePath dir = mFilePath.getPathTo("." % type);
-  FilePath filesDir = dir.getPathTo(dt.toString("yyyy-MM-dd_hh-mm-ss-zzz"));
+  FilePath filesDir = dir.getPathTo(filesDirName);
+  FilePath indexFile = dir.getPathTo(type % ".lp");
 
   if (!mIsWritable) {
     throw RuntimeError(__FILE__, __LINE__, tr("File system is read-only."));
   }
 
+  // When overwriting files of an existing diff directory, remove the index
+  // file first to mark the diff as incomplete until all files are written.
+  if (filesDir.isExistingDir() && indexFile.isExistingFile()) {
+    FileUtils::removeFile(indexFile);  // can throw
+  }
+
   std::unique_ptr<SExpression> root =
       SExpression::createList("librepcb_" % type);
   root->ensureLineBreak();
   root->appendChild("created", dt);
   root->ensureLineBreak();
-  root->appendChild("modified_files_directory", filesDir.getFilename());
-  foreach (const QString& filepath, Toolbox::sorted(mModifiedFiles.keys())) {
+  root->appendChild("modified_files_directory", filesDirName);
+  foreach (const QString& filepath, Toolbox::sorted(modifiedFiles.keys())) {
     root->ensureLineBreak();
     root->appendChild("modified_file", filepath);
-    FileUtils::writeFile(filesDir.getPathTo(filepath),
-                         mModifiedFiles.value(filepath));  // can throw
+    if (filesToWrite.contains(filepath)) {
+      FileUtils::writeFile(filesDir.getPathTo(filepath),
+                           modifiedFiles.value(filepath));  // can throw
+    }
   }
-  foreach (const QString& filepath, Toolbox::sorted(mRemovedFiles.values())) {
+  foreach (const QString& filepath, Toolbox::sorted(removedFiles.values())) {
     root->ensureLineBreak();
     root->appendChild("removed_file", filepath);
   }
-  foreach (const QString& filepath, Toolbox::sorted(mRemovedDirs.values())) {
+  foreach (const QString& filepath, Toolbox::sorted(removedDirs.values())) {
     root->ensureLineBreak();
     root->appendChild("removed_directory", filepath);
   }
@@ -519,8 +675,7 @@ void TransactionalFileSystem::saveDiff(const QString& type) const {
 
   // Writing the main file must be the last operation to "mark" this diff as
   // complete!
-  FileUtils::writeFile(dir.getPathTo(type % ".lp"),
-                       root->toByteArray());  // can throw
+  FileUtils::writeFile(indexFile, root->toByteArray());  // can throw
 }
 
 void TransactionalFileSystem::loadDiff(const FilePath& fp) {
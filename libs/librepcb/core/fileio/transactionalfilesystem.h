@@ -156,8 +156,17 @@ public:
   // Getters
   const FilePath& getPath() const noexcept { return mFilePath; }
   bool isWritable() const noexcept { return mIsWritable; }
+  bool isMemoryMapped() const noexcept { return mMemoryMapped; }
   bool isRestoredFromAutosave() const noexcept { return mRestoredFromAutosave; }
 
+  /**
+   * @brief Get the approximate memory footprint of the file contents held in
+   *        memory (modified files, or all files if loaded from a Zip file)
+   *
+   * @return Number of bytes.
+   */
+  qint64 getApproxMemoryUsage() const noexcept;
+
   // Inherited from FileSystem
   virtual FilePath getAbsPath(const QString& path = "") const noexcept override;
   virtual QStringList getDirs(const QString& path = "") const noexcept override;
@@ -178,7 +187,27 @@ public:
   void exportToZip(const FilePath& fp, FilterFunction filter = nullptr) const;
   void discardChanges() noexcept;
   QStringList checkForModifications() const;
-  void autosave();
+
+  /**
+   * @brief Write all modifications to the autosave backup directory
+   *
+   * Only files which were modified since the last autosave are written to
+   * disk, all other files are still valid from the last autosave. The files
+   * are written without blocking concurrent access to the file system, so
+   * this method can be called from a worker thread while the GUI thread keeps
+   * modifying the file system.
+   *
+   * @param overlay   Additional files (path and content) to be written to the
+   *                  autosave backup, taking precedence over the content of
+   *                  the file system. They are not stored in the file system
+   *                  itself, so a snapshot taken earlier can be passed without
+   *                  overwriting newer content written by another thread.
+   *
+   * @throw Exception     If an error occurred.
+   */
+  void autosave(
+      const QHash<QString, QByteArray>& overlay = QHash<QString, QByteArray>());
+
   void save();
   void releaseLock();
 
@@ -204,13 +233,44 @@ public:
       QObject* parent = nullptr) {
     return open(filepath, true, restoreCallback, lockCallback, parent);
   }
+
+  /**
+   * @brief Open a directory in a lightweight, strictly read-only mode
+   *
+   * Intended for headless runs which never save the file system (e.g. CLI
+   * runs in CI): Autosave backups are ignored, and large files are
+   * memory-mapped instead of being copied into memory. #save() is not
+   * supported in this mode.
+   *
+   * @attention Content of mapped files returned by #read() and
+   *            #readIfExists() refers directly to the mapped memory:
+   *            - It is only valid as long as the file system exists, so it
+   *              must be deep-copied (e.g. with QByteArray::detach()) if it
+   *              needs to outlive the file system.
+   *            - It is not NUL-terminated, so it must always be accessed
+   *              with an explicit size (e.g. `constData()` and `size()`).
+   *            - The mapped files must not be modified by other processes
+   *              during that time.
+   *
+   * @param filepath  Path to the directory to open.
+   * @param parent    Parent QObject.
+   *
+   * @return The opened file system.
+   */
+  static std::shared_ptr<TransactionalFileSystem> openMapped(
+      const FilePath& filepath, QObject* parent = nullptr);
   static QString cleanPath(QString path) noexcept;
 
 private:  // Methods
   bool isRemoved(const QString& path) const noexcept;
+  QByteArray readMapped(const QString& path, const FilePath& fp) const noexcept;
   void exportDirToZip(QuaZipFile& file, const FilePath& zipFp,
                       const QString& dir, FilterFunction filter) const;
-  void saveDiff(const QString& type) const;
+  void saveDiff(const QString& type, const QString& filesDirName,
+                const QHash<QString, QByteArray>& modifiedFiles,
+                const QSet<QString>& removedFiles,
+                const QSet<QString>& removedDirs,
+                const QSet<QString>& filesToWrite) const;
   void loadDiff(const FilePath& fp);
   void removeDiff(const QString& type);
 
@@ -219,16 +279,30 @@ private:  // Data
   bool mIsWritable;
   DirectoryLock mLock;
   bool mRestoredFromAutosave;
+  bool mMemoryMapped;
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 15, 0))
   mutable QRecursiveMutex mMutex;
 #else
   mutable QMutex mMutex;
 #endif
 
+  // Memory-mapped files (only in memory-mapped mode), kept open since
+  // closing them would unmap their content
+  mutable QHash<QString, std::pair<std::shared_ptr<QFile>, QByteArray>>
+      mMappedFiles;
+  static const int sMaxMappedFiles = 256;  ///< To not exceed file handles
+  static const qint64 sMinMappedFileSize = 64 * 1024;  ///< Read small files
+
   // File system modifications
   QHash<QString, QByteArray> mModifiedFiles;
   QSet<QString> mRemovedFiles;
   QSet<QString> mRemovedDirs;
+
+  // Autosave state
+  QMutex mAutosaveMutex;  ///< Locked while writing the autosave backup
+  QSet<QString> mAutosaveDirtyFiles;  ///< Modified since last autosave
+  QString mAutosaveFilesDir;  ///< Empty if there is no valid autosave yet
+  QHash<QString, QByteArray> mAutosaveOverlay;  ///< Overlay of last autosave
 };
 
 /*******************************************************************************
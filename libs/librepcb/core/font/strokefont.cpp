@@ -161,22 +161,19 @@ QVector<Path> StrokeFont::strokeLine(const QString& text,
   Length offset = 0;
   width = 0;  // same as offset, but without last letter spacing
   for (int i = 0; i < text.length(); ++i) {
-    Length glyphSpacing;
-    QVector<Path> glyphPaths = strokeGlyph(text.at(i), height, glyphSpacing);
-    if (!glyphPaths.isEmpty()) {
-      Point bottomLeft, topRight;
-      computeBoundingRect(glyphPaths, bottomLeft, topRight);
-      Length shift =
-          (i == 0) ? -bottomLeft.getX() : 0;  // left-align first character
-      foreach (const Path& p, glyphPaths) {
+    const Glyph glyph = getGlyph(text.at(i), height);
+    if (!glyph.paths.isEmpty()) {
+      Length shift = (i == 0) ? -glyph.bottomLeft.getX()
+                              : 0;  // left-align first character
+      foreach (const Path& p, glyph.paths) {
         paths.append(p.translated(Point(offset + shift, Length(0))));
       }
-      width = offset + topRight.getX() +
+      width = offset + glyph.topRight.getX() +
           shift;  // do *not* count glyph spacing as width!
-      offset = width + glyphSpacing + letterSpacing;
-    } else if (glyphSpacing != 0) {
+      offset = width + glyph.spacing + letterSpacing;
+    } else if (glyph.spacing != 0) {
       // it's a whitespace-only glyph -> count additional glyph spacing as width
-      width = offset + glyphSpacing;
+      width = offset + glyph.spacing;
       offset = width + letterSpacing;
     }
   }
@@ -186,18 +183,9 @@ QVector<Path> StrokeFont::strokeLine(const QString& text,
 QVector<Path> StrokeFont::strokeGlyph(const QChar& glyph,
                                       const PositiveLength& height,
                                       Length& spacing) const noexcept {
-  try {
-    qreal glyphSpacing = 0;
-    QVector<fb::Polyline> polylines =
-        accessor().getAllPolylinesOfGlyph(glyph.unicode(),
-                                          &glyphSpacing);  // can throw
-    spacing = convertLength(height, glyphSpacing);
-    return polylines2paths(polylines, height);
-  } catch (const fb::Exception& e) {
-    qWarning().nospace() << "Failed to load stroke font glyph " << glyph << ".";
-    spacing = 0;
-    return QVector<Path>();
-  }
+  const Glyph g = getGlyph(glyph, height);
+  spacing = g.spacing;
+  return g.paths;
 }
 
 /*******************************************************************************
@@ -208,6 +196,48 @@ void StrokeFont::fontLoaded() noexcept {
   accessor();  // trigger the message about loading succeeded or failed
 }
 
+StrokeFont::Glyph StrokeFont::getGlyph(
+    const QChar& glyph, const PositiveLength& height) const noexcept {
+  // Texts typically consist of the same few glyphs with the same height
+  // (e.g. all reference designators on a board), so stroking each glyph only
+  // once saves a lot of time. Note that this method may be called from
+  // multiple threads concurrently (e.g. from exports running in the
+  // background), thus the cache needs to be protected.
+  const QPair<ushort, LengthBase_t> key(glyph.unicode(), height->toNm());
+  {
+    QReadLocker lock(&mGlyphCacheLock);
+    auto it = mGlyphCache.constFind(key);
+    if (it != mGlyphCache.constEnd()) {
+      return *it;
+    }
+  }
+
+  QWriteLocker lock(&mGlyphCacheLock);
+  auto it = mGlyphCache.constFind(key);  // Might have been added meanwhile.
+  if (it != mGlyphCache.constEnd()) {
+    return *it;
+  }
+  Glyph result;
+  try {
+    qreal glyphSpacing = 0;
+    QVector<fb::Polyline> polylines =
+        accessor().getAllPolylinesOfGlyph(glyph.unicode(),
+                                          &glyphSpacing);  // can throw
+    result.spacing = convertLength(height, glyphSpacing);
+    result.paths = polylines2paths(polylines, height);
+    if (!result.paths.isEmpty()) {
+      computeBoundingRect(result.paths, result.bottomLeft, result.topRight);
+    }
+  } catch (const fb::Exception& e) {
+    qWarning().nospace() << "Failed to load stroke font glyph " << glyph << ".";
+  }
+  if (mGlyphCache.count() >= sMaxCachedGlyphs) {
+    mGlyphCache.clear();  // Avoid unlimited memory consumption.
+  }
+  mGlyphCache.insert(key, result);
+  return result;
+}
+
 const fb::GlyphListAccessor& StrokeFont::accessor() const noexcept {
   if (!mFont) {
     try {
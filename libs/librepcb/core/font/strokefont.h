@@ -83,8 +83,18 @@ public:
   // Operator Overloadings
   StrokeFont& operator=(const StrokeFont& rhs) = delete;
 
-private:
+private:  // Types
+  struct Glyph {
+    QVector<Path> paths;
+    Length spacing;
+    Point bottomLeft;
+    Point topRight;
+  };
+
+private:  // Methods
   void fontLoaded() noexcept;
+  Glyph getGlyph(const QChar& glyph,
+                 const PositiveLength& height) const noexcept;
   const fontobene::GlyphListAccessor& accessor() const noexcept;
   static QVector<Path> polylines2paths(
       const QVector<fontobene::Polyline>& polylines,
@@ -105,6 +115,11 @@ private:  // Data
   mutable std::shared_ptr<fontobene::Font> mFont;
   mutable QScopedPointer<fontobene::GlyphListCache> mGlyphListCache;
   mutable QScopedPointer<fontobene::GlyphListAccessor> mGlyphListAccessor;
+
+  /// Already stroked glyphs, key is the glyph and the height in nanometers
+  mutable QHash<QPair<ushort, LengthBase_t>, Glyph> mGlyphCache;
+  mutable QReadWriteLock mGlyphCacheLock;
+  static constexpr int sMaxCachedGlyphs = 10000;
 };
 
 /*******************************************************************************
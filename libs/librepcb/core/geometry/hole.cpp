@@ -131,6 +131,10 @@ bool Hole::setStopMaskConfig(const MaskConfig& config) noexcept {
  *  General Methods
  ******************************************************************************/
 
+qint64 Hole::getApproxMemoryUsage() const noexcept {
+  return sizeof(Hole) + mPath->getApproxMemoryUsage();
+}
+
 void Hole::serialize(SExpression& root) const {
   root.appendChild(mUuid);
   root.appendChild("diameter", mDiameter);
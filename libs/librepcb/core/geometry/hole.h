@@ -83,6 +83,7 @@ public:
   bool setStopMaskConfig(const MaskConfig& config) noexcept;
 
   // General Methods
+  qint64 getApproxMemoryUsage() const noexcept;
 
   /**
    * @brief Serialize into ::librepcb::SExpression node
@@ -23,14 +23,38 @@
 #include "padgeometry.h"
 
 #include "../utils/clipperhelpers.h"
+#include "../utils/memoryreport.h"
+#include "../utils/transform.h"
 
 #include <QtCore>
 
+#include <atomic>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
 namespace librepcb {
 
+/*******************************************************************************
+ *  Class ClipperCache
+ ******************************************************************************/
+
+struct PadGeometry::ClipperCache {
+  /// Position X, position Y, rotation, mirror, offset, arc tolerance
+  typedef std::tuple<LengthBase_t, LengthBase_t, qint32, bool, LengthBase_t,
+                     LengthBase_t>
+      Key;
+
+  /// Upper limit to avoid growing infinitely when pads are moved around
+  static const int sMaxEntries = 1000;
+
+  QMutex mutex;
+  QMap<Key, std::shared_ptr<const ClipperOutlines>> entries;
+};
+
+static std::atomic<quint64> sClipperCacheHits(0);
+static std::atomic<quint64> sClipperCacheMisses(0);
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
@@ -42,7 +66,8 @@ PadGeometry::PadGeometry(const PadGeometry& other) noexcept
     mRadius(other.mRadius),
     mPath(other.mPath),
     mOffset(other.mOffset),
-    mHoles(other.mHoles) {
+    mHoles(other.mHoles),
+    mClipperCache(other.mClipperCache) {
 }
 
 PadGeometry::PadGeometry(Shape shape, const Length& width, const Length& height,
@@ -55,7 +80,8 @@ PadGeometry::PadGeometry(Shape shape, const Length& width, const Length& height,
     mRadius(radius),
     mPath(path),
     mOffset(offset),
-    mHoles(holes) {
+    mHoles(holes),
+    mClipperCache(new ClipperCache()) {
 }
 
 PadGeometry::~PadGeometry() noexcept {
@@ -76,6 +102,24 @@ UnsignedLength PadGeometry::getCornerRadius() const noexcept {
  *  General Methods
  ******************************************************************************/
 
+qint64 PadGeometry::getApproxMemoryUsage() const noexcept {
+  qint64 bytes =
+      sizeof(PadGeometry) - sizeof(Path) + mPath.getApproxMemoryUsage();
+  for (const PadHole& hole : mHoles) {
+    bytes += sizeof(PadHole) + hole.getPath()->getApproxMemoryUsage() +
+        MemoryReport::getAllocationOverhead();
+  }
+  QMutexLocker lock(&mClipperCache->mutex);
+  foreach (const auto& outlines, mClipperCache->entries) {
+    bytes += sizeof(ClipperOutlines) + MemoryReport::getAllocationOverhead();
+    for (const ClipperLib::Path& path : outlines->paths) {
+      bytes += sizeof(ClipperLib::Path) +
+          path.capacity() * sizeof(ClipperLib::IntPoint);
+    }
+  }
+  return bytes;
+}
+
 QVector<Path> PadGeometry::toOutlines() const {
   const Length w = getWidth();
   const Length h = getHeight();
@@ -143,6 +187,55 @@ QVector<Path> PadGeometry::toOutlines() const {
   return result;
 }
 
+std::shared_ptr<const PadGeometry::ClipperOutlines>
+    PadGeometry::toClipperOutlines(
+        const Transform& transform, const Length& offset,
+        const PositiveLength& maxArcTolerance) const {
+  const ClipperCache::Key key(
+      transform.getPosition().getX().toNm(),
+      transform.getPosition().getY().toNm(),
+      transform.getRotation().toMicroDeg(), transform.getMirrored(),
+      offset.toNm(), maxArcTolerance->toNm());
+  {
+    QMutexLocker lock(&mClipperCache->mutex);
+    if (auto outlines = mClipperCache->entries.value(key)) {
+      ++sClipperCacheHits;
+      return outlines;
+    }
+  }
+
+  // Not cached yet, do the (expensive) conversion without holding the lock.
+  ++sClipperCacheMisses;
+  const PadGeometry geometry = (offset != 0) ? withOffset(offset) : *this;
+  std::shared_ptr<ClipperOutlines> outlines =
+      std::make_shared<ClipperOutlines>();
+  outlines->paths = ClipperHelpers::convert(
+      transform.map(geometry.toOutlines()), maxArcTolerance);  // can throw
+  outlines->boundingBox = ClipperLib::IntRect{0, 0, 0, 0};
+  bool first = true;
+  for (const ClipperLib::Path& path : outlines->paths) {
+    for (const ClipperLib::IntPoint& p : path) {
+      ClipperLib::IntRect& r = outlines->boundingBox;
+      if (first) {
+        r = ClipperLib::IntRect{p.X, p.Y, p.X, p.Y};
+        first = false;
+      } else {
+        r.left = std::min(r.left, p.X);
+        r.top = std::min(r.top, p.Y);
+        r.right = std::max(r.right, p.X);
+        r.bottom = std::max(r.bottom, p.Y);
+      }
+    }
+  }
+
+  QMutexLocker lock(&mClipperCache->mutex);
+  if (mClipperCache->entries.count() >= ClipperCache::sMaxEntries) {
+    mClipperCache->entries.clear();
+  }
+  mClipperCache->entries.insert(key, outlines);
+  return outlines;
+}
+
 QPainterPath PadGeometry::toQPainterPathPx() const noexcept {
   const QPainterPath area = toFilledQPainterPathPx();
   if (area.isEmpty()) {
@@ -229,6 +322,12 @@ bool PadGeometry::isValidCustomOutline(const Path& path) noexcept {
              path.toClosedPath(), maxArcTolerance()))) > 1;
 }
 
+PadGeometry::ClipperCacheStatistics
+    PadGeometry::getClipperCacheStatistics() noexcept {
+  return ClipperCacheStatistics{sClipperCacheHits.load(),
+                                sClipperCacheMisses.load()};
+}
+
 /*******************************************************************************
  *  Operator Overloadings
  ******************************************************************************/
@@ -252,6 +351,7 @@ PadGeometry& PadGeometry::operator=(const PadGeometry& rhs) noexcept {
   mPath = rhs.mPath;
   mOffset = rhs.mOffset;
   mHoles = rhs.mHoles;
+  mClipperCache = rhs.mClipperCache;
   return *this;
 }
 
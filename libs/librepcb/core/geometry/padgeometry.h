@@ -28,14 +28,19 @@
 #include "path.h"
 
 #include <optional/tl/optional.hpp>
+#include <polyclipping/clipper.hpp>
 
 #include <QtCore>
 
+#include <memory>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
 namespace librepcb {
 
+class Transform;
+
 /*******************************************************************************
  *  Class PadGeometry
  ******************************************************************************/
@@ -55,6 +60,18 @@ public:
     Custom,
   };
 
+  /// Flattened outlines as returned by #toClipperOutlines()
+  struct ClipperOutlines {
+    ClipperLib::Paths paths;
+    ClipperLib::IntRect boundingBox;  ///< All zero if there are no paths
+  };
+
+  /// Hit/miss counters of the cache used by #toClipperOutlines()
+  struct ClipperCacheStatistics {
+    quint64 hits;
+    quint64 misses;
+  };
+
   // Constructors / Destructor
   PadGeometry() = delete;
   PadGeometry(const PadGeometry& other) noexcept;
@@ -68,8 +85,38 @@ public:
   const Path& getPath() const noexcept { return mPath; }
   const PadHoleList& getHoles() const noexcept { return mHoles; }
 
+  /**
+   * @brief Get the approximate memory footprint of this geometry
+   *
+   * @note  The cache of #toClipperOutlines() is included, even though it is
+   *        shared with copies of this object.
+   *
+   * @return Number of bytes.
+   */
+  qint64 getApproxMemoryUsage() const noexcept;
+
   // General Methods
   QVector<Path> toOutlines() const;
+
+  /**
+   * @brief Get the outlines as flattened Clipper paths
+   *
+   * Equivalent to converting `transform.map(withOffset(offset).toOutlines())`
+   * with ::librepcb::ClipperHelpers::convert(), but the result is cached.
+   * The cache is shared between all copies of a geometry, so DRC, plane
+   * fragments builder etc. reuse the same conversion. This method is
+   * thread-safe.
+   *
+   * @param transform       Transformation to apply to the outlines.
+   * @param offset          Offset to apply to the outlines (see #withOffset()).
+   * @param maxArcTolerance Maximum tolerance when flattening arcs.
+   *
+   * @return Flattened outlines (never `nullptr`).
+   */
+  std::shared_ptr<const ClipperOutlines> toClipperOutlines(
+      const Transform& transform, const Length& offset,
+      const PositiveLength& maxArcTolerance) const;
+
   QPainterPath toQPainterPathPx() const noexcept;
   QPainterPath toFilledQPainterPathPx() const noexcept;
   QPainterPath toHolesQPainterPathPx() const noexcept;
@@ -90,6 +137,7 @@ public:
                             const PadHoleList& holes) noexcept;
   static PadGeometry custom(const Path& outline, const PadHoleList& holes);
   static bool isValidCustomOutline(const Path& path) noexcept;
+  static ClipperCacheStatistics getClipperCacheStatistics() noexcept;
 
   // Operator Overloadings
   bool operator==(const PadGeometry& rhs) const noexcept;
@@ -98,6 +146,9 @@ public:
   }
   PadGeometry& operator=(const PadGeometry& rhs) noexcept;
 
+private:  // Types
+  struct ClipperCache;
+
 private:  // Methods
   PadGeometry(Shape shape, const Length& width, const Length& height,
               const UnsignedLimitedRatio& radius, const Path& path,
@@ -120,6 +171,9 @@ private:  // Data
   Path mPath;
   Length mOffset;
   PadHoleList mHoles;
+
+  /// Cache for #toClipperOutlines(), shared between copies of this object
+  std::shared_ptr<ClipperCache> mClipperCache;
 };
 
 /*******************************************************************************
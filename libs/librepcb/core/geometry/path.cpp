@@ -23,6 +23,7 @@
 #include "path.h"
 
 #include "../serialization/sexpression.h"
+#include "../utils/memoryreport.h"
 #include "../utils/toolbox.h"
 
 #include <QtCore>
@@ -39,7 +40,7 @@ namespace librepcb {
  ******************************************************************************/
 
 Path::Path(const Path& other) noexcept
-  : mVertices(other.mVertices), mPainterPathPx(other.mPainterPathPx) {
+  : mVertices(other.mVertices) {
 }
 
 Path::Path(const SExpression& node) {
@@ -166,34 +167,36 @@ QVector<Path> Path::toOutlineStrokes(
   return paths;
 }
 
-const QPainterPath& Path::toQPainterPathPx() const noexcept {
-  if (mPainterPathPx.isEmpty()) {
-    for (int i = 0; i < mVertices.count(); ++i) {
-      const Vertex& v = mVertices.at(i);
-      if (i == 0) {
-        mPainterPathPx.moveTo(v.getPos().toPxQPointF());
-        continue;
-      }
-      const Vertex& v0 = mVertices.at(i - 1);
-      if (auto center =
-              Toolbox::arcCenter(v0.getPos(), v.getPos(), v0.getAngle())) {
-        // Arc segment.
-        const QPointF centerPx = center->toPxQPointF();
-        const QPointF diffPx = v0.getPos().toPxQPointF() - centerPx;
-        const qreal radiusPx =
-            std::sqrt(diffPx.x() * diffPx.x() + diffPx.y() * diffPx.y());
-        const qreal startAngleDeg =
-            -qRadiansToDegrees(std::atan2(diffPx.y(), diffPx.x()));
-        mPainterPathPx.arcTo(centerPx.x() - radiusPx, centerPx.y() - radiusPx,
-                             radiusPx * 2, radiusPx * 2, startAngleDeg,
-                             v0.getAngle().toDeg());
-      } else {
-        // Straight segment.
-        mPainterPathPx.lineTo(v.getPos().toPxQPointF());
-      }
+QPainterPath Path::toQPainterPathPx() const noexcept {
+  QPainterPath p;
+  for (int i = 0; i < mVertices.count(); ++i) {
+    const Vertex& v = mVertices.at(i);
+    if (i == 0) {
+      p.moveTo(v.getPos().toPxQPointF());
+      continue;
+    }
+    const Vertex& v0 = mVertices.at(i - 1);
+    if (auto center =
+            Toolbox::arcCenter(v0.getPos(), v.getPos(), v0.getAngle())) {
+      // Arc segment.
+      const QPointF centerPx = center->toPxQPointF();
+      const QPointF diffPx = v0.getPos().toPxQPointF() - centerPx;
+      const qreal radiusPx =
+          std::sqrt(diffPx.x() * diffPx.x() + diffPx.y() * diffPx.y());
+      const qreal startAngleDeg =
+          -qRadiansToDegrees(std::atan2(diffPx.y(), diffPx.x()));
+      p.arcTo(centerPx.x() - radiusPx, centerPx.y() - radiusPx, radiusPx * 2,
+              radiusPx * 2, startAngleDeg, v0.getAngle().toDeg());
+    } else {
+      // Straight segment.
+      p.lineTo(v.getPos().toPxQPointF());
     }
   }
-  return mPainterPathPx;
+  return p;
+}
+
+qint64 Path::getApproxMemoryUsage() const noexcept {
+  return sizeof(Path) + MemoryReport::estimate(mVertices);
 }
 
 /*******************************************************************************
@@ -204,7 +207,6 @@ Path& Path::translate(const Point& offset) noexcept {
   for (Vertex& vertex : mVertices) {
     vertex.setPos(vertex.getPos() + offset);
   }
-  invalidatePainterPath();
   return *this;
 }
 
@@ -216,7 +218,6 @@ Path& Path::mapToGrid(const PositiveLength& gridInterval) noexcept {
   for (Vertex& vertex : mVertices) {
     vertex.setPos(vertex.getPos().mappedToGrid(gridInterval));
   }
-  invalidatePainterPath();
   return *this;
 }
 
@@ -228,7 +229,6 @@ Path& Path::rotate(const Angle& angle, const Point& center) noexcept {
   for (Vertex& vertex : mVertices) {
     vertex.setPos(vertex.getPos().rotated(angle, center));
   }
-  invalidatePainterPath();
   return *this;
 }
 
@@ -241,7 +241,6 @@ Path& Path::mirror(Qt::Orientation orientation, const Point& center) noexcept {
     vertex.setPos(vertex.getPos().mirrored(orientation, center));
     vertex.setAngle(-vertex.getAngle());
   }
-  invalidatePainterPath();
   return *this;
 }
 
@@ -258,7 +257,6 @@ Path& Path::reverse() noexcept {
         Vertex(mVertices.at(i).getPos(), -mVertices.value(i - 1).getAngle()));
   }
   mVertices = vertices;
-  invalidatePainterPath();
   return *this;
 }
 
@@ -282,7 +280,6 @@ Path& Path::flattenArcs(const PositiveLength& maxTolerance) noexcept {
       }
     }
   }
-  invalidatePainterPath();
   return *this;
 }
 
@@ -296,7 +293,6 @@ Path Path::flattenedArcs(const PositiveLength& maxTolerance) const noexcept {
 
 void Path::addVertex(const Vertex& vertex) noexcept {
   mVertices.append(vertex);
-  invalidatePainterPath();
 }
 
 void Path::addVertex(const Point& pos, const Angle& angle) noexcept {
@@ -305,7 +301,6 @@ void Path::addVertex(const Point& pos, const Angle& angle) noexcept {
 
 void Path::insertVertex(int index, const Vertex& vertex) noexcept {
   mVertices.insert(index, vertex);
-  invalidatePainterPath();
 }
 
 void Path::insertVertex(int index, const Point& pos,
@@ -359,7 +354,6 @@ void Path::serialize(SExpression& root) const {
 
 Path& Path::operator=(const Path& rhs) noexcept {
   mVertices = rhs.mVertices;
-  mPainterPathPx = rhs.mPainterPathPx;
   return *this;
 }
 
@@ -584,6 +578,15 @@ QPainterPath Path::toQPainterPathPx(const QVector<Path>& paths,
   return p;
 }
 
+qint64 Path::getApproxMemoryUsage(const QVector<Path>& paths) noexcept {
+  // Note: sizeof(Path) is already included in the vector capacity.
+  qint64 bytes = MemoryReport::estimate(paths);
+  foreach (const Path& path, paths) {
+    bytes += path.getApproxMemoryUsage() - sizeof(Path);
+  }
+  return bytes;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
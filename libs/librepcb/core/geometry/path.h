@@ -60,7 +60,7 @@ class Path final {
 
 public:
   // Constructors / Destructor
-  Path() noexcept : mVertices(), mPainterPathPx() {}
+  Path() noexcept : mVertices() {}
   Path(const Path& other) noexcept;
   explicit Path(const QVector<Vertex>& vertices) noexcept
     : mVertices(vertices) {}
@@ -71,10 +71,7 @@ public:
   bool isClosed() const noexcept;
   bool isCurved() const noexcept;
   bool isZeroLength() const noexcept;
-  QVector<Vertex>& getVertices() noexcept {
-    invalidatePainterPath();
-    return mVertices;
-  }
+  QVector<Vertex>& getVertices() noexcept { return mVertices; }
   const QVector<Vertex>& getVertices() const noexcept { return mVertices; }
   UnsignedLength getTotalStraightLength() const noexcept;
   qreal calcAreaOfStraightSegments() const noexcept;
@@ -83,7 +80,8 @@ public:
   Path toClosedPath() const noexcept;
   Path toOpenPath() const noexcept;
   QVector<Path> toOutlineStrokes(const PositiveLength& width) const noexcept;
-  const QPainterPath& toQPainterPathPx() const noexcept;
+  QPainterPath toQPainterPathPx() const noexcept;
+  qint64 getApproxMemoryUsage() const noexcept;
 
   // Transformations
   Path& translate(const Point& offset) noexcept;
@@ -171,14 +169,16 @@ public:
   static QPainterPath toQPainterPathPx(const QVector<Path>& paths,
                                        bool area) noexcept;
 
-private:  // Methods
-  void invalidatePainterPath() const noexcept {
-    mPainterPathPx = QPainterPath();
-  }
+  /**
+   * @brief Get the approximate memory footprint of multiple paths
+   *
+   * @param paths   The paths (including the vector itself).
+   * @return        Number of bytes.
+   */
+  static qint64 getApproxMemoryUsage(const QVector<Path>& paths) noexcept;
 
 private:  // Data
   QVector<Vertex> mVertices;
-  mutable QPainterPath mPainterPathPx;  // cached path for #toQPainterPathPx()
 };
 
 /*******************************************************************************
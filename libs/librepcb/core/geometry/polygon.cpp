@@ -145,6 +145,10 @@ bool Polygon::setPath(const Path& path) noexcept {
  *  General Methods
  ******************************************************************************/
 
+qint64 Polygon::getApproxMemoryUsage() const noexcept {
+  return sizeof(Polygon) - sizeof(Path) + mPath.getApproxMemoryUsage();
+}
+
 void Polygon::serialize(SExpression& root) const {
   root.appendChild(mUuid);
   root.appendChild("layer", *mLayer);
@@ -84,6 +84,7 @@ public:
   bool setPath(const Path& path) noexcept;
 
   // General Methods
+  qint64 getApproxMemoryUsage() const noexcept;
 
   /**
    * @brief Serialize into ::librepcb::SExpression node
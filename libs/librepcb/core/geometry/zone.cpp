@@ -114,6 +114,10 @@ bool Zone::setOutline(const Path& outline) noexcept {
  *  General Methods
  ******************************************************************************/
 
+qint64 Zone::getApproxMemoryUsage() const noexcept {
+  return sizeof(Zone) - sizeof(Path) + mOutline.getApproxMemoryUsage();
+}
+
 void Zone::serialize(SExpression& root) const {
   root.appendChild(mUuid);
   root.ensureLineBreak();
@@ -91,6 +91,7 @@ public:
   bool setOutline(const Path& outline) noexcept;
 
   // General Methods
+  qint64 getApproxMemoryUsage() const noexcept;
 
   /**
    * @brief Serialize into ::librepcb::SExpression node
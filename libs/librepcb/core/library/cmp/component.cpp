@@ -23,6 +23,7 @@
 #include "component.h"
 
 #include "../../serialization/fileformatmigration.h"
+#include "../../utils/memoryreport.h"
 #include "componentcheck.h"
 
 #include <QtCore>
@@ -125,6 +126,20 @@ RuleCheckMessageList Component::runChecks() const {
   return check.runChecks();  // can throw
 }
 
+qint64 Component::getApproxMemoryUsage() const noexcept {
+  const qint64 overhead = MemoryReport::getAllocationOverhead();
+  qint64 bytes = LibraryElement::getApproxMemoryUsage() + sizeof(Component) -
+      sizeof(LibraryElement) + MemoryReport::estimate(mDefaultValue);
+  bytes += mAttributes.count() * (sizeof(Attribute) + overhead);
+  bytes += mSignals.count() * (sizeof(ComponentSignal) + overhead);
+  for (const ComponentSymbolVariant& variant : mSymbolVariants) {
+    bytes += sizeof(ComponentSymbolVariant) + overhead +
+        variant.getSymbolItems().count() *
+            (sizeof(ComponentSymbolVariantItem) + overhead);
+  }
+  return bytes;
+}
+
 std::unique_ptr<Component> Component::open(
     std::unique_ptr<TransactionalDirectory> directory,
     bool abortBeforeMigration) {
@@ -131,6 +131,7 @@ public:
 
   // General Methods
   virtual RuleCheckMessageList runChecks() const override;
+  virtual qint64 getApproxMemoryUsage() const noexcept override;
 
   // Operator Overloadings
   Component& operator=(const Component& rhs) = delete;
@@ -23,6 +23,7 @@
 #include "device.h"
 
 #include "../../serialization/fileformatmigration.h"
+#include "../../utils/memoryreport.h"
 #include "devicecheck.h"
 
 #include <QtCore>
@@ -88,6 +89,19 @@ RuleCheckMessageList Device::runChecks() const {
   return check.runChecks();  // can throw
 }
 
+qint64 Device::getApproxMemoryUsage() const noexcept {
+  const qint64 overhead = MemoryReport::getAllocationOverhead();
+  qint64 bytes = LibraryElement::getApproxMemoryUsage() + sizeof(Device) -
+      sizeof(LibraryElement);
+  bytes += mPadSignalMap.count() * (sizeof(DevicePadSignalMapItem) + overhead);
+  bytes += mAttributes.count() * (sizeof(Attribute) + overhead);
+  for (const Part& part : mParts) {
+    bytes += sizeof(Part) + overhead +
+        part.getAttributes().count() * (sizeof(Attribute) + overhead);
+  }
+  return bytes;
+}
+
 std::unique_ptr<Device> Device::open(
     std::unique_ptr<TransactionalDirectory> directory,
     bool abortBeforeMigration) {
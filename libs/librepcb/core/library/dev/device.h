@@ -83,6 +83,7 @@ public:
 
   // General Methods
   virtual RuleCheckMessageList runChecks() const override;
+  virtual qint64 getApproxMemoryUsage() const noexcept override;
 
   // Operator Overloadings
   Device& operator=(const Device& rhs) = delete;
@@ -25,6 +25,7 @@
 #include "../application.h"
 #include "../fileio/versionfile.h"
 #include "../serialization/sexpression.h"
+#include "../utils/memoryreport.h"
 #include "../utils/toolbox.h"
 #include "librarybaseelementcheck.h"
 
@@ -80,7 +81,7 @@ LibraryBaseElement::LibraryBaseElement(
     mMessageApprovals() {
   // Load message approvals.
   foreach (const SExpression* child, root.getChildren("approved")) {
-    mMessageApprovals.insert(*child);
+    mMessageApprovals.insert(RuleCheckApproval(*child));
   }
 
   // Check directory name.
@@ -119,6 +120,23 @@ RuleCheckMessageList LibraryBaseElement::runChecks() const {
   return check.runChecks();  // can throw
 }
 
+qint64 LibraryBaseElement::getApproxMemoryUsage() const noexcept {
+  qint64 bytes = sizeof(LibraryBaseElement) + MemoryReport::estimate(mAuthor);
+  foreach (const QString& locale, mNames.keys()) {
+    bytes += MemoryReport::estimate(*mNames.value({locale}));
+  }
+  foreach (const QString& locale, mDescriptions.keys()) {
+    bytes += MemoryReport::estimate(mDescriptions.value({locale}));
+  }
+  foreach (const QString& locale, mKeywords.keys()) {
+    bytes += MemoryReport::estimate(mKeywords.value({locale}));
+  }
+  foreach (const RuleCheckApproval& approval, mMessageApprovals) {
+    bytes += approval.getNode().getApproxMemoryUsage();
+  }
+  return bytes;
+}
+
 void LibraryBaseElement::save() {
   // Content.
   std::unique_ptr<SExpression> root =
@@ -172,9 +190,10 @@ void LibraryBaseElement::serialize(SExpression& root) const {
 }
 
 void LibraryBaseElement::serializeMessageApprovals(SExpression& root) const {
-  foreach (const SExpression& node, Toolbox::sortedQSet(mMessageApprovals)) {
+  foreach (const RuleCheckApproval& approval,
+           Toolbox::sortedQSet(mMessageApprovals)) {
     root.ensureLineBreak();
-    root.appendChild(node);
+    root.appendChild(approval.getNode());
   }
   root.ensureLineBreak();
 }
@@ -82,7 +82,7 @@ public:
   }
   const LocalizedKeywordsMap& getKeywords() const noexcept { return mKeywords; }
   QStringList getAllAvailableLocales() const noexcept;
-  const QSet<SExpression>& getMessageApprovals() const noexcept {
+  const QSet<RuleCheckApproval>& getMessageApprovals() const noexcept {
     return mMessageApprovals;
   }
 
@@ -97,12 +97,20 @@ public:
   void setKeywords(const LocalizedKeywordsMap& keywords) noexcept {
     mKeywords = keywords;
   }
-  void setMessageApprovals(const QSet<SExpression>& approvals) noexcept {
+  void setMessageApprovals(const QSet<RuleCheckApproval>& approvals) noexcept {
     mMessageApprovals = approvals;
   }
 
   // General Methods
   virtual RuleCheckMessageList runChecks() const;
+
+  /**
+   * @brief Get the approximate memory footprint of this element
+   *
+   * @return Number of bytes, including all the content of the element.
+   */
+  virtual qint64 getApproxMemoryUsage() const noexcept;
+
   virtual void save();
   virtual void saveTo(TransactionalDirectory& dest);
   virtual void moveTo(TransactionalDirectory& dest);
@@ -157,7 +165,7 @@ protected:  // Data
   LocalizedKeywordsMap mKeywords;
 
   // Library element check
-  QSet<SExpression> mMessageApprovals;
+  QSet<RuleCheckApproval> mMessageApprovals;
 };
 
 /*******************************************************************************
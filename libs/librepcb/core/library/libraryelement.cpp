@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "libraryelement.h"
 
+#include "../utils/memoryreport.h"
 #include "../utils/toolbox.h"
 #include "libraryelementcheck.h"
 
@@ -74,6 +75,18 @@ RuleCheckMessageList LibraryElement::runChecks() const {
   return check.runChecks();  // can throw
 }
 
+qint64 LibraryElement::getApproxMemoryUsage() const noexcept {
+  qint64 bytes = LibraryBaseElement::getApproxMemoryUsage() +
+      sizeof(LibraryElement) - sizeof(LibraryBaseElement) +
+      MemoryReport::estimate(mGeneratedBy) +
+      mCategories.count() * static_cast<qint64>(sizeof(Uuid));
+  for (const Resource& resource : mResources) {
+    bytes += sizeof(Resource) + MemoryReport::getAllocationOverhead() +
+        MemoryReport::estimate(resource.getUrl().toString());
+  }
+  return bytes;
+}
+
 /*******************************************************************************
  *  Protected Methods
  ******************************************************************************/
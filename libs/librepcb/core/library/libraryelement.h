@@ -75,6 +75,7 @@ public:
 
   // General Methods
   virtual RuleCheckMessageList runChecks() const override;
+  virtual qint64 getApproxMemoryUsage() const noexcept override;
 
   // Operator Overloadings
   LibraryElement& operator=(const LibraryElement& rhs) = delete;
@@ -0,0 +1,184 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "librarymanifest.h"
+
+#include "../exceptions.h"
+#include "../fileio/fileutils.h"
+#include "../fileio/filepath.h"
+#include "cat/componentcategory.h"
+#include "cat/packagecategory.h"
+#include "cmp/component.h"
+#include "dev/device.h"
+#include "pkg/package.h"
+#include "sym/symbol.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+LibraryManifest::LibraryManifest() noexcept : mFiles() {
+}
+
+LibraryManifest::LibraryManifest(const LibraryManifest& other) noexcept
+  : mFiles(other.mFiles) {
+}
+
+LibraryManifest::LibraryManifest(
+    const QHash<QString, QByteArray>& files) noexcept
+  : mFiles(files) {
+}
+
+LibraryManifest::~LibraryManifest() noexcept {
+}
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+QStringList LibraryManifest::getFilesOfItems(
+    const QSet<QString>& items) const noexcept {
+  QStringList files;
+  for (auto it = mFiles.begin(); it != mFiles.end(); ++it) {
+    if (items.contains(getItemOfFile(it.key()))) {
+      files.append(it.key());
+    }
+  }
+  files.sort();
+  return files;
+}
+
+QSet<QString> LibraryManifest::getModifiedItems(
+    const LibraryManifest& other) const noexcept {
+  QSet<QString> items;
+  for (auto it = mFiles.begin(); it != mFiles.end(); ++it) {
+    auto otherIt = other.mFiles.find(it.key());
+    if ((otherIt == other.mFiles.end()) || (*otherIt != *it)) {
+      items.insert(getItemOfFile(it.key()));  // Added or modified.
+    }
+  }
+  for (auto it = other.mFiles.begin(); it != other.mFiles.end(); ++it) {
+    if (!mFiles.contains(it.key())) {
+      items.insert(getItemOfFile(it.key()));  // Removed.
+    }
+  }
+  return items;
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+QByteArray LibraryManifest::serialize() const noexcept {
+  QStringList paths = mFiles.keys();
+  paths.sort();
+  QByteArray content;
+  foreach (const QString& path, paths) {
+    content += mFiles.value(path).toHex() + "  " + path.toUtf8() + "\n";
+  }
+  return content;
+}
+
+/*******************************************************************************
+ *  Operator Overloadings
+ ******************************************************************************/
+
+LibraryManifest& LibraryManifest::operator=(
+    const LibraryManifest& rhs) noexcept {
+  mFiles = rhs.mFiles;
+  return *this;
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+LibraryManifest LibraryManifest::parse(const QByteArray& content) {
+  static const QRegularExpression re("\\A([0-9a-fA-F]{64}) [ *](.+)\\z");
+
+  QHash<QString, QByteArray> files;
+  int lineNumber = 0;
+  foreach (const QByteArray& line, content.split('\n')) {
+    ++lineNumber;
+    const QString str = QString::fromUtf8(line).trimmed();
+    if (str.isEmpty()) {
+      continue;
+    }
+    const QRegularExpressionMatch match = re.match(str);
+    const QString path = match.hasMatch()
+        ? QDir::cleanPath(match.captured(2).trimmed())
+        : QString();
+    if (path.isEmpty() || QDir::isAbsolutePath(path) || (path == ".") ||
+        (path == "..") || path.startsWith("../") || files.contains(path)) {
+      throw RuntimeError(
+          __FILE__, __LINE__,
+          QString("Invalid library manifest entry in line %1: '%2'")
+              .arg(lineNumber)
+              .arg(str));
+    }
+    files.insert(path, QByteArray::fromHex(match.captured(1).toLatin1()));
+  }
+  return LibraryManifest(files);
+}
+
+LibraryManifest LibraryManifest::fromDirectory(const FilePath& dir) {
+  QHash<QString, QByteArray> files;
+  if (dir.isExistingDir()) {
+    foreach (const FilePath& fp,
+             FileUtils::getFilesInDirectory(dir, {}, true)) {  // can throw
+      files.insert(fp.toRelative(dir),
+                   QCryptographicHash::hash(FileUtils::readFile(fp),
+                                            QCryptographicHash::Sha256));
+    }
+  }
+  return LibraryManifest(files);
+}
+
+QString LibraryManifest::getItemOfFile(const QString& filePath) noexcept {
+  static const QSet<QString> elementDirs = {
+      ComponentCategory::getShortElementName(),
+      PackageCategory::getShortElementName(),
+      Symbol::getShortElementName(),
+      Package::getShortElementName(),
+      Component::getShortElementName(),
+      Device::getShortElementName(),
+  };
+  const QStringList segments = filePath.split('/');
+  if ((segments.count() >= 3) && elementDirs.contains(segments.first())) {
+    return segments.at(0) % "/" % segments.at(1);
+  } else {
+    return filePath;
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,155 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_LIBRARYMANIFEST_H
+#define LIBREPCB_CORE_LIBRARYMANIFEST_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class FilePath;
+
+/*******************************************************************************
+ *  Class LibraryManifest
+ ******************************************************************************/
+
+/**
+ * @brief List of all files of a library together with their SHA-256 hashes
+ *
+ * A library server may publish such a manifest next to the library ZIP file.
+ * By comparing it with the manifest of an already installed copy of the
+ * library, clients can download only the modified files instead of the whole
+ * library.
+ *
+ * The file format is the one of `sha256sum`, with paths relative to the
+ * library root directory (e.g. generated by `find . -type f | sort | xargs
+ * sha256sum`):
+ *
+ * @code
+ * 9f86d081884c7d659a2feaa0c55ad015a3bf4f1b2b0b822cd15d6c15b0f00a08  library.lp
+ * 60303ae22b998861bce3b28f33eec1be758a213c86c93c076dbe9f558c11c752  sym/...
+ * @endcode
+ *
+ * For the comparison, files are grouped into "items": All files within a
+ * library element directory (e.g. `sym/<uuid>/`) form one item named like
+ * the directory, since an element must always be updated as a whole. Every
+ * other file is an item on its own.
+ */
+class LibraryManifest final {
+public:
+  // Constructors / Destructor
+  LibraryManifest() noexcept;
+  LibraryManifest(const LibraryManifest& other) noexcept;
+  explicit LibraryManifest(const QHash<QString, QByteArray>& files) noexcept;
+  ~LibraryManifest() noexcept;
+
+  // Getters
+
+  /**
+   * @brief Get all files
+   *
+   * @return Relative file paths and their (binary) SHA-256 hashes.
+   */
+  const QHash<QString, QByteArray>& getFiles() const noexcept {
+    return mFiles;
+  }
+
+  /**
+   * @brief Get all files belonging to the given items
+   *
+   * @param items   Items as returned by #getModifiedItems().
+   *
+   * @return Relative file paths, sorted.
+   */
+  QStringList getFilesOfItems(const QSet<QString>& items) const noexcept;
+
+  /**
+   * @brief Get all items which differ from another manifest
+   *
+   * @param other   The manifest to compare with (e.g. of the local library).
+   *
+   * @return All items which have any file added, removed or modified.
+   */
+  QSet<QString> getModifiedItems(const LibraryManifest& other) const noexcept;
+
+  // General Methods
+  QByteArray serialize() const noexcept;
+
+  // Operator Overloadings
+  bool operator==(const LibraryManifest& rhs) const noexcept {
+    return mFiles == rhs.mFiles;
+  }
+  bool operator!=(const LibraryManifest& rhs) const noexcept {
+    return mFiles != rhs.mFiles;
+  }
+  LibraryManifest& operator=(const LibraryManifest& rhs) noexcept;
+
+  // Static Methods
+
+  /**
+   * @brief Parse a manifest file
+   *
+   * @param content   File content in `sha256sum` format.
+   *
+   * @return The parsed manifest.
+   *
+   * @throw Exception if the content is invalid, e.g. if it contains paths
+   *        pointing outside of the library directory.
+   */
+  static LibraryManifest parse(const QByteArray& content);
+
+  /**
+   * @brief Create the manifest of a library directory on the file system
+   *
+   * @param dir   The library directory (may or may not exist).
+   *
+   * @return The manifest of all files (including hidden files) within `dir`.
+   *
+   * @throw Exception if a file could not be read.
+   */
+  static LibraryManifest fromDirectory(const FilePath& dir);
+
+  /**
+   * @brief Determine the item a file belongs to
+   *
+   * @param filePath  Relative file path within the library.
+   *
+   * @return The element directory (e.g. `sym/<uuid>`) if the file is located
+   *         within a library element, or `filePath` otherwise.
+   */
+  static QString getItemOfFile(const QString& filePath) noexcept;
+
+private:  // Data
+  QHash<QString, QByteArray> mFiles;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "footprint.h"
 
+#include "../../utils/memoryreport.h"
 #include "package.h"
 
 #include <QtCore>
@@ -176,6 +177,38 @@ bool Footprint::setModels(const QSet<Uuid>& models) noexcept {
  *  General Methods
  ******************************************************************************/
 
+qint64 Footprint::getApproxMemoryUsage() const noexcept {
+  const qint64 overhead = MemoryReport::getAllocationOverhead();
+  qint64 bytes = sizeof(Footprint) +
+      mModels.count() * static_cast<qint64>(sizeof(Uuid));
+  foreach (const QString& locale, mNames.keys()) {
+    bytes += MemoryReport::estimate(*mNames.value({locale}));
+  }
+  foreach (const QString& locale, mDescriptions.keys()) {
+    bytes += MemoryReport::estimate(mDescriptions.value({locale}));
+  }
+  for (const FootprintPad& pad : mPads) {
+    bytes += sizeof(FootprintPad) + overhead - sizeof(Path) +
+        pad.getCustomShapeOutline().getApproxMemoryUsage();
+    for (const PadHole& hole : pad.getHoles()) {
+      bytes += sizeof(PadHole) + overhead +
+          hole.getPath()->getApproxMemoryUsage();
+    }
+  }
+  for (const Polygon& polygon : mPolygons) {
+    bytes += polygon.getApproxMemoryUsage() + overhead;
+  }
+  bytes += mCircles.count() * (sizeof(Circle) + overhead);
+  bytes += mStrokeTexts.count() * (sizeof(StrokeText) + overhead);
+  for (const Zone& zone : mZones) {
+    bytes += zone.getApproxMemoryUsage() + overhead;
+  }
+  for (const Hole& hole : mHoles) {
+    bytes += hole.getApproxMemoryUsage() + overhead;
+  }
+  return bytes;
+}
+
 void Footprint::serialize(SExpression& root) const {
   root.appendChild(mUuid);
   root.ensureLineBreak();
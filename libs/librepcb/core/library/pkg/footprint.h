@@ -114,6 +114,7 @@ public:
   bool setModels(const QSet<Uuid>& models) noexcept;
 
   // General Methods
+  qint64 getApproxMemoryUsage() const noexcept;
 
   /**
    * @brief Serialize into ::librepcb::SExpression node
@@ -23,6 +23,7 @@
 #include "package.h"
 
 #include "../../serialization/fileformatmigration.h"
+#include "../../utils/memoryreport.h"
 #include "packagecheck.h"
 
 #include <QtCore>
@@ -177,6 +178,19 @@ RuleCheckMessageList Package::runChecks() const {
   return check.runChecks();  // can throw
 }
 
+qint64 Package::getApproxMemoryUsage() const noexcept {
+  const qint64 overhead = MemoryReport::getAllocationOverhead();
+  qint64 bytes = LibraryElement::getApproxMemoryUsage() + sizeof(Package) -
+      sizeof(LibraryElement);
+  bytes += mAlternativeNames.count() * sizeof(AlternativeName);
+  bytes += mPads.count() * (sizeof(PackagePad) + overhead);
+  bytes += mModels.count() * (sizeof(PackageModel) + overhead);
+  for (const Footprint& footprint : mFootprints) {
+    bytes += footprint.getApproxMemoryUsage() + overhead;
+  }
+  return bytes;
+}
+
 std::unique_ptr<Package> Package::open(
     std::unique_ptr<TransactionalDirectory> directory,
     bool abortBeforeMigration) {
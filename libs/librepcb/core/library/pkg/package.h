@@ -112,6 +112,7 @@ public:
 
   // General Methods
   virtual RuleCheckMessageList runChecks() const override;
+  virtual qint64 getApproxMemoryUsage() const noexcept override;
 
   // Operator Overloadings
   Package& operator=(const Package& rhs) = delete;
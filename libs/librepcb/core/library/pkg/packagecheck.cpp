@@ -30,6 +30,9 @@
 
 #include <QtCore>
 
+#include <algorithm>
+#include <numeric>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -51,6 +54,11 @@ PackageCheck::~PackageCheck() noexcept {
  ******************************************************************************/
 
 RuleCheckMessageList PackageCheck::runChecks() const {
+  // The package might have been modified since the last run, and footprints
+  // might even be reallocated at the same address, so don't reuse any pad
+  // geometries of a previous run.
+  mPadGeometries.clear();
+
   RuleCheckMessageList msgs = LibraryElementCheck::runChecks();
   checkAssemblyType(msgs);
   checkDuplicatePadNames(msgs);
@@ -326,61 +334,61 @@ void PackageCheck::checkPadsClearanceToPads(MsgList& msgs) const {
   for (auto itFtp = mPackage.getFootprints().begin();
        itFtp != mPackage.getFootprints().end(); ++itFtp) {
     std::shared_ptr<const Footprint> footprint = itFtp.ptr();
+    const QVector<PadGeometry>& pads = getPadGeometries(*footprint);
+
+    // The exact intersection tests are expensive, so only compare pads where
+    // the bounding rects of their clearance areas overlap.
+    QVector<Length> padClearances;
+    QVector<QRectF> clearanceBounds;
+    for (const PadGeometry& pad : pads) {
+      padClearances.append(
+          std::max(clearance, *pad.pad->getCopperClearance()) - tolerance);
+      const qreal offset = padClearances.last().toPx();
+      clearanceBounds.append(
+          pad.boundsPx.adjusted(-offset, -offset, offset, offset));
+    }
+    QVector<QPainterPath> clearancePaths(pads.count());  // Built on demand.
+    auto getClearancePx = [&](int index) -> const QPainterPath& {
+      if (clearancePaths.at(index).isEmpty()) {
+        const FootprintPad& pad = *pads.at(index).pad;
+        const Transform transform(pad.getPosition(), pad.getRotation());
+        clearancePaths[index] =
+            transform.mapPx(pad.getGeometry()
+                                .withOffset(padClearances.at(index))
+                                .toFilledQPainterPathPx());
+      }
+      return clearancePaths.at(index);
+    };
 
-    // Check all pads.
-    for (auto itPad1 = (*itFtp).getPads().begin();
-         itPad1 != (*itFtp).getPads().end(); ++itPad1) {
-      std::shared_ptr<const FootprintPad> pad1 = itPad1.ptr();
-      std::shared_ptr<const PackagePad> pkgPad1 = pad1->getPackagePadUuid()
-          ? mPackage.getPads().find(*pad1->getPackagePadUuid())
-          : nullptr;
-      const Transform pad1Transform(pad1->getPosition(), pad1->getRotation());
-      const Length pad1Clearance =
-          std::max(clearance, *pad1->getCopperClearance()) - tolerance;
-      const QPainterPath pad1CopperPx =
-          pad1Transform.mapPx(pad1->getGeometry().toFilledQPainterPathPx());
-      const QPainterPath pad1ClearancePx =
-          pad1Transform.mapPx(pad1->getGeometry()
-                                  .withOffset(pad1Clearance)
-                                  .toFilledQPainterPathPx());
-
-      // Compare with all pads *after* pad1 to avoid duplicate messages!
-      // So, don't initialize the iterator with begin() but with pad1 + 1.
-      auto itPad2 = itPad1;
-      for (++itPad2; itPad2 != (*itFtp).getPads().end(); ++itPad2) {
-        std::shared_ptr<const FootprintPad> pad2 = itPad2.ptr();
-        std::shared_ptr<const PackagePad> pkgPad2 = pad2->getPackagePadUuid()
-            ? mPackage.getPads().find(*pad2->getPackagePadUuid())
-            : nullptr;
-        const Transform pad2Transform(pad2->getPosition(), pad2->getRotation());
-        const Length pad2Clearance =
-            std::max(clearance, *pad2->getCopperClearance()) - tolerance;
-        const QPainterPath pad2CopperPx =
-            pad2Transform.mapPx(pad2->getGeometry().toFilledQPainterPathPx());
-        const QPainterPath pad2ClearancePx =
-            pad2Transform.mapPx(pad2->getGeometry()
-                                    .withOffset(pad2Clearance)
-                                    .toFilledQPainterPathPx());
-
-        // Only warn if both pads have copper on the same board side.
-        if ((pad1->getComponentSide() == pad2->getComponentSide()) ||
-            (pad1->isTht()) || (pad2->isTht())) {
-          // Only warn if both pads have different net signal, or one of them
-          // is unconnected (an unconnected pad is considered as a different
-          // net signal).
-          if ((pad1->getPackagePadUuid() != pad2->getPackagePadUuid()) ||
-              (!pad1->getPackagePadUuid()) || (!pad2->getPackagePadUuid())) {
-            // Now check if the clearance is really too small.
-            if (pad1CopperPx.intersects(pad2CopperPx)) {
-              msgs.append(std::make_shared<MsgOverlappingPads>(
-                  footprint, pad1, pkgPad1 ? *pkgPad1->getName() : QString(),
-                  pad2, pkgPad2 ? *pkgPad2->getName() : QString()));
-            } else if (pad1ClearancePx.intersects(pad2CopperPx) ||
-                       pad1CopperPx.intersects(pad2ClearancePx)) {
-              msgs.append(std::make_shared<MsgPadClearanceViolation>(
-                  footprint, pad1, pkgPad1 ? *pkgPad1->getName() : QString(),
-                  pad2, pkgPad2 ? *pkgPad2->getName() : QString(), clearance));
-            }
+    // Each pair is reported only once, and the pairs are sorted by pad index
+    // to get a deterministic order of messages.
+    for (const auto& pair : findOverlappingRects(clearanceBounds)) {
+      const PadGeometry& geo1 = pads.at(pair.first);
+      const PadGeometry& geo2 = pads.at(pair.second);
+      const FootprintPad& pad1 = *geo1.pad;
+      const FootprintPad& pad2 = *geo2.pad;
+
+      // Only warn if both pads have copper on the same board side.
+      if ((pad1.getComponentSide() == pad2.getComponentSide()) ||
+          (pad1.isTht()) || (pad2.isTht())) {
+        // Only warn if both pads have different net signal, or one of them
+        // is unconnected (an unconnected pad is considered as a different
+        // net signal).
+        if ((pad1.getPackagePadUuid() != pad2.getPackagePadUuid()) ||
+            (!pad1.getPackagePadUuid()) || (!pad2.getPackagePadUuid())) {
+          // Now check if the clearance is really too small.
+          if (geo1.copperPx.intersects(geo2.copperPx)) {
+            msgs.append(std::make_shared<MsgOverlappingPads>(
+                footprint, geo1.pad,
+                geo1.pkgPad ? *geo1.pkgPad->getName() : QString(), geo2.pad,
+                geo2.pkgPad ? *geo2.pkgPad->getName() : QString()));
+          } else if (getClearancePx(pair.first).intersects(geo2.copperPx) ||
+                     geo1.copperPx.intersects(getClearancePx(pair.second))) {
+            msgs.append(std::make_shared<MsgPadClearanceViolation>(
+                footprint, geo1.pad,
+                geo1.pkgPad ? *geo1.pkgPad->getName() : QString(), geo2.pad,
+                geo2.pkgPad ? *geo2.pkgPad->getName() : QString(),
+                clearance));
           }
         }
       }
@@ -389,13 +397,28 @@ void PackageCheck::checkPadsClearanceToPads(MsgList& msgs) const {
 }
 
 void PackageCheck::checkPadsClearanceToLegend(MsgList& msgs) const {
+  const Length clearance(150000);  // 150 µm
+  const Length tolerance(10);  // 0.01 µm, to avoid rounding issues
+  const qreal offset = (clearance - tolerance).toPx();
+
   for (auto itFtp = mPackage.getFootprints().begin();
        itFtp != mPackage.getFootprints().end(); ++itFtp) {
     std::shared_ptr<const Footprint> footprint = itFtp.ptr();
+    const QVector<PadGeometry>& pads = getPadGeometries(*footprint);
 
-    QPainterPath topLegend;
-    QPainterPath botLegend;
+    // Bounding rects of all pad stop masks, followed by the bounding rects
+    // of all legend areas to find the nearby legend areas of each pad.
+    QVector<QRectF> rects;
+    for (const PadGeometry& pad : pads) {
+      rects.append(pad.boundsPx.adjusted(-offset, -offset, offset, offset));
+    }
+    QVector<QPainterPath> legendAreas;
+    QVector<bool> legendAreasOnTop;
     for (const Polygon& polygon : footprint->getPolygons()) {
+      const bool top = (polygon.getLayer() == Layer::topLegend());
+      if ((!top) && (polygon.getLayer() != Layer::botLegend())) {
+        continue;
+      }
       QPen pen(Qt::NoPen);
       if (polygon.getLineWidth() > 0) {
         pen.setStyle(Qt::SolidLine);
@@ -405,37 +428,46 @@ void PackageCheck::checkPadsClearanceToLegend(MsgList& msgs) const {
       if (polygon.isFilled() && polygon.getPath().isClosed()) {
         brush.setStyle(Qt::SolidPattern);
       }
-      QPainterPath area = Toolbox::shapeFromPath(
-          polygon.getPath().toQPainterPathPx(), pen, brush);
-      if (polygon.getLayer() == Layer::topLegend()) {
-        topLegend.addPath(area);
-      } else if (polygon.getLayer() == Layer::botLegend()) {
-        botLegend.addPath(area);
+      legendAreas.append(Toolbox::shapeFromPath(
+          polygon.getPath().toQPainterPathPx(), pen, brush));
+      legendAreasOnTop.append(top);
+      rects.append(legendAreas.last().boundingRect());
+    }
+    QVector<QVector<int>> nearbyLegendAreas(pads.count());
+    for (const auto& pair : findOverlappingRects(rects)) {
+      if ((pair.first < pads.count()) && (pair.second >= pads.count())) {
+        nearbyLegendAreas[pair.first].append(pair.second - pads.count());
       }
     }
 
-    for (auto it = (*itFtp).getPads().begin(); it != (*itFtp).getPads().end();
-         ++it) {
-      std::shared_ptr<const FootprintPad> pad = it.ptr();
-      std::shared_ptr<const PackagePad> pkgPad = pad->getPackagePadUuid()
-          ? mPackage.getPads().find(*pad->getPackagePadUuid())
-          : nullptr;
-      Length clearance(150000);  // 150 µm
-      Length tolerance(10);  // 0.01 µm, to avoid rounding issues
-      const Transform transform(pad->getPosition(), pad->getRotation());
+    for (int i = 0; i < pads.count(); ++i) {
+      if (nearbyLegendAreas.at(i).isEmpty()) {
+        continue;
+      }
+      QPainterPath topLegend;
+      QPainterPath botLegend;
+      for (int area : nearbyLegendAreas.at(i)) {
+        if (legendAreasOnTop.at(area)) {
+          topLegend.addPath(legendAreas.at(area));
+        } else {
+          botLegend.addPath(legendAreas.at(area));
+        }
+      }
+      const PadGeometry& geo = pads.at(i);
+      const Transform transform(geo.pad->getPosition(), geo.pad->getRotation());
       const QPainterPath stopMask =
-          transform.mapPx(pad->getGeometry()
+          transform.mapPx(geo.pad->getGeometry()
                               .withOffset(clearance - tolerance)
                               .toFilledQPainterPathPx());
-      if (pad->isOnLayer(Layer::topCopper()) &&
+      if (geo.pad->isOnLayer(Layer::topCopper()) &&
           stopMask.intersects(topLegend)) {
         msgs.append(std::make_shared<MsgPadOverlapsWithLegend>(
-            footprint, pad, pkgPad ? *pkgPad->getName() : QString(),
+            footprint, geo.pad, geo.pkgPad ? *geo.pkgPad->getName() : QString(),
             clearance));
-      } else if (pad->isOnLayer(Layer::botCopper()) &&
+      } else if (geo.pad->isOnLayer(Layer::botCopper()) &&
                  stopMask.intersects(botLegend)) {
         msgs.append(std::make_shared<MsgPadOverlapsWithLegend>(
-            footprint, pad, pkgPad ? *pkgPad->getName() : QString(),
+            footprint, geo.pad, geo.pkgPad ? *geo.pkgPad->getName() : QString(),
             clearance));
       }
     }
@@ -758,6 +790,59 @@ void PackageCheck::checkFootprintModels(MsgList& msgs) const {
   }
 }
 
+const QVector<PackageCheck::PadGeometry>& PackageCheck::getPadGeometries(
+    const Footprint& footprint) const {
+  auto it = mPadGeometries.find(&footprint);
+  if (it == mPadGeometries.end()) {
+    QVector<PadGeometry> geometries;
+    for (auto itPad = footprint.getPads().begin();
+         itPad != footprint.getPads().end(); ++itPad) {
+      PadGeometry geo;
+      geo.pad = itPad.ptr();
+      geo.pkgPad = geo.pad->getPackagePadUuid()
+          ? mPackage.getPads().find(*geo.pad->getPackagePadUuid())
+          : nullptr;
+      const Transform transform(geo.pad->getPosition(), geo.pad->getRotation());
+      geo.copperPx =
+          transform.mapPx(geo.pad->getGeometry().toFilledQPainterPathPx());
+      geo.boundsPx = geo.copperPx.boundingRect();
+      geometries.append(geo);
+    }
+    it = mPadGeometries.insert(&footprint, geometries);
+  }
+  return *it;
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+QVector<std::pair<int, int>> PackageCheck::findOverlappingRects(
+    const QVector<QRectF>& rects) noexcept {
+  QVector<int> order(rects.count());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&rects](int a, int b) {
+    return rects.at(a).left() < rects.at(b).left();
+  });
+
+  QVector<std::pair<int, int>> pairs;
+  for (int i = 0; i < order.count(); ++i) {
+    const QRectF& r1 = rects.at(order.at(i));
+    for (int k = i + 1; k < order.count(); ++k) {
+      const QRectF& r2 = rects.at(order.at(k));
+      if (r2.left() > r1.right()) {
+        break;  // All following rects are right of r1.
+      }
+      if ((r2.top() <= r1.bottom()) && (r1.top() <= r2.bottom())) {
+        pairs.append(std::make_pair(std::min(order.at(i), order.at(k)),
+                                    std::max(order.at(i), order.at(k))));
+      }
+    }
+  }
+  std::sort(pairs.begin(), pairs.end());
+  return pairs;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -26,13 +26,19 @@
 #include "../libraryelementcheck.h"
 
 #include <QtCore>
+#include <QtGui>
+
+#include <memory>
 
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
 namespace librepcb {
 
+class Footprint;
+class FootprintPad;
 class Package;
+class PackagePad;
 
 /*******************************************************************************
  *  Class PackageCheck
@@ -55,6 +61,17 @@ public:
   // Operator Overloadings
   PackageCheck& operator=(const PackageCheck& rhs) = delete;
 
+protected:  // Types
+  /**
+   * @brief Pad geometry shared by all checks of a single #runChecks() call
+   */
+  struct PadGeometry {
+    std::shared_ptr<const FootprintPad> pad;
+    std::shared_ptr<const PackagePad> pkgPad;  ///< `nullptr` if unconnected
+    QPainterPath copperPx;  ///< Copper area in footprint coordinates
+    QRectF boundsPx;  ///< Bounding rect of #copperPx
+  };
+
 protected:  // Methods
   void checkAssemblyType(MsgList& msgs) const;
   void checkDuplicatePadNames(MsgList& msgs) const;
@@ -78,9 +95,27 @@ protected:  // Methods
   void checkLineWidths(MsgList& msgs) const;
   void checkZones(MsgList& msgs) const;
   void checkFootprintModels(MsgList& msgs) const;
+  const QVector<PadGeometry>& getPadGeometries(
+      const Footprint& footprint) const;
+
+  /**
+   * @brief Find all pairs of overlapping rectangles
+   *
+   * Uses a sort-and-sweep along the x-axis to avoid comparing every
+   * rectangle with every other rectangle. Touching rectangles are considered
+   * as overlapping.
+   *
+   * @param rects   The rectangles to compare.
+   *
+   * @return Indices (i, j) with i < j of all overlapping rectangles, sorted
+   *         ascending.
+   */
+  static QVector<std::pair<int, int>> findOverlappingRects(
+      const QVector<QRectF>& rects) noexcept;
 
 private:  // Data
   const Package& mPackage;
+  mutable QMap<const Footprint*, QVector<PadGeometry>> mPadGeometries;
 };
 
 /*******************************************************************************
@@ -23,6 +23,7 @@
 #include "symbol.h"
 
 #include "../../serialization/fileformatmigration.h"
+#include "../../utils/memoryreport.h"
 #include "symbolcheck.h"
 
 #include <QtCore>
@@ -87,6 +88,21 @@ RuleCheckMessageList Symbol::runChecks() const {
   return check.runChecks();  // can throw
 }
 
+qint64 Symbol::getApproxMemoryUsage() const noexcept {
+  const qint64 overhead = MemoryReport::getAllocationOverhead();
+  qint64 bytes = LibraryElement::getApproxMemoryUsage() + sizeof(Symbol) -
+      sizeof(LibraryElement);
+  bytes += mPins.count() * (sizeof(SymbolPin) + overhead);
+  for (const Polygon& polygon : mPolygons) {
+    bytes += polygon.getApproxMemoryUsage() + overhead;
+  }
+  bytes += mCircles.count() * (sizeof(Circle) + overhead);
+  for (const Text& text : mTexts) {
+    bytes += sizeof(Text) + overhead + MemoryReport::estimate(text.getText());
+  }
+  return bytes;
+}
+
 std::unique_ptr<Symbol> Symbol::open(
     std::unique_ptr<TransactionalDirectory> directory,
     bool abortBeforeMigration) {
@@ -86,6 +86,7 @@ public:
 
   // General Methods
   virtual RuleCheckMessageList runChecks() const override;
+  virtual qint64 getApproxMemoryUsage() const noexcept override;
 
   // Operator Overloadings
   Symbol& operator=(const Symbol& rhs) = delete;
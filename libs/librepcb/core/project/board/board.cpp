@@ -25,6 +25,7 @@
 #include "../../3d/scenedata3d.h"
 #include "../../application.h"
 #include "../../exceptions.h"
+#include "../../geometry/padgeometry.h"
 #include "../../geometry/polygon.h"
 #include "../../library/cmp/component.h"
 #include "../../library/dev/device.h"
@@ -34,8 +35,10 @@
 #include "../../serialization/sexpression.h"
 #include "../../types/lengthunit.h"
 #include "../../types/pcbcolor.h"
+#include "../../utils/memoryreport.h"
 #include "../../utils/scopeguardlist.h"
 #include "../../utils/toolbox.h"
+#include "../../utils/tracer.h"
 #include "../circuit/circuit.h"
 #include "../circuit/componentinstance.h"
 #include "../circuit/netsignal.h"
@@ -304,12 +307,12 @@ void Board::setDrcSettings(
  ******************************************************************************/
 
 void Board::loadDrcMessageApprovals(
-    const Version& version, const QSet<SExpression>& approvals) noexcept {
+    const Version& version, const QSet<RuleCheckApproval>& approvals) noexcept {
   mDrcMessageApprovalsVersion = version;
   mDrcMessageApprovals = approvals;
 }
 
-bool Board::updateDrcMessageApprovals(QSet<SExpression> approvals,
+bool Board::updateDrcMessageApprovals(QSet<RuleCheckApproval> approvals,
                                       bool partialRun) noexcept {
   mSupportedDrcMessageApprovals |= approvals;
 
@@ -340,7 +343,7 @@ bool Board::updateDrcMessageApprovals(QSet<SExpression> approvals,
   return false;
 }
 
-void Board::setDrcMessageApproved(const SExpression& approval,
+void Board::setDrcMessageApproved(const RuleCheckApproval& approval,
                                   bool approved) noexcept {
   if (approved) {
     mDrcMessageApprovals.insert(approval);
@@ -614,6 +617,9 @@ void Board::triggerAirWiresRebuild() noexcept {
   }
 
   try {
+    LIBREPCB_TRACE_SCOPE_DETAIL(
+        "board", "rebuildAirWires",
+        QString::number(mScheduledNetSignalsForAirWireRebuild.count()));
     foreach (NetSignal* netsignal, mScheduledNetSignalsForAirWireRebuild) {
       // remove old airwires
       while (BI_AirWire* airWire = mAirWires.take(netsignal)) {
@@ -882,7 +888,10 @@ void Board::removeFromProject() {
   sgl.dismiss();
 }
 
-void Board::save() {
+QMap<QString, std::shared_ptr<const SExpression>> Board::serialize() const {
+  LIBREPCB_TRACE_SCOPE_DETAIL("board", "serialize", *mName);
+  QMap<QString, std::shared_ptr<const SExpression>> files;
+
   // Content.
   {
     std::unique_ptr<SExpression> root =
@@ -929,9 +938,9 @@ void Board::save() {
       mDrcSettings->serialize(node);
       node.appendChild("approvals_version", mDrcMessageApprovalsVersion);
       node.ensureLineBreak();
-      foreach (const SExpression& child,
+      foreach (const RuleCheckApproval& approval,
                Toolbox::sortedQSet(mDrcMessageApprovals)) {
-        node.appendChild(child);
+        node.appendChild(approval.getNode());
         node.ensureLineBreak();
       }
     }
@@ -973,7 +982,7 @@ void Board::save() {
       obj->getData().serialize(root->appendList("hole"));
     }
     root->ensureLineBreak();
-    mDirectory->write("board.lp", root->toByteArray());
+    files.insert("board.lp", std::move(root));
   }
 
   // User settings.
@@ -995,7 +1004,75 @@ void Board::save() {
       node.appendChild("visible", plane->isVisible());
     }
     root->ensureLineBreak();
-    mDirectory->write("settings.user.lp", root->toByteArray());
+    files.insert("settings.user.lp", std::move(root));
+  }
+  return files;
+}
+
+void Board::reportMemoryUsage(MemoryReport& report,
+                              const QString& category) const noexcept {
+  const qint64 overhead = MemoryReport::getAllocationOverhead();
+  report.add(category % "/General",
+             sizeof(Board) + MemoryReport::estimate(mDefaultFontFileName));
+  foreach (const BI_Device* device, mDeviceInstances) {
+    qint64 bytes = sizeof(BI_Device) + overhead;
+    foreach (const BI_FootprintPad* pad, device->getPads()) {
+      bytes += sizeof(BI_FootprintPad) + overhead;
+      foreach (const QList<PadGeometry>& geometries, pad->getGeometries()) {
+        for (const PadGeometry& geometry : geometries) {
+          bytes += geometry.getApproxMemoryUsage();
+        }
+      }
+    }
+    foreach (const BI_StrokeText* text, device->getStrokeTexts()) {
+      bytes += sizeof(BI_StrokeText) + overhead +
+          Path::getApproxMemoryUsage(text->getPaths());
+    }
+    report.add(category % "/Devices", bytes);
+  }
+  foreach (const BI_NetSegment* netSegment, mNetSegments) {
+    report.add(category % "/Net segments",
+               sizeof(BI_NetSegment) + overhead +
+                   netSegment->getVias().count() * (sizeof(BI_Via) + overhead) +
+                   netSegment->getNetPoints().count() *
+                       (sizeof(BI_NetPoint) + overhead) +
+                   netSegment->getNetLines().count() *
+                       (sizeof(BI_NetLine) + overhead));
+  }
+  foreach (const BI_Plane* plane, mPlanes) {
+    report.add(category % "/Planes",
+               sizeof(BI_Plane) + overhead +
+                   plane->getOutline().getApproxMemoryUsage() +
+                   Path::getApproxMemoryUsage(plane->getFragments()));
+  }
+  foreach (const BI_Polygon* polygon, mPolygons) {
+    report.add(category % "/Polygons",
+               sizeof(BI_Polygon) + overhead +
+                   polygon->getData().getPath().getApproxMemoryUsage());
+  }
+  foreach (const BI_StrokeText* text, mStrokeTexts) {
+    report.add(category % "/Stroke texts",
+               sizeof(BI_StrokeText) + overhead +
+                   Path::getApproxMemoryUsage(text->getPaths()));
+  }
+  foreach (const BI_Zone* zone, mZones) {
+    report.add(category % "/Zones",
+               sizeof(BI_Zone) + overhead +
+                   zone->getData().getOutline().getApproxMemoryUsage());
+  }
+  foreach (const BI_Hole* hole, mHoles) {
+    report.add(category % "/Holes",
+               sizeof(BI_Hole) + overhead +
+                   hole->getData().getPath()->getApproxMemoryUsage());
+  }
+  if (!mAirWires.isEmpty()) {
+    report.add(category % "/Air wires",
+               mAirWires.count() * (sizeof(BI_AirWire) + overhead),
+               mAirWires.count());
+  }
+  foreach (const RuleCheckApproval& approval, mDrcMessageApprovals) {
+    report.add(category % "/DRC approvals",
+               approval.getNode().getApproxMemoryUsage());
   }
 }
 
@@ -25,6 +25,7 @@
  ******************************************************************************/
 #include "../../fileio/filepath.h"
 #include "../../fileio/transactionaldirectory.h"
+#include "../../rulecheck/rulecheckapproval.h"
 #include "../../types/elementname.h"
 #include "../../types/length.h"
 #include "../../types/lengthunit.h"
@@ -57,9 +58,11 @@ class BoardDesignRuleCheckSettings;
 class BoardDesignRules;
 class BoardFabricationOutputSettings;
 class Layer;
+class MemoryReport;
 class NetSignal;
 class PcbColor;
 class Project;
+class SExpression;
 class SceneData3D;
 
 /*******************************************************************************
@@ -167,14 +170,15 @@ public:
   void setDrcSettings(const BoardDesignRuleCheckSettings& settings) noexcept;
 
   // DRC Message Approval Methods
-  const QSet<SExpression>& getDrcMessageApprovals() const noexcept {
+  const QSet<RuleCheckApproval>& getDrcMessageApprovals() const noexcept {
     return mDrcMessageApprovals;
   }
-  void loadDrcMessageApprovals(const Version& version,
-                               const QSet<SExpression>& approvals) noexcept;
-  bool updateDrcMessageApprovals(QSet<SExpression> approvals,
+  void loadDrcMessageApprovals(
+      const Version& version,
+      const QSet<RuleCheckApproval>& approvals) noexcept;
+  bool updateDrcMessageApprovals(QSet<RuleCheckApproval> approvals,
                                  bool partialRun) noexcept;
-  void setDrcMessageApproved(const SExpression& approval,
+  void setDrcMessageApproved(const RuleCheckApproval& approval,
                              bool approved) noexcept;
 
   // DeviceInstance Methods
@@ -239,7 +243,17 @@ public:
   void copyFrom(const Board& other);
   void addToProject();
   void removeFromProject();
-  void save();
+
+  /**
+   * @brief Serialize this object into its files
+   *
+   * @return File paths (relative to the directory of this object) and their
+   *         content.
+   */
+  QMap<QString, std::shared_ptr<const SExpression>> serialize() const;
+
+  void reportMemoryUsage(MemoryReport& report,
+                         const QString& category) const noexcept;
 
   // Operator Overloadings
   Board& operator=(const Board& rhs) = delete;
@@ -302,8 +316,8 @@ private:
 
   // DRC
   Version mDrcMessageApprovalsVersion;
-  QSet<SExpression> mDrcMessageApprovals;
-  QSet<SExpression> mSupportedDrcMessageApprovals;
+  QSet<RuleCheckApproval> mDrcMessageApprovals;
+  QSet<RuleCheckApproval> mSupportedDrcMessageApprovals;
 
   // items
   QMap<Uuid, BI_Device*> mDeviceInstances;
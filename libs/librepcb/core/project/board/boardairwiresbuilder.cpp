@@ -128,13 +128,14 @@ QVector<std::pair<const BI_NetLineAnchor*, const BI_NetLineAnchor*>>
     if (&plane->getBoard() != &mBoard) continue;
     const int planeLayer = plane->getLayer().getCopperNumber();
     foreach (const Path& fragment, plane->getFragments()) {
+      const QPainterPath fragmentPx = fragment.toQPainterPathPx();
       int lastId = -1;
       for (auto it = pointLayerMap.begin(); it != pointLayerMap.end(); it++) {
         const Point& pos = std::get<0>(it.value());
         const int startLayer = std::get<1>(it.value());
         const int endLayer = std::get<2>(it.value());
         if ((planeLayer >= startLayer) && (planeLayer <= endLayer) &&
-            fragment.toQPainterPathPx().contains(pos.toPxQPointF())) {
+            fragmentPx.contains(pos.toPxQPointF())) {
           if (lastId >= 0) {
             builder.addEdge(lastId, it.key());
           }
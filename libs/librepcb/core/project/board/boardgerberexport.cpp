@@ -32,6 +32,7 @@
 #include "../../library/pkg/footprintpad.h"
 #include "../../library/pkg/package.h"
 #include "../../library/pkg/packagepad.h"
+#include "../../utils/tracer.h"
 #include "../../utils/transform.h"
 #include "../circuit/componentinstance.h"
 #include "../circuit/componentsignalinstance.h"
@@ -117,6 +118,7 @@ void BoardGerberExport::setBeforeWriteCallback(BeforeWriteCallback cb) {
 
 void BoardGerberExport::exportPcbLayers(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_FUNCTION("gerber");
   mWrittenFiles.clear();
 
   exportDrillsMerged(settings);
@@ -138,6 +140,7 @@ void BoardGerberExport::exportPcbLayers(
 void BoardGerberExport::exportComponentLayer(BoardSide side,
                                              const Uuid& assemblyVariant,
                                              const FilePath& filePath) const {
+  LIBREPCB_TRACE_FUNCTION("gerber");
   GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
                       *mProject.getVersion());
   if (side == BoardSide::Top) {
@@ -299,6 +302,7 @@ void BoardGerberExport::exportComponentLayer(BoardSide side,
 
 void BoardGerberExport::exportDrillsMerged(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_FUNCTION("gerber");
   const FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                         settings.getSuffixDrills());
   if (settings.getMergeDrillFiles()) {
@@ -318,6 +322,7 @@ void BoardGerberExport::exportDrillsMerged(
 
 void BoardGerberExport::exportDrillsNpth(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_FUNCTION("gerber");
   const FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                         settings.getSuffixDrillsNpth());
   if (!settings.getMergeDrillFiles()) {
@@ -344,6 +349,7 @@ void BoardGerberExport::exportDrillsNpth(
 
 void BoardGerberExport::exportDrillsPth(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_FUNCTION("gerber");
   const FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                         settings.getSuffixDrillsPth());
   if (!settings.getMergeDrillFiles()) {
@@ -362,6 +368,7 @@ void BoardGerberExport::exportDrillsPth(
 
 void BoardGerberExport::exportDrillsBlindBuried(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_FUNCTION("gerber");
   auto vias = getBlindBuriedVias();
   for (auto it = vias.begin(); it != vias.end(); it++) {
     mCurrentStartLayer = it.key().first;
@@ -383,6 +390,7 @@ void BoardGerberExport::exportDrillsBlindBuried(
 
 void BoardGerberExport::exportLayerBoardOutlines(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_FUNCTION("gerber");
   FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                   settings.getSuffixOutlines());
   GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
@@ -397,6 +405,7 @@ void BoardGerberExport::exportLayerBoardOutlines(
 
 void BoardGerberExport::exportLayerTopCopper(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_FUNCTION("gerber");
   FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                   settings.getSuffixCopperTop());
   GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
@@ -411,6 +420,7 @@ void BoardGerberExport::exportLayerTopCopper(
 
 void BoardGerberExport::exportLayerBottomCopper(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_FUNCTION("gerber");
   FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                   settings.getSuffixCopperBot());
   GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
@@ -426,7 +436,10 @@ void BoardGerberExport::exportLayerBottomCopper(
 
 void BoardGerberExport::exportLayerInnerCopper(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_FUNCTION("gerber");
   for (int i = 1; i <= mBoard.getInnerLayerCount(); ++i) {
+    LIBREPCB_TRACE_SCOPE_DETAIL("gerber", "innerCopperLayer",
+                                QString::number(i));
     mCurrentInnerCopperLayer = i;  // used for attribute provider
     FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                     settings.getSuffixCopperInner());
@@ -448,6 +461,7 @@ void BoardGerberExport::exportLayerInnerCopper(
 
 void BoardGerberExport::exportLayerTopSolderMask(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_FUNCTION("gerber");
   const FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                         settings.getSuffixSolderMaskTop());
   if (mBoard.getSolderResist()) {
@@ -467,6 +481,7 @@ void BoardGerberExport::exportLayerTopSolderMask(
 
 void BoardGerberExport::exportLayerBottomSolderMask(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_FUNCTION("gerber");
   const FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                         settings.getSuffixSolderMaskBot());
   if (mBoard.getSolderResist()) {
@@ -486,6 +501,7 @@ void BoardGerberExport::exportLayerBottomSolderMask(
 
 void BoardGerberExport::exportLayerTopSilkscreen(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_FUNCTION("gerber");
   const FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                         settings.getSuffixSilkscreenTop());
   const QVector<const Layer*>& layers = mBoard.getSilkscreenLayersTop();
@@ -510,6 +526,7 @@ void BoardGerberExport::exportLayerTopSilkscreen(
 
 void BoardGerberExport::exportLayerBottomSilkscreen(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_FUNCTION("gerber");
   const FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                         settings.getSuffixSilkscreenBot());
   const QVector<const Layer*>& layers = mBoard.getSilkscreenLayersBot();
@@ -534,6 +551,7 @@ void BoardGerberExport::exportLayerBottomSilkscreen(
 
 void BoardGerberExport::exportLayerTopSolderPaste(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_FUNCTION("gerber");
   const FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                         settings.getSuffixSolderPasteTop());
   if (settings.getEnableSolderPasteTop()) {
@@ -553,6 +571,7 @@ void BoardGerberExport::exportLayerTopSolderPaste(
 
 void BoardGerberExport::exportLayerBottomSolderPaste(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_FUNCTION("gerber");
   const FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                         settings.getSuffixSolderPasteBot());
   if (settings.getEnableSolderPasteBot()) {
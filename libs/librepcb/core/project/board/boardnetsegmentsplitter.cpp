@@ -76,24 +76,85 @@ QList<BoardNetSegmentSplitter::Segment>
     BoardNetSegmentSplitter::split() noexcept {
   QList<Segment> segments;
 
-  // Split netsegment by anchors and lines
-  ViaList availableVias = mVias;
-  TraceList availableTraces = mTraces;
-  while (!availableTraces.isEmpty()) {
+  // Build an index of the traces connected to each anchor, in input order
+  QHash<TraceAnchor, QVector<int>> anchorTraces;
+  for (int i = 0; i < mTraces.count(); ++i) {
+    anchorTraces[mTraces.at(i)->getStartPoint()].append(i);
+    anchorTraces[mTraces.at(i)->getEndPoint()].append(i);
+  }
+
+  // Split netsegment by anchors and lines. This is a depth-first search
+  // which visits the items in the same order as a recursive implementation
+  // would (start point before end point of each trace, connected traces in
+  // input order), but with an explicit stack to support long segments.
+  struct Visit {
+    int trace;  ///< Index of the trace whose start or end point is visited
+    bool endPoint;
+    const QVector<int>* connectedTraces;  ///< nullptr if not entered yet
+    int nextConnectedTrace;
+  };
+  QVector<bool> usedTraces(mTraces.count(), false);
+  QSet<Uuid> usedJunctions;
+  QSet<Uuid> usedVias;
+  QVector<Visit> stack;
+  for (int i = 0; i < mTraces.count(); ++i) {
+    if (usedTraces.at(i)) {
+      continue;
+    }
     Segment segment;
-    findConnectedLinesAndPoints(availableTraces.first()->getStartPoint(),
-                                availableVias, availableTraces, segment);
+    stack.append(Visit{i, false, nullptr, 0});
+    while (!stack.isEmpty()) {
+      Visit& visit = stack.last();
+      if (!visit.connectedTraces) {
+        const Trace& trace = *mTraces.at(visit.trace);
+        const TraceAnchor& anchor =
+            visit.endPoint ? trace.getEndPoint() : trace.getStartPoint();
+        if (tl::optional<Uuid> junctionUuid = anchor.tryGetJunction()) {
+          if (std::shared_ptr<Junction> junction =
+                  mJunctions.find(*junctionUuid)) {
+            if (!usedJunctions.contains(*junctionUuid)) {
+              segment.junctions.append(junction);
+              usedJunctions.insert(*junctionUuid);
+            }
+          }
+        } else if (tl::optional<Uuid> viaUuid = anchor.tryGetVia()) {
+          if (std::shared_ptr<Via> via = mVias.find(*viaUuid)) {
+            if (!usedVias.contains(*viaUuid)) {
+              segment.vias.append(via);
+              usedVias.insert(*viaUuid);
+            }
+          }
+        }
+        visit.connectedTraces = &anchorTraces[anchor];
+      }
+      while ((visit.nextConnectedTrace < visit.connectedTraces->count()) &&
+             usedTraces.at(
+                 visit.connectedTraces->at(visit.nextConnectedTrace))) {
+        ++visit.nextConnectedTrace;
+      }
+      if (visit.nextConnectedTrace < visit.connectedTraces->count()) {
+        const int next = visit.connectedTraces->at(visit.nextConnectedTrace);
+        usedTraces[next] = true;
+        segment.traces.append(mTraces.value(next));
+        // Note: Invalidates the "visit" reference!
+        stack.append(Visit{next, true, nullptr, 0});
+        stack.append(Visit{next, false, nullptr, 0});
+      } else {
+        stack.removeLast();
+      }
+    }
     segments.append(segment);
   }
-  Q_ASSERT(availableTraces.isEmpty());
 
   // Add remaining vias as separate segments
-  while (!availableVias.isEmpty()) {
-    Segment segment;
-    segment.vias.append(availableVias.take(0));
-    segments.append(segment);
+  for (int i = 0; i < mVias.count(); ++i) {
+    std::shared_ptr<Via> via = mVias.value(i);
+    if (!usedVias.contains(via->getUuid())) {
+      Segment segment;
+      segment.vias.append(via);
+      segments.append(segment);
+    }
   }
-  Q_ASSERT(availableVias.isEmpty());
 
   return segments;
 }
@@ -120,39 +181,6 @@ TraceAnchor BoardNetSegmentSplitter::replaceAnchor(
   }
 }
 
-void BoardNetSegmentSplitter::findConnectedLinesAndPoints(
-    const TraceAnchor& anchor, ViaList& availableVias,
-    TraceList& availableTraces, Segment& segment) noexcept {
-  if (tl::optional<Uuid> junctionUuid = anchor.tryGetJunction()) {
-    if (std::shared_ptr<Junction> junction = mJunctions.find(*junctionUuid)) {
-      if (!segment.junctions.contains(junction->getUuid())) {
-        segment.junctions.append(junction);
-      }
-    }
-  } else if (tl::optional<Uuid> viaUuid = anchor.tryGetVia()) {
-    if (std::shared_ptr<Via> via = mVias.find(*viaUuid)) {
-      if (availableVias.contains(via->getUuid())) {
-        segment.vias.append(via);
-        availableVias.remove(via->getUuid());
-      }
-    }
-  }
-  for (int i = 0; i < mTraces.count(); ++i) {
-    std::shared_ptr<Trace> trace = mTraces.value(i);
-    if (((trace->getStartPoint() == anchor) ||
-         (trace->getEndPoint() == anchor)) &&
-        availableTraces.contains(trace->getUuid()) &&
-        (!segment.traces.contains(trace->getUuid()))) {
-      segment.traces.append(trace);
-      availableTraces.remove(trace->getUuid());
-      findConnectedLinesAndPoints(trace->getStartPoint(), availableVias,
-                                  availableTraces, segment);
-      findConnectedLinesAndPoints(trace->getEndPoint(), availableVias,
-                                  availableTraces, segment);
-    }
-  }
-}
-
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -73,11 +73,6 @@ public:
 private:  // Methods
   TraceAnchor replaceAnchor(const TraceAnchor& anchor,
                             const Layer& layer) noexcept;
-  void findConnectedLinesAndPoints(const TraceAnchor& anchor,
-                                   ViaList& availableVias,
-                                   TraceList& availableTraces, Segment& segment)
-
-      noexcept;
 
 private:  // Data
   JunctionList mJunctions;
@@ -48,6 +48,37 @@
  ******************************************************************************/
 namespace librepcb {
 
+/*******************************************************************************
+ *  Local Functions
+ ******************************************************************************/
+
+static void addToStream(QDataStream& s, const Point& point) noexcept {
+  s << qint64(point.getX().toNm()) << qint64(point.getY().toNm());
+}
+
+static void addToStream(QDataStream& s, const Path& path) noexcept {
+  s << int(path.getVertices().count());
+  for (const Vertex& vertex : path.getVertices()) {
+    addToStream(s, vertex.getPos());
+    s << vertex.getAngle().toMicroDeg();
+  }
+}
+
+static void addToStream(QDataStream& s, const Transform& transform) noexcept {
+  addToStream(s, transform.getPosition());
+  s << transform.getRotation().toMicroDeg() << transform.getMirrored();
+}
+
+static void addToStream(QDataStream& s, const PadHole& hole) noexcept {
+  s << qint64(hole.getDiameter()->toNm());
+  addToStream(s, *hole.getPath());
+}
+
+static void addToStream(QDataStream& s,
+                        const tl::optional<Length>& value) noexcept {
+  s << bool(value) << qint64(value ? value->toNm() : 0);
+}
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
@@ -129,6 +160,7 @@ BoardPainter::BoardPainter(const Board& board)
                 netline->getEndPoint().getPosition(), netline->getWidth()});
     }
   }
+  mContentHash = calcContentHash();
 }
 
 BoardPainter::~BoardPainter() noexcept {
@@ -380,6 +412,118 @@ void BoardPainter::initContentByColor() const noexcept {
   }
 }
 
+QByteArray BoardPainter::calcContentHash() const noexcept {
+  // Note: The exact encoding does not matter as hashes are never written to
+  // disk, it just needs to be unambiguous.
+  auto addPolygon = [](QDataStream& s, const PolygonData& polygon) {
+    s << polygon.layer->getId();
+    addToStream(s, polygon.path);
+    s << qint64(polygon.lineWidth->toNm()) << polygon.filled
+      << polygon.grabArea;
+  };
+  auto addHole = [](QDataStream& s, const HoleData& hole) {
+    s << qint64(hole.diameter->toNm());
+    addToStream(s, *hole.path);
+    addToStream(s, hole.stopMaskOffset);
+  };
+  QByteArray data;
+  {
+    QDataStream s(&data, QIODevice::WriteOnly);
+    s << mMonospaceFont.toString();
+    QStringList copperLayers;
+    foreach (const Layer* layer, mCopperLayers) {
+      copperLayers.append(layer->getId());
+    }
+    copperLayers.sort();
+    s << copperLayers;
+    s << int(mFootprints.count());
+    foreach (const Footprint& footprint, mFootprints) {
+      addToStream(s, footprint.transform);
+      s << int(footprint.pads.count());
+      foreach (const Pad& pad, footprint.pads) {
+        addToStream(s, pad.transform);
+        s << int(pad.layerGeometries.count());
+        for (const auto& pair : pad.layerGeometries) {
+          const PadGeometry& geometry = pair.second;
+          s << pair.first->getId() << int(geometry.getShape())
+            << qint64(geometry.getWidth().toNm())
+            << qint64(geometry.getHeight().toNm())
+            << qint64(geometry.getCornerRadius()->toNm());
+          addToStream(s, geometry.getPath());
+          s << int(geometry.getHoles().count());
+          for (const PadHole& hole : geometry.getHoles()) {
+            addToStream(s, hole);
+          }
+        }
+        s << int(pad.holes.count());
+        foreach (const PadHole& hole, pad.holes) {
+          addToStream(s, hole);
+        }
+      }
+      s << int(footprint.polygons.count());
+      foreach (const PolygonData& polygon, footprint.polygons) {
+        addPolygon(s, polygon);
+      }
+      s << int(footprint.circles.count());
+      foreach (const Circle& circle, footprint.circles) {
+        s << circle.getLayer().getId() << qint64(circle.getLineWidth()->toNm())
+          << circle.isFilled() << circle.isGrabArea();
+        addToStream(s, circle.getCenter());
+        s << qint64(circle.getDiameter()->toNm());
+      }
+      s << int(footprint.holes.count());
+      foreach (const HoleData& hole, footprint.holes) {
+        addHole(s, hole);
+      }
+    }
+    s << int(mVias.count());
+    foreach (const ViaData& via, mVias) {
+      addToStream(s, via.position);
+      s << qint64(via.size->toNm()) << qint64(via.drill->toNm())
+        << via.startLayer->getId() << via.endLayer->getId();
+      addToStream(s, via.stopMaskDiameterTop
+                         ? tl::make_optional(**via.stopMaskDiameterTop)
+                         : tl::optional<Length>());
+      addToStream(s, via.stopMaskDiameterBottom
+                         ? tl::make_optional(**via.stopMaskDiameterBottom)
+                         : tl::optional<Length>());
+    }
+    s << int(mTraces.count());
+    foreach (const Trace& trace, mTraces) {
+      s << trace.layer->getId();
+      addToStream(s, trace.startPosition);
+      addToStream(s, trace.endPosition);
+      s << qint64(trace.width->toNm());
+    }
+    s << int(mPlanes.count());
+    foreach (const Plane& plane, mPlanes) {
+      s << plane.layer->getId() << int(plane.fragments.count());
+      foreach (const Path& fragment, plane.fragments) {
+        addToStream(s, fragment);
+      }
+    }
+    s << int(mPolygons.count());
+    foreach (const PolygonData& polygon, mPolygons) {
+      addPolygon(s, polygon);
+    }
+    s << int(mStrokeTexts.count());
+    foreach (const StrokeTextData& text, mStrokeTexts) {
+      addToStream(s, text.transform);
+      s << text.layer->getId() << int(text.paths.count());
+      foreach (const Path& path, text.paths) {
+        addToStream(s, path);
+      }
+      s << qint64(text.height->toNm()) << qint64(text.strokeWidth->toNm())
+        << text.text << int(text.align.toQtAlign());
+    }
+    s << int(mHoles.count());
+    foreach (const HoleData& hole, mHoles) {
+      addHole(s, hole);
+    }
+  }
+  return QCryptographicHash::hash(data, QCryptographicHash::Sha256);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -142,12 +142,14 @@ public:
   // General Methods
   void paint(QPainter& painter,
              const GraphicsExportSettings& settings) const noexcept override;
+  QByteArray getContentHash() const noexcept override { return mContentHash; }
 
   // Operator Overloadings
   BoardPainter& operator=(const BoardPainter& rhs) = delete;
 
 private:  // Methods
   void initContentByColor() const noexcept;
+  QByteArray calcContentHash() const noexcept;
 
 private:  // Data
   QFont mMonospaceFont;
@@ -159,6 +161,7 @@ private:  // Data
   QList<PolygonData> mPolygons;
   QList<StrokeTextData> mStrokeTexts;
   QList<HoleData> mHoles;
+  QByteArray mContentHash;
 
   mutable QMutex mMutex;
   mutable QHash<QString, ColorContent> mContentByColor;
@@ -25,6 +25,7 @@
 #include "../../library/pkg/footprint.h"
 #include "../../library/pkg/footprintpad.h"
 #include "../../utils/clipperhelpers.h"
+#include "../../utils/tracer.h"
 #include "../../utils/transform.h"
 #include "../circuit/netsignal.h"
 #include "board.h"
@@ -288,6 +289,8 @@ BoardPlaneFragmentsBuilder::Result BoardPlaneFragmentsBuilder::run(
   // Note: This method is called from a different thread, thus be careful with
   //       calling other methods to only call thread-safe methods!
 
+  LIBREPCB_TRACE_SCOPE("planes", "rebuild");
+
   QElapsedTimer timer;
   timer.start();
   qDebug() << "Start calculating areas of" << data->planes.count()
@@ -416,7 +419,15 @@ BoardPlaneFragmentsBuilder::Result BoardPlaneFragmentsBuilder::run(
              << "ms.";
   } else {
     result.finished = true;
-    qDebug() << "Calculated plane areas in" << timer.elapsed() << "ms.";
+    const PadGeometry::ClipperCacheStatistics padStats =
+        PadGeometry::getClipperCacheStatistics();
+    const ClipperHelpers::ShapeCacheStatistics shapeStats =
+        ClipperHelpers::getShapeCacheStatistics();
+    qDebug() << "Calculated plane areas in" << timer.elapsed() << "ms"
+             << "(pad outline cache hits:" << padStats.hits
+             << "misses:" << padStats.misses
+             << ", shape cache hits:" << shapeStats.hits
+             << "misses:" << shapeStats.misses << ").";
   }
 
   emit finished(result);
@@ -425,11 +436,13 @@ BoardPlaneFragmentsBuilder::Result BoardPlaneFragmentsBuilder::run(
 
 BoardPlaneFragmentsBuilder::LayerJobResult BoardPlaneFragmentsBuilder::runLayer(
     std::shared_ptr<const JobData> data, const Layer* layer) noexcept {
+  LIBREPCB_TRACE_SCOPE_DETAIL("planes", "layer", layer->getId());
   LayerJobResult result;
 
   // Build all planes.
   for (auto it = data->planes.begin(); it != data->planes.end(); it++) {
     if (it->layer != layer) continue;
+    LIBREPCB_TRACE_SCOPE_DETAIL("planes", "plane", it->uuid.toStr());
 
     try {
       ClipperLib::Paths removedAreas;
@@ -509,17 +522,14 @@ BoardPlaneFragmentsBuilder::LayerJobResult BoardPlaneFragmentsBuilder::runLayer(
           // connect them with solid style. Since vias are not soldered, heat
           // dissipation is not an issue or often even desired. See discussion
           // https://github.com/LibrePCB/LibrePCB/issues/454#issuecomment-1373402172
-          const Path path = Path::circle(via.diameter).translated(via.position);
-          connectedNetSignalAreas.push_back(
-              ClipperHelpers::convert(path, maxArcTolerance()));
+          connectedNetSignalAreas.push_back(ClipperHelpers::convertCircle(
+              via.position, via.diameter, maxArcTolerance()));
         } else {
           // Vias has different net than plane -> subtract with clearance.
-          const Path path =
-              Path::circle(PositiveLength(via.diameter + it->minClearance * 2))
-                  .translated(via.position);
-          const ClipperLib::Path clipperPath =
-              ClipperHelpers::convert(path, maxArcTolerance());
-          removedAreas.push_back(clipperPath);
+          removedAreas.push_back(ClipperHelpers::convertCircle(
+              via.position,
+              PositiveLength(via.diameter + it->minClearance * 2),
+              maxArcTolerance()));
         }
       }
       if (mAbort) {
@@ -584,10 +594,11 @@ BoardPlaneFragmentsBuilder::LayerJobResult BoardPlaneFragmentsBuilder::runLayer(
         foreach (const PadGeometry& geometry, pad.geometries.value(it->layer)) {
           if (sameNet) {
             // Same net signal -> memorize as connected area.
-            const QVector<Path> paths =
-                pad.transform.map(geometry.toOutlines());
             const ClipperLib::Paths clipperPaths =
-                ClipperHelpers::convert(paths, maxArcTolerance());
+                geometry
+                    .toClipperOutlines(pad.transform, Length(0),
+                                       maxArcTolerance())
+                    ->paths;
             connectedNetSignalAreas.insert(connectedNetSignalAreas.end(),
                                            clipperPaths.begin(),
                                            clipperPaths.end());
@@ -600,10 +611,11 @@ BoardPlaneFragmentsBuilder::LayerJobResult BoardPlaneFragmentsBuilder::runLayer(
             // plane area.
             const Length clearance = std::max(
                 sameNet ? *it->thermalGap : *it->minClearance, *pad.clearance);
-            QVector<Path> paths =
-                pad.transform.map(geometry.withOffset(clearance).toOutlines());
             ClipperLib::Paths clipperPaths =
-                ClipperHelpers::convert(paths, maxArcTolerance());
+                geometry
+                    .toClipperOutlines(pad.transform, clearance,
+                                       maxArcTolerance())
+                    ->paths;
 
             // For thermal relief connection, subtract the spokes from the
             // cutout.
@@ -632,8 +644,11 @@ BoardPlaneFragmentsBuilder::LayerJobResult BoardPlaneFragmentsBuilder::runLayer(
               }
               // Memorize copper area for later removal of unconnected
               // thermal spokes,
-              ClipperLib::Paths tmp = ClipperHelpers::convert(
-                  pad.transform.map(geometry.toOutlines()), maxArcTolerance());
+              ClipperLib::Paths tmp =
+                  geometry
+                      .toClipperOutlines(pad.transform, Length(0),
+                                         maxArcTolerance())
+                      ->paths;
               if (tmp.size() > 1) {
                 ClipperHelpers::unite(tmp,
                                       ClipperLib::pftNonZero);  // can throw
@@ -643,9 +658,10 @@ BoardPlaneFragmentsBuilder::LayerJobResult BoardPlaneFragmentsBuilder::runLayer(
               // Memorize clearance area for later removal of unconnected
               // thermal spokes,
               Length offset = clearance + it->minWidth - maxArcTolerance() - 10;
-              tmp = ClipperHelpers::convert(
-                  pad.transform.map(geometry.withOffset(offset).toOutlines()),
-                  maxArcTolerance());
+              tmp = geometry
+                        .toClipperOutlines(pad.transform, offset,
+                                           maxArcTolerance())
+                        ->paths;
               if (tmp.size() > 1) {
                 ClipperHelpers::unite(tmp,
                                       ClipperLib::pftNonZero);  // can throw
@@ -655,9 +671,10 @@ BoardPlaneFragmentsBuilder::LayerJobResult BoardPlaneFragmentsBuilder::runLayer(
               // Memorize slightly shrinked copper area for later removal of
               // unconnected thermal spokes,
               offset = -maxArcTolerance() - 10;
-              tmp = ClipperHelpers::convert(
-                  pad.transform.map(geometry.withOffset(offset).toOutlines()),
-                  maxArcTolerance());
+              tmp = geometry
+                        .toClipperOutlines(pad.transform, offset,
+                                           maxArcTolerance())
+                        ->paths;
               thermalPadAreasShrinked.insert(thermalPadAreasShrinked.end(),
                                              tmp.begin(), tmp.end());
             }
@@ -670,7 +687,7 @@ BoardPlaneFragmentsBuilder::LayerJobResult BoardPlaneFragmentsBuilder::runLayer(
               for (const PadHole& hole : geometry.getHoles()) {
                 const PositiveLength width(hole.getDiameter() +
                                            (clearance * 2));
-                paths =
+                const QVector<Path> paths =
                     pad.transform.map(hole.getPath()->toOutlineStrokes(width));
                 clipperPaths =
                     ClipperHelpers::convert(paths, maxArcTolerance());
@@ -48,7 +48,10 @@ namespace librepcb {
 
 BoardClipperPathGenerator::BoardClipperPathGenerator(
     const PositiveLength& maxArcTolerance) noexcept
-  : mMaxArcTolerance(maxArcTolerance), mPaths() {
+  : mMaxArcTolerance(maxArcTolerance),
+    mPaths(),
+    mPendingPaths(),
+    mPendingAreas(0) {
 }
 
 BoardClipperPathGenerator::~BoardClipperPathGenerator() noexcept {
@@ -58,7 +61,13 @@ BoardClipperPathGenerator::~BoardClipperPathGenerator() noexcept {
  *  Getters
  ******************************************************************************/
 
-void BoardClipperPathGenerator::takePathsTo(ClipperLib::Paths& out) noexcept {
+const ClipperLib::Paths& BoardClipperPathGenerator::getPaths() {
+  uniteAreas();  // can throw
+  return mPaths;
+}
+
+void BoardClipperPathGenerator::takePathsTo(ClipperLib::Paths& out) {
+  uniteAreas();  // can throw
   out = mPaths;
   mPaths.clear();
 }
@@ -222,15 +231,11 @@ void BoardClipperPathGenerator::addStopMaskOpenings(const Data& data,
     // Pads.
     for (const Data::Pad& pad : dev.pads) {
       const Transform padTransform(pad.position, pad.rotation, pad.mirror);
-      foreach (PadGeometry geometry, pad.geometries.value(&layer)) {
-        if (offset != 0) {
-          geometry = geometry.withOffset(offset);
-        }
-        ClipperHelpers::unite(
-            mPaths,
-            ClipperHelpers::convert(padTransform.map(geometry.toOutlines()),
-                                    mMaxArcTolerance),
-            ClipperLib::pftEvenOdd, ClipperLib::pftNonZero);
+      foreach (const PadGeometry& geometry, pad.geometries.value(&layer)) {
+        addArea(
+            geometry.toClipperOutlines(padTransform, offset, mMaxArcTolerance)
+                ->paths,
+            ClipperLib::pftNonZero);
       }
     }
   }
@@ -252,11 +257,8 @@ void BoardClipperPathGenerator::addVia(const Data::Via& via,
                                        const Length& offset) {
   const Length size = via.size + (offset * 2);
   if (size > 0) {
-    const Path sceneOutline =
-        Path::circle(PositiveLength(size)).translated(via.position);
-    ClipperHelpers::unite(
-        mPaths, {ClipperHelpers::convert(sceneOutline, mMaxArcTolerance)},
-        ClipperLib::pftEvenOdd, ClipperLib::pftEvenOdd);
+    addSimpleArea(ClipperHelpers::convertCircle(
+        via.position, PositiveLength(size), mMaxArcTolerance));
   }
 }
 
@@ -264,19 +266,16 @@ void BoardClipperPathGenerator::addTrace(const Data::Trace& trace,
                                          const Length& offset) {
   const Length width = trace.width + (offset * 2);
   if (width > 0) {
-    const Path sceneOutline = Path::obround(
-        trace.startPosition, trace.endPosition, PositiveLength(width));
-    ClipperHelpers::unite(
-        mPaths, {ClipperHelpers::convert(sceneOutline, mMaxArcTolerance)},
-        ClipperLib::pftEvenOdd, ClipperLib::pftEvenOdd);
+    addSimpleArea(ClipperHelpers::convertObround(
+        trace.startPosition, trace.endPosition, PositiveLength(width),
+        mMaxArcTolerance));
   }
 }
 
 void BoardClipperPathGenerator::addPlane(const QVector<Path>& fragments) {
   foreach (const Path& p, fragments) {
-    ClipperHelpers::unite(mPaths,
-                          {ClipperHelpers::convert(p, mMaxArcTolerance)},
-                          ClipperLib::pftEvenOdd, ClipperLib::pftEvenOdd);
+    addArea({ClipperHelpers::convert(p, mMaxArcTolerance)},
+            ClipperLib::pftEvenOdd);
   }
 }
 
@@ -287,9 +286,8 @@ void BoardClipperPathGenerator::addPolygon(const Path& path,
   const Length totalWidth = lineWidth + offset * 2;
   if ((lineWidth > 0) && (totalWidth > 0)) {
     QVector<Path> paths = path.toOutlineStrokes(PositiveLength(totalWidth));
-    ClipperHelpers::unite(mPaths,
-                          ClipperHelpers::convert(paths, mMaxArcTolerance),
-                          ClipperLib::pftEvenOdd, ClipperLib::pftNonZero);
+    addArea(ClipperHelpers::convert(paths, mMaxArcTolerance),
+            ClipperLib::pftNonZero);
   }
 
   // Area (only fill closed paths, for consistency with the appearance in
@@ -299,8 +297,7 @@ void BoardClipperPathGenerator::addPolygon(const Path& path,
     if (offset != 0) {
       ClipperHelpers::offset(paths, offset, mMaxArcTolerance);
     }
-    ClipperHelpers::unite(mPaths, paths, ClipperLib::pftEvenOdd,
-                          ClipperLib::pftEvenOdd);
+    addArea(paths, ClipperLib::pftEvenOdd);
   }
 }
 
@@ -316,16 +313,14 @@ void BoardClipperPathGenerator::addCircle(const Data::Circle& circle,
   if (circle.lineWidth > 0) {
     QVector<Path> paths =
         path.toOutlineStrokes(PositiveLength(*circle.lineWidth));
-    ClipperHelpers::unite(mPaths,
-                          ClipperHelpers::convert(paths, mMaxArcTolerance),
-                          ClipperLib::pftEvenOdd, ClipperLib::pftNonZero);
+    addArea(ClipperHelpers::convert(paths, mMaxArcTolerance),
+            ClipperLib::pftNonZero);
   }
 
   // Area.
   if (circle.filled) {
-    ClipperHelpers::unite(mPaths,
-                          {ClipperHelpers::convert(path, mMaxArcTolerance)},
-                          ClipperLib::pftEvenOdd, ClipperLib::pftEvenOdd);
+    addArea({ClipperHelpers::convert(path, mMaxArcTolerance)},
+            ClipperLib::pftEvenOdd);
   }
 }
 
@@ -337,9 +332,8 @@ void BoardClipperPathGenerator::addStrokeText(
                             strokeText.mirror);
   foreach (const Path path, transform.map(strokeText.paths)) {
     QVector<Path> paths = path.toOutlineStrokes(width);
-    ClipperHelpers::unite(mPaths,
-                          ClipperHelpers::convert(paths, mMaxArcTolerance),
-                          ClipperLib::pftEvenOdd, ClipperLib::pftNonZero);
+    addArea(ClipperHelpers::convert(paths, mMaxArcTolerance),
+            ClipperLib::pftNonZero);
   }
 }
 
@@ -348,39 +342,72 @@ void BoardClipperPathGenerator::addHole(const PositiveLength& diameter,
                                         const Transform& transform,
                                         const Length& offset) {
   const PositiveLength width(std::max(*diameter + offset + offset, Length(1)));
-  ClipperHelpers::unite(
-      mPaths,
-      ClipperHelpers::convert(transform.map(*path).toOutlineStrokes(width),
-                              mMaxArcTolerance),
-      ClipperLib::pftEvenOdd, ClipperLib::pftNonZero);
+  addArea(ClipperHelpers::convert(transform.map(*path).toOutlineStrokes(width),
+                                  mMaxArcTolerance),
+          ClipperLib::pftNonZero);
 }
 
 void BoardClipperPathGenerator::addPad(const Data::Pad& pad, const Layer& layer,
                                        const Length& offset) {
   const Transform transform(pad.position, pad.rotation, pad.mirror);
-  foreach (PadGeometry geometry, pad.geometries.value(&layer)) {
-    if (offset != 0) {
-      geometry = geometry.withOffset(offset);
-    }
-    ClipperHelpers::unite(
-        mPaths,
-        ClipperHelpers::convert(transform.map(geometry.toOutlines()),
-                                mMaxArcTolerance),
-        ClipperLib::pftEvenOdd, ClipperLib::pftNonZero);
+  foreach (const PadGeometry& geometry, pad.geometries.value(&layer)) {
+    addArea(
+        geometry.toClipperOutlines(transform, offset, mMaxArcTolerance)->paths,
+        ClipperLib::pftNonZero);
 
     // Also add each hole to ensure correct copper areas even if
     // the pad outline is too small or invalid.
     for (const PadHole& hole : geometry.getHoles()) {
-      ClipperHelpers::unite(mPaths,
-                            ClipperHelpers::convert(
-                                transform.map(hole.getPath()->toOutlineStrokes(
-                                    hole.getDiameter())),
-                                mMaxArcTolerance),
-                            ClipperLib::pftEvenOdd, ClipperLib::pftNonZero);
+      addArea(ClipperHelpers::convert(
+                  transform.map(
+                      hole.getPath()->toOutlineStrokes(hole.getDiameter())),
+                  mMaxArcTolerance),
+              ClipperLib::pftNonZero);
     }
   }
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void BoardClipperPathGenerator::addArea(const ClipperLib::Paths& paths,
+                                        ClipperLib::PolyFillType fillType) {
+  // Uniting each area with all the previously added areas would be O(n²), so
+  // only normalize this (small) area to get non-overlapping paths with
+  // positive winding numbers. Then all areas can be united at once with the
+  // nonzero fill type in uniteAreas().
+  ClipperLib::Paths normalized = paths;
+  ClipperHelpers::unite(normalized, fillType);  // can throw
+  mPendingPaths.insert(mPendingPaths.end(), normalized.begin(),
+                       normalized.end());
+  ++mPendingAreas;
+}
+
+void BoardClipperPathGenerator::addSimpleArea(const ClipperLib::Path& path) {
+  // Circles and obrounds are convex and converted with positive orientation,
+  // so they are already normalized.
+  mPendingPaths.push_back(path);
+  ++mPendingAreas;
+}
+
+void BoardClipperPathGenerator::uniteAreas() {
+  if (mPendingPaths.empty()) {
+    mPendingAreas = 0;
+    return;
+  }
+
+  // A single normalized area is already its own union, so the (expensive)
+  // union is only needed if there are several areas.
+  if ((!mPaths.empty()) || (mPendingAreas > 1)) {
+    mPendingPaths.insert(mPendingPaths.end(), mPaths.begin(), mPaths.end());
+    ClipperHelpers::unite(mPendingPaths, ClipperLib::pftNonZero);  // can throw
+  }
+  mPaths.swap(mPendingPaths);
+  mPendingPaths.clear();
+  mPendingAreas = 0;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
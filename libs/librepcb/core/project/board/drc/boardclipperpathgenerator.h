@@ -54,8 +54,31 @@ public:
   ~BoardClipperPathGenerator() noexcept;
 
   // Getters
-  const ClipperLib::Paths& getPaths() const noexcept { return mPaths; }
-  void takePathsTo(ClipperLib::Paths& out) noexcept;
+
+  /**
+   * @brief Get the union of all added areas
+   *
+   * The added areas are united all at once rather than one after another.
+   * Compared to uniting them one after another, the result only differs by
+   * Clipper's integer rounding of intersection points, i.e. each vertex by
+   * at most 1nm. So the area differs by at most the perimeter times 1nm.
+   *
+   * @note  Not noexcept since the added areas are united lazily, which
+   *        might throw.
+   *
+   * @return United paths.
+   */
+  const ClipperLib::Paths& getPaths();
+
+  /**
+   * @brief Move the union of all added areas out of this object
+   *
+   * Same as #getPaths(), but clears the paths afterwards so the generator
+   * can be reused.
+   *
+   * @param out   Target for the united paths.
+   */
+  void takePathsTo(ClipperLib::Paths& out);
 
   // General Methods
   void addCopper(const Data& data, const Layer& layer,
@@ -78,9 +101,17 @@ public:
   void addPad(const Data::Pad& pad, const Layer& layer,
               const Length& offset = Length(0));
 
+private:  // Methods
+  void addArea(const ClipperLib::Paths& paths,
+               ClipperLib::PolyFillType fillType);
+  void addSimpleArea(const ClipperLib::Path& path);
+  void uniteAreas();
+
 private:  // Data
   PositiveLength mMaxArcTolerance;
-  ClipperLib::Paths mPaths;
+  ClipperLib::Paths mPaths;  ///< United areas
+  ClipperLib::Paths mPendingPaths;  ///< Normalized areas, not united yet
+  int mPendingAreas;  ///< Number of areas in #mPendingPaths
 };
 
 /*******************************************************************************
@@ -25,6 +25,7 @@
 #include "../../../geometry/via.h"
 #include "../../../types/layer.h"
 #include "../../../utils/clipperhelpers.h"
+#include "../../../utils/tracer.h"
 #include "../board.h"
 #include "../boardplanefragmentsbuilder.h"
 #include "boardclipperpathgenerator.h"
@@ -142,6 +143,7 @@ BoardDesignRuleCheck::Result BoardDesignRuleCheck::tryRunJob(
 
 BoardDesignRuleCheck::Result BoardDesignRuleCheck::run(
     std::shared_ptr<const Data> data) noexcept {
+  LIBREPCB_TRACE_SCOPE("drc", "run");
   emitProgress(15);
 
   // Prepare calculated job data.
@@ -338,6 +340,7 @@ BoardDesignRuleCheck::Result BoardDesignRuleCheck::run(
 void BoardDesignRuleCheck::prepareCopperPaths(const Data& data,
                                               CalculatedJobData& calcData,
                                               const Layer& layer) {
+  LIBREPCB_TRACE_SCOPE_DETAIL("drc", "prepareCopperPaths", layer.getId());
   emitStatus(tr("Prepare '%1'...").arg(layer.getNameTr()));
   BoardClipperPathGenerator gen(maxArcTolerance());
   gen.addCopper(data, layer, {}, data.quick);
@@ -347,6 +350,7 @@ void BoardDesignRuleCheck::prepareCopperPaths(const Data& data,
 
 RuleCheckMessageList BoardDesignRuleCheck::checkCopperCopperClearances(
     const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
 
   const UnsignedLength clearance = data.settings.getMinCopperCopperClearance();
@@ -657,6 +661,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkCopperCopperClearances(
 
 RuleCheckMessageList BoardDesignRuleCheck::checkCopperBoardClearances(
     const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
 
   const UnsignedLength clearance = data.settings.getMinCopperBoardClearance();
@@ -806,6 +811,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkCopperBoardClearances(
 
 RuleCheckMessageList BoardDesignRuleCheck::checkCopperHoleClearances(
     const Data& data, const CalculatedJobData& calcData) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
 
   const UnsignedLength clearance = data.settings.getMinCopperNpthClearance();
@@ -863,6 +869,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkCopperHoleClearances(
 
 RuleCheckMessageList BoardDesignRuleCheck::checkDrillDrillClearances(
     const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
 
   const UnsignedLength clearance = data.settings.getMinDrillDrillClearance();
@@ -950,6 +957,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkDrillDrillClearances(
 
 RuleCheckMessageList BoardDesignRuleCheck::checkDrillBoardClearances(
     const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
 
   const UnsignedLength clearance = data.settings.getMinDrillBoardClearance();
@@ -1027,6 +1035,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkDrillBoardClearances(
 
 RuleCheckMessageList BoardDesignRuleCheck::checkSilkscreenStopmaskClearances(
     const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
 
   const UnsignedLength clearance =
@@ -1120,6 +1129,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkSilkscreenStopmaskClearances(
 
 RuleCheckMessageList BoardDesignRuleCheck::checkMinimumCopperWidth(
     const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
 
   const UnsignedLength minWidth = data.settings.getMinCopperWidth();
@@ -1136,6 +1146,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkMinimumCopperWidth(
 
 RuleCheckMessageList BoardDesignRuleCheck::checkMinimumPthAnnularRing(
     const Data& data, const CalculatedJobData& calcData) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
 
   const UnsignedLength annularWidth = data.settings.getMinPthAnnularRing();
@@ -1205,6 +1216,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkMinimumPthAnnularRing(
 
 RuleCheckMessageList BoardDesignRuleCheck::checkMinimumNpthDrillDiameter(
     const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
 
   const UnsignedLength minDiameter = data.settings.getMinNpthDrillDiameter();
@@ -1241,6 +1253,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkMinimumNpthDrillDiameter(
 
 RuleCheckMessageList BoardDesignRuleCheck::checkMinimumNpthSlotWidth(
     const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
 
   const UnsignedLength minWidth = data.settings.getMinNpthSlotWidth();
@@ -1276,6 +1289,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkMinimumNpthSlotWidth(
 
 RuleCheckMessageList BoardDesignRuleCheck::checkMinimumPthDrillDiameter(
     const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
 
   const UnsignedLength minDiameter = data.settings.getMinPthDrillDiameter();
@@ -1318,6 +1332,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkMinimumPthDrillDiameter(
 
 RuleCheckMessageList BoardDesignRuleCheck::checkMinimumPthSlotWidth(
     const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
 
   const UnsignedLength minWidth = data.settings.getMinPthSlotWidth();
@@ -1347,6 +1362,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkMinimumPthSlotWidth(
 
 RuleCheckMessageList BoardDesignRuleCheck::checkMinimumSilkscreenWidth(
     const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
 
   const UnsignedLength minWidth = data.settings.getMinSilkscreenWidth();
@@ -1365,6 +1381,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkMinimumSilkscreenWidth(
 
 RuleCheckMessageList BoardDesignRuleCheck::checkMinimumSilkscreenTextHeight(
     const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
 
   const UnsignedLength minHeight = data.settings.getMinSilkscreenTextHeight();
@@ -1394,6 +1411,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkMinimumSilkscreenTextHeight(
 }
 
 RuleCheckMessageList BoardDesignRuleCheck::checkZones(const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
   emitStatus(tr("Check keepout zones..."));
 
@@ -1639,6 +1657,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkZones(const Data& data) {
 }
 
 RuleCheckMessageList BoardDesignRuleCheck::checkVias(const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
   emitStatus(tr("Check for useless or disallowed vias..."));
   for (const Data::Segment& ns : data.segments) {
@@ -1658,6 +1677,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkVias(const Data& data) {
 
 RuleCheckMessageList BoardDesignRuleCheck::checkAllowedNpthSlots(
     const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
   emitStatus(tr("Check for disallowed NPTH slots..."));
 
@@ -1691,6 +1711,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkAllowedNpthSlots(
 
 RuleCheckMessageList BoardDesignRuleCheck::checkAllowedPthSlots(
     const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
   emitStatus(tr("Check for disallowed PTH slots..."));
 
@@ -1718,6 +1739,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkAllowedPthSlots(
 
 RuleCheckMessageList BoardDesignRuleCheck::checkInvalidPadConnections(
     const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
   emitStatus(tr("Check pad connections..."));
   for (const Data::Device& dev : data.devices) {
@@ -1745,6 +1767,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkInvalidPadConnections(
 
 RuleCheckMessageList BoardDesignRuleCheck::checkDeviceClearances(
     const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
   emitStatus(tr("Check device clearances..."));
 
@@ -1800,6 +1823,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkDeviceClearances(
 }
 
 RuleCheckMessageList BoardDesignRuleCheck::checkBoardOutline(const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
   emitStatus(tr("Check board outline..."));
 
@@ -1877,6 +1901,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkBoardOutline(const Data& data) {
 }
 
 RuleCheckMessageList BoardDesignRuleCheck::checkUsedLayers(const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   emitStatus(tr("Check used layers..."));
 
   // Determine all used copper layers.
@@ -1937,6 +1962,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkUsedLayers(const Data& data) {
 
 RuleCheckMessageList BoardDesignRuleCheck::checkForUnplacedComponents(
     const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   // The actual check is already done in start(), so we only need to create the
   // messages.
   RuleCheckMessageList messages;
@@ -1951,6 +1977,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkForUnplacedComponents(
 
 RuleCheckMessageList BoardDesignRuleCheck::checkForMissingConnections(
     const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   emitStatus(tr("Check for missing connections..."));
 
   auto convertAnchor = [&data](const Data::AirWireAnchor& anchor) {
@@ -1991,6 +2018,7 @@ RuleCheckMessageList BoardDesignRuleCheck::checkForMissingConnections(
 
 RuleCheckMessageList BoardDesignRuleCheck::checkForStaleObjects(
     const Data& data) {
+  LIBREPCB_TRACE_FUNCTION("drc");
   RuleCheckMessageList messages;
   emitStatus(tr("Check for stale objects..."));
   for (const Data::Segment& ns : data.segments) {
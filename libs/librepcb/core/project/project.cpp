@@ -26,13 +26,18 @@
 #include "../exceptions.h"
 #include "../fileio/directorylock.h"
 #include "../fileio/fileutils.h"
+#include "../fileio/transactionalfilesystem.h"
 #include "../fileio/versionfile.h"
 #include "../font/strokefontpool.h"
 #include "../serialization/sexpression.h"
+#include "../utils/memoryreport.h"
+#include "../utils/tracer.h"
 #include "board/board.h"
 #include "board/items/bi_polygon.h"
 #include "circuit/circuit.h"
+#include "circuit/componentinstance.h"
 #include "circuit/netclass.h"
+#include "circuit/netsignal.h"
 #include "projectlibrary.h"
 #include "schematic/schematic.h"
 
@@ -183,7 +188,7 @@ void Project::setDefaultLockComponentAssembly(bool newLock) noexcept {
 }
 
 bool Project::setErcMessageApprovals(
-    const QSet<SExpression>& approvals) noexcept {
+    const QSet<RuleCheckApproval>& approvals) noexcept {
   if (approvals != mErcMessageApprovals) {
     mErcMessageApprovals = approvals;
     emit ercMessageApprovalsChanged(mErcMessageApprovals);
@@ -369,6 +374,7 @@ void Project::removeBoard(Board& board, bool deleteBoard) {
  ******************************************************************************/
 
 void Project::save() {
+  LIBREPCB_TRACE_SCOPE("project", "save");
   qDebug() << "Save project files to transactional file system...";
 
   // Version file.
@@ -379,6 +385,17 @@ void Project::save() {
   // Project file.
   mDirectory->write(mFilename, "LIBREPCB-PROJECT");
 
+  // All other files.
+  write(*mDirectory, serialize());  // can throw
+
+  // Update the datetime attribute of the project.
+  updateDateTime();
+}
+
+Project::SerializedFiles Project::serialize() {
+  LIBREPCB_TRACE_SCOPE("project", "serialize");
+  SerializedFiles files;
+
   // Metadata.
   {
     std::unique_ptr<SExpression> root =
@@ -395,7 +412,7 @@ void Project::save() {
     root->ensureLineBreak();
     mAttributes.serialize(*root);
     root->ensureLineBreak();
-    mDirectory->write("project/metadata.lp", root->toByteArray());
+    files.insert("project/metadata.lp", std::move(root));
   }
 
   // Settings.
@@ -433,7 +450,7 @@ void Project::save() {
     root->appendChild("default_lock_component_assembly",
                       mDefaultLockComponentAssembly);
     root->ensureLineBreak();
-    mDirectory->write("project/settings.lp", root->toByteArray());
+    files.insert("project/settings.lp", std::move(root));
   }
 
   // Output jobs.
@@ -443,7 +460,7 @@ void Project::save() {
     root->ensureLineBreak();
     mOutputJobs.serialize(*root);
     root->ensureLineBreak();
-    mDirectory->write("project/jobs.lp", root->toByteArray());
+    files.insert("project/jobs.lp", std::move(root));
   }
 
   // Circuit.
@@ -451,19 +468,19 @@ void Project::save() {
     std::unique_ptr<SExpression> root =
         SExpression::createList("librepcb_circuit");
     mCircuit->serialize(*root);
-    mDirectory->write("circuit/circuit.lp", root->toByteArray());
+    files.insert("circuit/circuit.lp", std::move(root));
   }
 
   // ERC.
   {
     std::unique_ptr<SExpression> root = SExpression::createList("librepcb_erc");
-    foreach (const SExpression& node,
+    foreach (const RuleCheckApproval& approval,
              Toolbox::sortedQSet(mErcMessageApprovals)) {
       root->ensureLineBreak();
-      root->appendChild(node);
+      root->appendChild(approval.getNode());
     }
     root->ensureLineBreak();
-    mDirectory->write("circuit/erc.lp", root->toByteArray());
+    files.insert("circuit/erc.lp", std::move(root));
   }
 
   // Schematics.
@@ -475,10 +492,14 @@ void Project::save() {
       root->appendChild(
           "schematic",
           "schematics/" + schematic->getDirectoryName() + "/schematic.lp");
-      schematic->save();
+      const QString dir = "schematics/" + schematic->getDirectoryName() + "/";
+      const SerializedFiles schematicFiles = schematic->serialize();
+      for (auto it = schematicFiles.begin(); it != schematicFiles.end(); it++) {
+        files.insert(dir + it.key(), it.value());
+      }
     }
     root->ensureLineBreak();
-    mDirectory->write("schematics/schematics.lp", root->toByteArray());
+    files.insert("schematics/schematics.lp", std::move(root));
   }
 
   // Boards.
@@ -489,14 +510,54 @@ void Project::save() {
       root->ensureLineBreak();
       root->appendChild("board",
                         "boards/" + board->getDirectoryName() + "/board.lp");
-      board->save();
+      const QString dir = "boards/" + board->getDirectoryName() + "/";
+      const SerializedFiles boardFiles = board->serialize();
+      for (auto it = boardFiles.begin(); it != boardFiles.end(); it++) {
+        files.insert(dir + it.key(), it.value());
+      }
     }
     root->ensureLineBreak();
-    mDirectory->write("boards/boards.lp", root->toByteArray());
+    files.insert("boards/boards.lp", std::move(root));
   }
 
-  // Update the datetime attribute of the project.
-  updateDateTime();
+  return files;
+}
+
+void Project::write(TransactionalDirectory& dir, const SerializedFiles& files) {
+  LIBREPCB_TRACE_SCOPE("project", "write");
+  for (auto it = files.begin(); it != files.end(); it++) {
+    dir.write(it.key(), it.value()->toByteArray());  // can throw
+  }
+}
+
+void Project::reportMemoryUsage(MemoryReport& report) const noexcept {
+  const qint64 overhead = MemoryReport::getAllocationOverhead();
+  report.add("Project", sizeof(Project));
+  const int netClasses = mCircuit->getNetClasses().count();
+  report.add("Circuit/Net classes", netClasses * (sizeof(NetClass) + overhead),
+             netClasses);
+  const int netSignals = mCircuit->getNetSignals().count();
+  report.add("Circuit/Net signals",
+             netSignals * (sizeof(NetSignal) + overhead), netSignals);
+  const int components = mCircuit->getComponentInstances().count();
+  report.add("Circuit/Components",
+             components * (sizeof(ComponentInstance) + overhead), components);
+  foreach (const RuleCheckApproval& approval, mErcMessageApprovals) {
+    report.add("ERC approvals", approval.getNode().getApproxMemoryUsage());
+  }
+  // Note: Slashes are replaced since they separate the report categories.
+  foreach (const Schematic* schematic, mSchematics) {
+    schematic->reportMemoryUsage(
+        report,
+        QString("Schematic '%1'").arg(*schematic->getName()).replace('/', '_'));
+  }
+  foreach (const Board* board, mBoards) {
+    board->reportMemoryUsage(
+        report, QString("Board '%1'").arg(*board->getName()).replace('/', '_'));
+  }
+  mProjectLibrary->reportMemoryUsage(report, "Library");
+  report.add("Files in memory",
+             mDirectory->getFileSystem()->getApproxMemoryUsage());
 }
 
 /*******************************************************************************
@@ -27,6 +27,7 @@
 #include "../fileio/directorylock.h"
 #include "../fileio/transactionaldirectory.h"
 #include "../job/outputjob.h"
+#include "../rulecheck/rulecheckapproval.h"
 #include "../types/elementname.h"
 #include "../types/fileproofname.h"
 #include "../types/uuid.h"
@@ -41,7 +42,9 @@ namespace librepcb {
 
 class Board;
 class Circuit;
+class MemoryReport;
 class ProjectLibrary;
+class SExpression;
 class Schematic;
 class StrokeFontPool;
 
@@ -72,6 +75,11 @@ class Project final : public QObject {
   Q_OBJECT
 
 public:
+  // Types
+
+  /// File paths (relative to the project directory) and their content
+  typedef QMap<QString, std::shared_ptr<const SExpression>> SerializedFiles;
+
   // Constructors / Destructor
   Project() = delete;
   Project(const Project& other) = delete;
@@ -250,7 +258,7 @@ public:
    *
    * @return Approval nodes
    */
-  const QSet<SExpression>& getErcMessageApprovals() const noexcept {
+  const QSet<RuleCheckApproval>& getErcMessageApprovals() const noexcept {
     return mErcMessageApprovals;
   }
 
@@ -350,7 +358,8 @@ public:
    * @retval false      If approvals have not been modified (no change)
    * @retval true       If approvals have been moified
    */
-  bool setErcMessageApprovals(const QSet<SExpression>& approvals) noexcept;
+  bool setErcMessageApprovals(
+      const QSet<RuleCheckApproval>& approvals) noexcept;
 
   // Schematic Methods
 
@@ -498,6 +507,44 @@ public:
    */
   void save();
 
+  /**
+   * @brief Serialize the project without writing it to the file system
+   *
+   * Creates the S-Expression trees of all files written by #save(), except
+   * the version file and the project file. The trees are a snapshot which is
+   * independent of this object, so they can be converted to file content
+   * with #write() in a worker thread while the project is being modified.
+   *
+   * @return All serialized files.
+   *
+   * @throw Exception     If an error occurred.
+   */
+  SerializedFiles serialize();
+
+  /**
+   * @brief Write serialized files to a (transactional) directory
+   *
+   * @note  This method does not access any project, so it can be called
+   *        from any thread.
+   *
+   * @param dir       The project directory to write the files into.
+   * @param files     The files, as returned by #serialize().
+   *
+   * @throw Exception     If an error occurred.
+   */
+  static void write(TransactionalDirectory& dir, const SerializedFiles& files);
+
+  /**
+   * @brief Add the approximate memory footprint of the whole project to a
+   *        report
+   *
+   * Each schematic, each board and the project library get their own
+   * top-level category with a breakdown of their content.
+   *
+   * @param report  The report to add the numbers to.
+   */
+  void reportMemoryUsage(MemoryReport& report) const noexcept;
+
   // Operator Overloadings
   bool operator==(const Project& rhs) noexcept { return (this == &rhs); }
   bool operator!=(const Project& rhs) noexcept { return (this != &rhs); }
@@ -525,7 +572,7 @@ signals:
    *
    * @param approvals   The new approvals
    */
-  void ercMessageApprovalsChanged(const QSet<SExpression>& approvals);
+  void ercMessageApprovalsChanged(const QSet<RuleCheckApproval>& approvals);
 
   /**
    * @brief This signal is emitted after a schematic was added to the project
@@ -632,7 +679,7 @@ private:  // Data
   QList<Board*> mRemovedBoards;
 
   /// All approved ERC messages
-  QSet<SExpression> mErcMessageApprovals;
+  QSet<RuleCheckApproval> mErcMessageApprovals;
 
   // Cached properties
   QPointer<Board> mPrimaryBoard;
@@ -22,11 +22,14 @@
  ******************************************************************************/
 #include "projectlibrary.h"
 
+#include "../exceptions.h"
 #include "../fileio/transactionalfilesystem.h"
 #include "../library/cmp/component.h"
 #include "../library/dev/device.h"
+#include "../library/librarybaseelement.h"
 #include "../library/pkg/package.h"
 #include "../library/sym/symbol.h"
+#include "../utils/memoryreport.h"
 
 #include <QtCore>
 
@@ -49,6 +52,42 @@ ProjectLibrary::~ProjectLibrary() noexcept {
   mAllElements.clear();
 }
 
+/*******************************************************************************
+ *  Getters: Library Elements
+ ******************************************************************************/
+
+const QHash<Uuid, Symbol*>& ProjectLibrary::getSymbols() const noexcept {
+  return getElements(mSymbols, mLazySymbols);
+}
+
+const QHash<Uuid, Package*>& ProjectLibrary::getPackages() const noexcept {
+  return getElements(mPackages, mLazyPackages);
+}
+
+const QHash<Uuid, Component*>& ProjectLibrary::getComponents() const noexcept {
+  return getElements(mComponents, mLazyComponents);
+}
+
+const QHash<Uuid, Device*>& ProjectLibrary::getDevices() const noexcept {
+  return getElements(mDevices, mLazyDevices);
+}
+
+Symbol* ProjectLibrary::getSymbol(const Uuid& uuid) const noexcept {
+  return getElement(uuid, mSymbols, mLazySymbols);
+}
+
+Package* ProjectLibrary::getPackage(const Uuid& uuid) const noexcept {
+  return getElement(uuid, mPackages, mLazyPackages);
+}
+
+Component* ProjectLibrary::getComponent(const Uuid& uuid) const noexcept {
+  return getElement(uuid, mComponents, mLazyComponents);
+}
+
+Device* ProjectLibrary::getDevice(const Uuid& uuid) const noexcept {
+  return getElement(uuid, mDevices, mLazyDevices);
+}
+
 /*******************************************************************************
  *  Getters: Special Queries
  ******************************************************************************/
@@ -56,7 +95,7 @@ ProjectLibrary::~ProjectLibrary() noexcept {
 QHash<Uuid, Device*> ProjectLibrary::getDevicesOfComponent(
     const Uuid& compUuid) const noexcept {
   QHash<Uuid, Device*> list;
-  foreach (Device* device, mDevices) {
+  foreach (Device* device, getDevices()) {
     if (device->getComponentUuid() == compUuid) {
       list.insert(device->getUuid(), device);
     }
@@ -69,19 +108,19 @@ QHash<Uuid, Device*> ProjectLibrary::getDevicesOfComponent(
  ******************************************************************************/
 
 void ProjectLibrary::addSymbol(Symbol& s) {
-  addElement<Symbol>(s, mSymbols);
+  addElement<Symbol>(s, mSymbols, mLazySymbols);
 }
 
 void ProjectLibrary::addPackage(Package& p) {
-  addElement<Package>(p, mPackages);
+  addElement<Package>(p, mPackages, mLazyPackages);
 }
 
 void ProjectLibrary::addComponent(Component& c) {
-  addElement<Component>(c, mComponents);
+  addElement<Component>(c, mComponents, mLazyComponents);
 }
 
 void ProjectLibrary::addDevice(Device& d) {
-  addElement<Device>(d, mDevices);
+  addElement<Device>(d, mDevices, mLazyDevices);
 }
 
 void ProjectLibrary::removeSymbol(Symbol& s) {
@@ -100,14 +139,149 @@ void ProjectLibrary::removeDevice(Device& d) {
   removeElement<Device>(d, mDevices);
 }
 
+void ProjectLibrary::addElementsLazily() {
+  addElementsLazily<Symbol>(mSymbols, mLazySymbols);
+  addElementsLazily<Package>(mPackages, mLazyPackages);
+  addElementsLazily<Component>(mComponents, mLazyComponents);
+  addElementsLazily<Device>(mDevices, mLazyDevices);
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void ProjectLibrary::throwLoadError() const {
+  QMutexLocker lock(&mLazyLoadMutex);
+  if (mLoadError) {
+    mLoadError->raise();
+  }
+}
+
+void ProjectLibrary::reportMemoryUsage(
+    MemoryReport& report, const QString& category) const noexcept {
+  // Note: Elements which are not loaded yet don't use any memory, thus they
+  // are intentionally not loaded here.
+  QMutexLocker lock(&mLazyLoadMutex);
+  foreach (const Symbol* symbol, mSymbols) {
+    report.add(category % "/Symbols", symbol->getApproxMemoryUsage());
+  }
+  foreach (const Package* package, mPackages) {
+    report.add(category % "/Packages", package->getApproxMemoryUsage());
+  }
+  foreach (const Component* component, mComponents) {
+    report.add(category % "/Components", component->getApproxMemoryUsage());
+  }
+  foreach (const Device* device, mDevices) {
+    report.add(category % "/Devices", device->getApproxMemoryUsage());
+  }
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
 
+template <typename ElementType>
+const QHash<Uuid, ElementType*>& ProjectLibrary::getElements(
+    QHash<Uuid, ElementType*>& elements,
+    QHash<Uuid, QString>& lazyElements) const noexcept {
+  QMutexLocker lock(&mLazyLoadMutex);
+  foreach (const Uuid& uuid, lazyElements.keys()) {
+    loadElement(uuid, elements, lazyElements);
+  }
+  return elements;
+}
+
+template <typename ElementType>
+ElementType* ProjectLibrary::getElement(
+    const Uuid& uuid, QHash<Uuid, ElementType*>& elements,
+    QHash<Uuid, QString>& lazyElements) const noexcept {
+  QMutexLocker lock(&mLazyLoadMutex);
+  if (ElementType* element = elements.value(uuid)) {
+    return element;
+  } else {
+    return loadElement(uuid, elements, lazyElements);
+  }
+}
+
+template <typename ElementType>
+ElementType* ProjectLibrary::loadElement(
+    const Uuid& uuid, QHash<Uuid, ElementType*>& elements,
+    QHash<Uuid, QString>& lazyElements) const noexcept {
+  // Note: The mutex must already be locked by the caller!
+  const QString path = lazyElements.take(uuid);
+  if (path.isEmpty()) {
+    return nullptr;
+  }
+  try {
+    std::unique_ptr<ElementType> element =
+        ElementType::open(std::unique_ptr<TransactionalDirectory>(
+            new TransactionalDirectory(*mDirectory, path)));  // can throw
+    if (element->getUuid() != uuid) {
+      throw RuntimeError(
+          __FILE__, __LINE__,
+          QString("UUID mismatch between directory name and library "
+                  "element: %1")
+              .arg(element->getDirectory().getAbsPath().toNative()));
+    }
+    ElementType* ptr = element.release();
+    elements.insert(uuid, ptr);
+    mAllElements.insert(ptr);
+    return ptr;
+  } catch (const Exception& e) {
+    qCritical().noquote() << "Failed to load library element from project "
+                             "library:"
+                          << e.getMsg();
+    if (!mLoadError) {
+      mLoadError.reset(e.clone());
+    }
+    return nullptr;
+  }
+}
+
+template <typename ElementType>
+void ProjectLibrary::addElementsLazily(QHash<Uuid, ElementType*>& elements,
+                                       QHash<Uuid, QString>& lazyElements) {
+  // Search all subdirectories which have a valid UUID as directory name.
+  const QString dirName = ElementType::getShortElementName();
+  int count = 0;
+  foreach (const QString& sub, mDirectory->getDirs(dirName)) {
+    const QString path = dirName % "/" % sub;
+    std::unique_ptr<TransactionalDirectory> dir(
+        new TransactionalDirectory(*mDirectory, path));
+
+    // Check if directory is a valid library element.
+    if (!LibraryBaseElement::isValidElementDirectory<ElementType>(*dir, "")) {
+      qWarning() << "Invalid directory in project library, ignoring it:"
+                 << dir->getAbsPath().toNative();
+      continue;
+    }
+
+    // Register the library element, or load it immediately if the directory
+    // name is not a UUID (should not happen).
+    const tl::optional<Uuid> uuid = Uuid::tryFromString(sub);
+    if (uuid && (!elements.contains(*uuid)) &&
+        (!lazyElements.contains(*uuid))) {
+      QMutexLocker lock(&mLazyLoadMutex);
+      lazyElements.insert(*uuid, path);
+    } else {
+      ElementType* element =
+          ElementType::open(std::move(dir)).release();  // can throw
+      addElement(*element, elements, lazyElements);  // can throw
+    }
+    ++count;
+  }
+
+  qDebug().nospace().noquote()
+      << "Registered " << count << " " << dirName << " elements.";
+}
+
 template <typename ElementType>
 void ProjectLibrary::addElement(ElementType& element,
-                                QHash<Uuid, ElementType*>& elementList) {
-  if (elementList.contains(element.getUuid())) {
+                                QHash<Uuid, ElementType*>& elementList,
+                                const QHash<Uuid, QString>& lazyElements) {
+  QMutexLocker lock(&mLazyLoadMutex);
+  if (elementList.contains(element.getUuid()) ||
+      lazyElements.contains(element.getUuid())) {
     throw LogicError(__FILE__, __LINE__,
                      QString("There is already an element with the same "
                              "UUID in the project's library: %1")
@@ -130,6 +304,7 @@ void ProjectLibrary::addElement(ElementType& element,
 template <typename ElementType>
 void ProjectLibrary::removeElement(ElementType& element,
                                    QHash<Uuid, ElementType*>& elementList) {
+  QMutexLocker lock(&mLazyLoadMutex);
   Q_ASSERT(elementList.value(element.getUuid()) == &element);
   Q_ASSERT(mAllElements.contains(&element));
   TransactionalDirectory tmpDir;
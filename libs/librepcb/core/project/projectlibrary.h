@@ -37,7 +37,9 @@ namespace librepcb {
 
 class Component;
 class Device;
+class Exception;
 class LibraryBaseElement;
+class MemoryReport;
 class Package;
 class Project;
 class Symbol;
@@ -48,6 +50,15 @@ class Symbol;
 
 /**
  * @brief The ProjectLibrary class
+ *
+ * Library elements can either be added fully loaded (e.g. #addSymbol()), or
+ * be registered by #addElementsLazily() without loading them. Such elements
+ * are loaded on first access (e.g. by #getSymbol() or #getSymbols()), which
+ * is thread-safe. Thus unused elements never need to be parsed.
+ *
+ * Since the getters cannot throw, an element which fails to load on first
+ * access is treated as not existing, and the error is recorded to be raised
+ * later by #throwLoadError().
  */
 class ProjectLibrary final : public QObject {
   Q_OBJECT
@@ -63,26 +74,14 @@ public:
   TransactionalDirectory& getDirectory() const { return *mDirectory; }
 
   // Getters: Library Elements
-  const QHash<Uuid, Symbol*>& getSymbols() const noexcept { return mSymbols; }
-  const QHash<Uuid, Package*>& getPackages() const noexcept {
-    return mPackages;
-  }
-  const QHash<Uuid, Component*>& getComponents() const noexcept {
-    return mComponents;
-  }
-  const QHash<Uuid, Device*>& getDevices() const noexcept { return mDevices; }
-  Symbol* getSymbol(const Uuid& uuid) const noexcept {
-    return mSymbols.value(uuid);
-  }
-  Package* getPackage(const Uuid& uuid) const noexcept {
-    return mPackages.value(uuid);
-  }
-  Component* getComponent(const Uuid& uuid) const noexcept {
-    return mComponents.value(uuid);
-  }
-  Device* getDevice(const Uuid& uuid) const noexcept {
-    return mDevices.value(uuid);
-  }
+  const QHash<Uuid, Symbol*>& getSymbols() const noexcept;
+  const QHash<Uuid, Package*>& getPackages() const noexcept;
+  const QHash<Uuid, Component*>& getComponents() const noexcept;
+  const QHash<Uuid, Device*>& getDevices() const noexcept;
+  Symbol* getSymbol(const Uuid& uuid) const noexcept;
+  Package* getPackage(const Uuid& uuid) const noexcept;
+  Component* getComponent(const Uuid& uuid) const noexcept;
+  Device* getDevice(const Uuid& uuid) const noexcept;
 
   // Getters: Special Queries
   QHash<Uuid, Device*> getDevicesOfComponent(
@@ -98,13 +97,54 @@ public:
   void removeComponent(Component& c);
   void removeDevice(Device& d);
 
+  /**
+   * @brief Register all library elements in the directory without loading them
+   *
+   * Each element is loaded from its directory on first access, without
+   * modifying any files. Directories which are not named by a valid UUID are
+   * loaded immediately.
+   *
+   * @throw Exception if an element could not be loaded immediately.
+   */
+  void addElementsLazily();
+
+  // General Methods
+
+  /**
+   * @brief Raise the error of the first lazily loaded element which failed
+   *
+   * Does nothing if all elements accessed so far were loaded successfully.
+   *
+   * @throw Exception The error which occurred while loading the element.
+   */
+  void throwLoadError() const;
+
+  void reportMemoryUsage(MemoryReport& report,
+                         const QString& category) const noexcept;
+
   // Operator Overloadings
   ProjectLibrary& operator=(const ProjectLibrary& rhs) = delete;
 
 private:
   // Private Methods
   template <typename ElementType>
-  void addElement(ElementType& element, QHash<Uuid, ElementType*>& elementList);
+  const QHash<Uuid, ElementType*>& getElements(
+      QHash<Uuid, ElementType*>& elements,
+      QHash<Uuid, QString>& lazyElements) const noexcept;
+  template <typename ElementType>
+  ElementType* getElement(const Uuid& uuid,
+                          QHash<Uuid, ElementType*>& elements,
+                          QHash<Uuid, QString>& lazyElements) const noexcept;
+  template <typename ElementType>
+  ElementType* loadElement(const Uuid& uuid,
+                           QHash<Uuid, ElementType*>& elements,
+                           QHash<Uuid, QString>& lazyElements) const noexcept;
+  template <typename ElementType>
+  void addElementsLazily(QHash<Uuid, ElementType*>& elements,
+                         QHash<Uuid, QString>& lazyElements);
+  template <typename ElementType>
+  void addElement(ElementType& element, QHash<Uuid, ElementType*>& elementList,
+                  const QHash<Uuid, QString>& lazyElements);
   template <typename ElementType>
   void removeElement(ElementType& element,
                      QHash<Uuid, ElementType*>& elementList);
@@ -112,13 +152,21 @@ private:
   // General
   std::unique_ptr<TransactionalDirectory> mDirectory;
 
-  // The currently added library elements
-  QHash<Uuid, Symbol*> mSymbols;
-  QHash<Uuid, Package*> mPackages;
-  QHash<Uuid, Component*> mComponents;
-  QHash<Uuid, Device*> mDevices;
-
-  QSet<LibraryBaseElement*> mAllElements;
+  // The currently added (and loaded) library elements
+  mutable QHash<Uuid, Symbol*> mSymbols;
+  mutable QHash<Uuid, Package*> mPackages;
+  mutable QHash<Uuid, Component*> mComponents;
+  mutable QHash<Uuid, Device*> mDevices;
+
+  // Library elements not loaded yet (UUID -> relative directory path)
+  mutable QHash<Uuid, QString> mLazySymbols;
+  mutable QHash<Uuid, QString> mLazyPackages;
+  mutable QHash<Uuid, QString> mLazyComponents;
+  mutable QHash<Uuid, QString> mLazyDevices;
+  mutable QMutex mLazyLoadMutex;  ///< Protects all element containers
+  mutable std::unique_ptr<Exception> mLoadError;  ///< First load error
+
+  mutable QSet<LibraryBaseElement*> mAllElements;
 };
 
 /*******************************************************************************
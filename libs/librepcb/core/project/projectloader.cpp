@@ -31,6 +31,7 @@
 #include "../library/sym/symbol.h"
 #include "../serialization/fileformatmigration.h"
 #include "../types/pcbcolor.h"
+#include "../utils/tracer.h"
 #include "board/board.h"
 #include "board/boarddesignrules.h"
 #include "board/boardfabricationoutputsettings.h"
@@ -77,7 +78,9 @@ namespace librepcb {
  ******************************************************************************/
 
 ProjectLoader::ProjectLoader(QObject* parent) noexcept
-  : QObject(parent), mAutoAssignDeviceModels(false) {
+  : QObject(parent),
+    mAutoAssignDeviceModels(false),
+    mLazyLibraryLoading(true) {
 }
 
 ProjectLoader::~ProjectLoader() noexcept {
@@ -90,6 +93,7 @@ ProjectLoader::~ProjectLoader() noexcept {
 std::unique_ptr<Project> ProjectLoader::open(
     std::unique_ptr<TransactionalDirectory> directory,
     const QString& filename) {
+  LIBREPCB_TRACE_SCOPE_DETAIL("project", "open", filename);
   Q_ASSERT(directory);
   mUpgradeMessages = tl::nullopt;
 
@@ -143,17 +147,26 @@ std::unique_ptr<Project> ProjectLoader::open(
   loadSettings(*p);
   loadOutputJobs(*p);
   loadLibrary(*p);
-  loadCircuit(*p);
-  loadErc(*p);
-  loadSchematics(*p);
-  loadBoards(*p);
+  try {
+    loadCircuit(*p);
+    loadErc(*p);
+    loadSchematics(*p);
+    loadBoards(*p);
+  } catch (const Exception&) {
+    // A missing library element might be caused by a broken element which
+    // failed to load lazily, so report that root cause instead, if any.
+    p->getLibrary().throwLoadError();  // can throw
+    throw;
+  }
+  p->getLibrary().throwLoadError();  // can throw
 
   // If the file format was migrated, clean up obsolete ERC messages.
   if (mUpgradeMessages) {
     qInfo() << "Running ERC to clean up obsolete message approvals...";
     ElectricalRuleCheck erc(*p);
     const RuleCheckMessageList msgs = erc.runChecks();
-    const QSet<SExpression> approvals = RuleCheckMessage::getAllApprovals(msgs);
+    const QSet<RuleCheckApproval> approvals =
+        RuleCheckMessage::getAllApprovals(msgs);
     p->setErcMessageApprovals(p->getErcMessageApprovals() & approvals);
   }
 
@@ -237,14 +250,23 @@ void ProjectLoader::loadOutputJobs(Project& p) {
 }
 
 void ProjectLoader::loadLibrary(Project& p) {
+  LIBREPCB_TRACE_FUNCTION("project");
   qDebug() << "Load project library...";
 
-  loadLibraryElements<Symbol>(p, "sym", "symbols", &ProjectLibrary::addSymbol);
-  loadLibraryElements<Package>(p, "pkg", "packages",
-                               &ProjectLibrary::addPackage);
-  loadLibraryElements<Component>(p, "cmp", "components",
-                                 &ProjectLibrary::addComponent);
-  loadLibraryElements<Device>(p, "dev", "devices", &ProjectLibrary::addDevice);
+  // After a file format upgrade, all elements need to be loaded to rewrite
+  // their files. Otherwise they are loaded only when they are needed.
+  if (mUpgradeMessages || (!mLazyLibraryLoading)) {
+    loadLibraryElements<Symbol>(p, "sym", "symbols",
+                                &ProjectLibrary::addSymbol);
+    loadLibraryElements<Package>(p, "pkg", "packages",
+                                 &ProjectLibrary::addPackage);
+    loadLibraryElements<Component>(p, "cmp", "components",
+                                   &ProjectLibrary::addComponent);
+    loadLibraryElements<Device>(p, "dev", "devices",
+                                &ProjectLibrary::addDevice);
+  } else {
+    p.getLibrary().addElementsLazily();  // can throw
+  }
 
   qDebug() << "Successfully loaded project library.";
 }
@@ -278,6 +300,7 @@ void ProjectLoader::loadLibraryElements(
 }
 
 void ProjectLoader::loadCircuit(Project& p) {
+  LIBREPCB_TRACE_FUNCTION("project");
   qDebug() << "Load circuit...";
   const QString fp = "circuit/circuit.lp";
   const std::unique_ptr<const SExpression> root = SExpression::parse(
@@ -379,15 +402,16 @@ void ProjectLoader::loadCircuit(Project& p) {
 }
 
 void ProjectLoader::loadErc(Project& p) {
+  LIBREPCB_TRACE_FUNCTION("project");
   qDebug() << "Load ERC approvals...";
   const QString fp = "circuit/erc.lp";
   const std::unique_ptr<const SExpression> root = SExpression::parse(
       p.getDirectory().read(fp), p.getDirectory().getAbsPath(fp));
 
   // Load approvals.
-  QSet<SExpression> approvals;
+  QSet<RuleCheckApproval> approvals;
   foreach (const SExpression* node, root->getChildren("approved")) {
-    approvals.insert(*node);
+    approvals.insert(RuleCheckApproval(*node));
   }
   p.setErcMessageApprovals(approvals);
 
@@ -407,6 +431,7 @@ void ProjectLoader::loadSchematics(Project& p) {
 }
 
 void ProjectLoader::loadSchematic(Project& p, const QString& relativeFilePath) {
+  LIBREPCB_TRACE_SCOPE_DETAIL("project", "loadSchematic", relativeFilePath);
   const FilePath fp = FilePath::fromRelative(p.getPath(), relativeFilePath);
   std::unique_ptr<TransactionalDirectory> dir(new TransactionalDirectory(
       p.getDirectory(), fp.getParentDir().toRelative(p.getPath())));
@@ -553,6 +578,7 @@ void ProjectLoader::loadBoards(Project& p) {
 }
 
 void ProjectLoader::loadBoard(Project& p, const QString& relativeFilePath) {
+  LIBREPCB_TRACE_SCOPE_DETAIL("project", "loadBoard", relativeFilePath);
   const FilePath fp = FilePath::fromRelative(p.getPath(), relativeFilePath);
   std::unique_ptr<TransactionalDirectory> dir(new TransactionalDirectory(
       p.getDirectory(), fp.getParentDir().toRelative(p.getPath())));
@@ -597,9 +623,9 @@ void ProjectLoader::loadBoard(Project& p, const QString& relativeFilePath) {
     const SExpression& node = root->getChild("design_rule_check");
     const Version approvalsVersion =
         deserialize<Version>(node.getChild("approvals_version/@0"));
-    QSet<SExpression> approvals;
+    QSet<RuleCheckApproval> approvals;
     foreach (const SExpression* child, node.getChildren("approved")) {
-      approvals.insert(*child);
+      approvals.insert(RuleCheckApproval(*child));
     }
     board->setDrcSettings(BoardDesignRuleCheckSettings(node));
     board->loadDrcMessageApprovals(approvalsVersion, approvals);
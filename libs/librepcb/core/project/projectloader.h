@@ -64,6 +64,17 @@ public:
     mAutoAssignDeviceModels = v;
   }
 
+  /**
+   * @brief Enable or disable lazy loading of the project library elements
+   *
+   * Enabled by default. If disabled, all library elements are loaded and
+   * re-serialized while opening the project, which is needed to detect
+   * non-canonical library element files.
+   *
+   * @param v   Whether to load library elements lazily.
+   */
+  void setLazyLibraryLoading(bool v) noexcept { mLazyLibraryLoading = v; }
+
   // General Methods
   std::unique_ptr<Project> open(
       std::unique_ptr<TransactionalDirectory> directory,
@@ -100,6 +111,7 @@ private:  // Methods
 
 private:  // Data
   bool mAutoAssignDeviceModels;
+  bool mLazyLibraryLoading;
   tl::optional<QList<FileFormatMigration::Message>> mUpgradeMessages;
 };
 
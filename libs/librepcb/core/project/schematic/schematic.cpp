@@ -27,6 +27,7 @@
 #include "../../geometry/polygon.h"
 #include "../../library/sym/symbolpin.h"
 #include "../../serialization/sexpression.h"
+#include "../../utils/memoryreport.h"
 #include "../../utils/scopeguardlist.h"
 #include "../project.h"
 #include "items/si_netlabel.h"
@@ -291,7 +292,8 @@ void Schematic::removeFromProject() {
   sgl.dismiss();
 }
 
-void Schematic::save() {
+QMap<QString, std::shared_ptr<const SExpression>> Schematic::serialize()
+    const {
   std::unique_ptr<SExpression> root =
       SExpression::createList("librepcb_schematic");
   root->appendChild(mUuid);
@@ -322,7 +324,44 @@ void Schematic::save() {
     obj->getTextObj().serialize(root->appendList("text"));
   }
   root->ensureLineBreak();
-  mDirectory->write("schematic.lp", root->toByteArray());
+  QMap<QString, std::shared_ptr<const SExpression>> files;
+  files.insert("schematic.lp", std::move(root));
+  return files;
+}
+
+void Schematic::reportMemoryUsage(MemoryReport& report,
+                                  const QString& category) const noexcept {
+  const qint64 overhead = MemoryReport::getAllocationOverhead();
+  report.add(category % "/General", sizeof(Schematic));
+  foreach (const SI_Symbol* symbol, mSymbols) {
+    qint64 bytes = sizeof(SI_Symbol) + overhead +
+        symbol->getPins().count() * (sizeof(SI_SymbolPin) + overhead);
+    foreach (const SI_Text* text, symbol->getTexts()) {
+      bytes += sizeof(SI_Text) + overhead +
+          MemoryReport::estimate(text->getText());
+    }
+    report.add(category % "/Symbols", bytes);
+  }
+  foreach (const SI_NetSegment* netSegment, mNetSegments) {
+    report.add(category % "/Net segments",
+               sizeof(SI_NetSegment) + overhead +
+                   netSegment->getNetPoints().count() *
+                       (sizeof(SI_NetPoint) + overhead) +
+                   netSegment->getNetLines().count() *
+                       (sizeof(SI_NetLine) + overhead) +
+                   netSegment->getNetLabels().count() *
+                       (sizeof(SI_NetLabel) + overhead));
+  }
+  foreach (const SI_Polygon* polygon, mPolygons) {
+    report.add(category % "/Polygons",
+               sizeof(SI_Polygon) + overhead +
+                   polygon->getPolygon().getApproxMemoryUsage());
+  }
+  foreach (const SI_Text* text, mTexts) {
+    report.add(category % "/Texts",
+               sizeof(SI_Text) + overhead +
+                   MemoryReport::estimate(text->getText()));
+  }
 }
 
 void Schematic::updateAllNetLabelAnchors() noexcept {
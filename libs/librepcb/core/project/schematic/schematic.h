@@ -39,9 +39,11 @@
 namespace librepcb {
 
 class ComponentInstance;
+class MemoryReport;
 class NetSignal;
 class Point;
 class Project;
+class SExpression;
 class SI_Base;
 class SI_NetLabel;
 class SI_NetLine;
@@ -131,7 +133,17 @@ public:
   // General Methods
   void addToProject();
   void removeFromProject();
-  void save();
+
+  /**
+   * @brief Serialize this object into its files
+   *
+   * @return File paths (relative to the directory of this object) and their
+   *         content.
+   */
+  QMap<QString, std::shared_ptr<const SExpression>> serialize() const;
+
+  void reportMemoryUsage(MemoryReport& report,
+                         const QString& category) const noexcept;
   void updateAllNetLabelAnchors() noexcept;
 
   // Operator Overloadings
@@ -82,15 +82,69 @@ QList<SchematicNetSegmentSplitter::Segment>
     SchematicNetSegmentSplitter::split() noexcept {
   QList<Segment> segments;
 
-  // Split netsegment by anchors and lines
-  NetLineList availableNetLines = mNetLines;
-  while (!availableNetLines.isEmpty()) {
+  // Build an index of the netlines connected to each anchor, in input order
+  QHash<NetLineAnchor, QVector<int>> anchorNetLines;
+  for (int i = 0; i < mNetLines.count(); ++i) {
+    anchorNetLines[mNetLines.at(i)->getStartPoint()].append(i);
+    anchorNetLines[mNetLines.at(i)->getEndPoint()].append(i);
+  }
+
+  // Split netsegment by anchors and lines. This is a depth-first search
+  // which visits the items in the same order as a recursive implementation
+  // would (start point before end point of each netline, connected netlines
+  // in input order), but with an explicit stack to support long segments.
+  struct Visit {
+    int netLine;  ///< Index of the netline whose start or end point is visited
+    bool endPoint;
+    const QVector<int>* connectedNetLines;  ///< nullptr if not entered yet
+    int nextConnectedNetLine;
+  };
+  QVector<bool> usedNetLines(mNetLines.count(), false);
+  QSet<Uuid> usedJunctions;
+  QVector<Visit> stack;
+  for (int i = 0; i < mNetLines.count(); ++i) {
+    if (usedNetLines.at(i)) {
+      continue;
+    }
     Segment segment;
-    findConnectedLinesAndPoints(availableNetLines.first()->getStartPoint(),
-                                availableNetLines, segment);
+    stack.append(Visit{i, false, nullptr, 0});
+    while (!stack.isEmpty()) {
+      Visit& visit = stack.last();
+      if (!visit.connectedNetLines) {
+        const NetLine& netline = *mNetLines.at(visit.netLine);
+        const NetLineAnchor& anchor =
+            visit.endPoint ? netline.getEndPoint() : netline.getStartPoint();
+        if (tl::optional<Uuid> junctionUuid = anchor.tryGetJunction()) {
+          if (std::shared_ptr<Junction> junction =
+                  mJunctions.find(*junctionUuid)) {
+            if (!usedJunctions.contains(*junctionUuid)) {
+              segment.junctions.append(junction);
+              usedJunctions.insert(*junctionUuid);
+            }
+          }
+        }
+        visit.connectedNetLines = &anchorNetLines[anchor];
+      }
+      while ((visit.nextConnectedNetLine <
+              visit.connectedNetLines->count()) &&
+             usedNetLines.at(
+                 visit.connectedNetLines->at(visit.nextConnectedNetLine))) {
+        ++visit.nextConnectedNetLine;
+      }
+      if (visit.nextConnectedNetLine < visit.connectedNetLines->count()) {
+        const int next =
+            visit.connectedNetLines->at(visit.nextConnectedNetLine);
+        usedNetLines[next] = true;
+        segment.netlines.append(mNetLines.value(next));
+        // Note: Invalidates the "visit" reference!
+        stack.append(Visit{next, true, nullptr, 0});
+        stack.append(Visit{next, false, nullptr, 0});
+      } else {
+        stack.removeLast();
+      }
+    }
     segments.append(segment);
   }
-  Q_ASSERT(availableNetLines.isEmpty());
 
   // Add netlabels to their nearest netsegment
   for (NetLabel& netlabel : mNetLabels) {
@@ -109,32 +163,6 @@ NetLineAnchor SchematicNetSegmentSplitter::replacePinAnchor(
   return mPinAnchorsToReplace.value(anchor, anchor);
 }
 
-void SchematicNetSegmentSplitter::findConnectedLinesAndPoints(
-    const NetLineAnchor& anchor, NetLineList& availableNetLines,
-    Segment& segment) noexcept {
-  if (tl::optional<Uuid> junctionUuid = anchor.tryGetJunction()) {
-    if (std::shared_ptr<Junction> junction = mJunctions.find(*junctionUuid)) {
-      if (!segment.junctions.contains(junction->getUuid())) {
-        segment.junctions.append(junction);
-      }
-    }
-  }
-  for (int i = 0; i < mNetLines.count(); ++i) {
-    std::shared_ptr<NetLine> netline = mNetLines.value(i);
-    if (((netline->getStartPoint() == anchor) ||
-         (netline->getEndPoint() == anchor)) &&
-        availableNetLines.contains(netline->getUuid()) &&
-        (!segment.netlines.contains(netline->getUuid()))) {
-      segment.netlines.append(netline);
-      availableNetLines.remove(netline->getUuid());
-      findConnectedLinesAndPoints(netline->getStartPoint(), availableNetLines,
-                                  segment);
-      findConnectedLinesAndPoints(netline->getEndPoint(), availableNetLines,
-                                  segment);
-    }
-  }
-}
-
 void SchematicNetSegmentSplitter::addNetLabelToNearestNetSegment(
     const NetLabel& netlabel, QList<Segment>& segments) const noexcept {
   int nearestIndex = -1;
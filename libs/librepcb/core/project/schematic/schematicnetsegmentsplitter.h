@@ -71,11 +71,6 @@ public:
 
 private:  // Methods
   NetLineAnchor replacePinAnchor(const NetLineAnchor& anchor) noexcept;
-  void findConnectedLinesAndPoints(const NetLineAnchor& anchor,
-                                   NetLineList& availableNetLines,
-                                   Segment& segment)
-
-      noexcept;
   void addNetLabelToNearestNetSegment(const NetLabel& netlabel,
                                       QList<Segment>& segments) const noexcept;
   Length getDistanceBetweenNetLabelAndNetSegment(
@@ -46,6 +46,27 @@
  ******************************************************************************/
 namespace librepcb {
 
+/*******************************************************************************
+ *  Local Functions
+ ******************************************************************************/
+
+static void addToStream(QDataStream& s, const Point& point) noexcept {
+  s << qint64(point.getX().toNm()) << qint64(point.getY().toNm());
+}
+
+static void addToStream(QDataStream& s, const Path& path) noexcept {
+  s << int(path.getVertices().count());
+  for (const Vertex& vertex : path.getVertices()) {
+    addToStream(s, vertex.getPos());
+    s << vertex.getAngle().toMicroDeg();
+  }
+}
+
+static void addToStream(QDataStream& s, const Transform& transform) noexcept {
+  addToStream(s, transform.getPosition());
+  s << transform.getRotation().toMicroDeg() << transform.getMirrored();
+}
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
@@ -121,6 +142,7 @@ SchematicPainter::SchematicPainter(const Schematic& schematic,
                             netline->getWidth()});
     }
   }
+  mContentHash = calcContentHash();
 }
 
 SchematicPainter::~SchematicPainter() noexcept {
@@ -224,6 +246,78 @@ void SchematicPainter::paint(
   }
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+QByteArray SchematicPainter::calcContentHash() const noexcept {
+  // Note: The exact encoding does not matter as hashes are never written to
+  // disk, it just needs to be unambiguous.
+  QByteArray data;
+  {
+    QDataStream s(&data, QIODevice::WriteOnly);
+    s << mDefaultFont.toString() << mNetLabelFont.toString();
+    s << int(mSymbols.count());
+    foreach (const Symbol& symbol, mSymbols) {
+      addToStream(s, symbol.transform);
+      s << int(symbol.pins.count());
+      foreach (const Pin& pin, symbol.pins) {
+        addToStream(s, pin.position);
+        s << pin.rotation.toMicroDeg() << qint64(pin.length->toNm())
+          << pin.name << pin.numbers;
+        addToStream(s, pin.namePosition);
+        s << pin.nameRotation.toMicroDeg() << qint64(pin.nameHeight->toNm())
+          << int(pin.nameAlignment.toQtAlign());
+        addToStream(s, pin.numbersPosition);
+        s << int(pin.numbersAlignment.toQtAlign());
+      }
+      s << int(symbol.polygons.count());
+      foreach (const Polygon& polygon, symbol.polygons) {
+        s << polygon.getLayer().getId()
+          << qint64(polygon.getLineWidth()->toNm()) << polygon.isFilled()
+          << polygon.isGrabArea();
+        addToStream(s, polygon.getPath());
+      }
+      s << int(symbol.circles.count());
+      foreach (const Circle& circle, symbol.circles) {
+        s << circle.getLayer().getId() << qint64(circle.getLineWidth()->toNm())
+          << circle.isFilled() << circle.isGrabArea();
+        addToStream(s, circle.getCenter());
+        s << qint64(circle.getDiameter()->toNm());
+      }
+    }
+    s << int(mJunctions.count());
+    foreach (const Point& junction, mJunctions) {
+      addToStream(s, junction);
+    }
+    s << int(mNetLines.count());
+    foreach (const Line& line, mNetLines) {
+      addToStream(s, line.startPosition);
+      addToStream(s, line.endPosition);
+      s << qint64(line.width->toNm());
+    }
+    s << int(mNetLabels.count());
+    foreach (const Label& label, mNetLabels) {
+      addToStream(s, label.position);
+      s << label.rotation.toMicroDeg() << label.mirrored << label.text;
+    }
+    s << int(mPolygons.count());
+    foreach (const Polygon& polygon, mPolygons) {
+      s << polygon.getLayer().getId() << qint64(polygon.getLineWidth()->toNm())
+        << polygon.isFilled() << polygon.isGrabArea();
+      addToStream(s, polygon.getPath());
+    }
+    s << int(mTexts.count());
+    foreach (const Text& text, mTexts) {
+      s << text.getLayer().getId() << text.getText();
+      addToStream(s, text.getPosition());
+      s << text.getRotation().toMicroDeg() << qint64(text.getHeight()->toNm())
+        << int(text.getAlign().toQtAlign());
+    }
+  }
+  return QCryptographicHash::hash(data, QCryptographicHash::Sha256);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
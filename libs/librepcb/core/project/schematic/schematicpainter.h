@@ -97,10 +97,14 @@ public:
   // General Methods
   void paint(QPainter& painter,
              const GraphicsExportSettings& settings) const noexcept override;
+  QByteArray getContentHash() const noexcept override { return mContentHash; }
 
   // Operator Overloadings
   SchematicPainter& operator=(const SchematicPainter& rhs) = delete;
 
+private:  // Methods
+  QByteArray calcContentHash() const noexcept;
+
 private:  // Data
   QFont mDefaultFont;
   QFont mNetLabelFont;
@@ -110,6 +114,7 @@ private:  // Data
   QList<Label> mNetLabels;
   QList<Polygon> mPolygons;
   QList<Text> mTexts;
+  QByteArray mContentHash;
 };
 
 /*******************************************************************************
@@ -0,0 +1,530 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "syntheticprojectgenerator.h"
+
+#include "../exceptions.h"
+#include "../fileio/transactionaldirectory.h"
+#include "../fileio/transactionalfilesystem.h"
+#include "../geometry/polygon.h"
+#include "../library/cmp/component.h"
+#include "../library/dev/device.h"
+#include "../library/library.h"
+#include "../library/pkg/package.h"
+#include "../library/sym/symbol.h"
+#include "../types/layer.h"
+#include "../types/version.h"
+#include "../utils/toolbox.h"
+#include "board/board.h"
+#include "board/items/bi_device.h"
+#include "board/items/bi_footprintpad.h"
+#include "board/items/bi_netline.h"
+#include "board/items/bi_netsegment.h"
+#include "board/items/bi_plane.h"
+#include "board/items/bi_polygon.h"
+#include "board/items/bi_via.h"
+#include "circuit/circuit.h"
+#include "circuit/componentinstance.h"
+#include "circuit/componentsignalinstance.h"
+#include "circuit/netclass.h"
+#include "circuit/netsignal.h"
+#include "project.h"
+#include "projectlibrary.h"
+
+#include <QtCore>
+
+#include <algorithm>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+// Number of neighboring nets a device is connected to. Keeps traces local.
+static const int sNetWindow = 8;
+
+// Maximum number of different devices taken from libraries.
+static const int sMaxLibraryDevices = 20;
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+SyntheticProjectGenerator::SyntheticProjectGenerator(
+    const Settings& settings) noexcept
+  : mSettings(settings), mRandom(settings.seed) {
+}
+
+SyntheticProjectGenerator::~SyntheticProjectGenerator() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+std::unique_ptr<Project> SyntheticProjectGenerator::generate(
+    std::unique_ptr<TransactionalDirectory> directory,
+    const QString& filename) {
+  std::unique_ptr<Project> project =
+      Project::create(std::move(directory), filename);  // can throw
+  project->setName(ElementName("Synthetic Project"));
+  Circuit& circuit = project->getCircuit();
+
+  // Create or load the library elements.
+  const QList<Part> parts = mSettings.libraries.isEmpty()
+      ? createSyntheticParts(*project)  // can throw
+      : loadLibraryParts(*project);  // can throw
+  if (parts.isEmpty()) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("No usable devices found in the given libraries."));
+  }
+
+  // Add nets.
+  NetClass* netClass = circuit.getNetClasses().first();
+  QList<NetSignal*> nets;
+  for (int i = 0; i < std::max(mSettings.netCount, 1); ++i) {
+    NetSignal* net = new NetSignal(
+        circuit, createUuid(), *netClass,
+        CircuitIdentifier(QString("NET%1").arg(i + 1)), false);
+    circuit.addNetSignal(*net);  // can throw
+    nets.append(net);
+  }
+
+  // Add board with its outline, large enough to place all devices on a grid.
+  Point cellSize(2000000, 2000000);
+  foreach (const Part& part, parts) {
+    cellSize.setX(std::max(cellSize.getX(), part.size.getX()));
+    cellSize.setY(std::max(cellSize.getY(), part.size.getY()));
+  }
+  cellSize += Point(3000000, 3000000);  // Spacing between devices.
+  cellSize.mapToGrid(PositiveLength(1000000));
+  const int deviceCount = std::max(mSettings.deviceCount, 1);
+  const int columns = std::ceil(std::sqrt(qreal(deviceCount)));
+  const int rows = (deviceCount + columns - 1) / columns;
+  const Point boardSize(cellSize.getX() * columns, cellSize.getY() * rows);
+  Board* board = new Board(
+      *project,
+      std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory()),
+      "synthetic", createUuid(), ElementName("Synthetic"));  // can throw
+  board->setInnerLayerCount(qBound(0, mSettings.copperLayerCount - 2,
+                                   Layer::innerCopperCount()));
+  board->addPolygon(*new BI_Polygon(
+      *board,
+      BoardPolygonData(createUuid(), Layer::boardOutlines(), UnsignedLength(0),
+                       Path::rect(Point(0, 0), boardSize), false, false,
+                       false)));
+  project->addBoard(*board);  // can throw
+
+  // Add board content.
+  QVector<QList<BI_FootprintPad*>> netPads(nets.count());
+  addDevices(*board, parts, cellSize, columns, nets, netPads);  // can throw
+  addTraces(*board, nets, netPads);  // can throw
+  addPlanes(*board, nets, boardSize);  // can throw
+  return project;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+QList<SyntheticProjectGenerator::Part>
+    SyntheticProjectGenerator::createSyntheticParts(Project& project) {
+  const int padCount = qBound(2, mSettings.padsPerDevice, 1000) & ~1;
+  const int padsPerRow = padCount / 2;
+  const Version version = Version::fromString("0.1");
+  const QString author = "LibrePCB";
+  const ElementName name(QString("Synthetic-%1").arg(padCount));
+
+  // Symbol with one pin per pad, left and right of a rectangular body.
+  std::unique_ptr<Symbol> symbol(
+      new Symbol(createUuid(), version, author, name, "", ""));
+  const Length pinPitch(2540000);
+  for (int i = 0; i < padCount; ++i) {
+    const bool left = (i < padsPerRow);
+    const int row = left ? i : (padCount - 1 - i);
+    symbol->getPins().append(std::make_shared<SymbolPin>(
+        createUuid(), CircuitIdentifier(QString::number(i + 1)),
+        Point(Length(left ? -7620000 : 7620000), pinPitch * -row),
+        UnsignedLength(2540000), left ? Angle::deg0() : Angle::deg180(),
+        Point(3810000, 0), Angle::deg0(), SymbolPin::getDefaultNameHeight(),
+        SymbolPin::getDefaultNameAlignment()));
+  }
+  symbol->getPolygons().append(std::make_shared<Polygon>(
+      createUuid(), Layer::symbolOutlines(), UnsignedLength(254000), false,
+      true,
+      Path::rect(Point(-5080000, 2540000),
+                 Point(Length(5080000), pinPitch * -padsPerRow))));
+
+  // Dual-row SMT package with the body outline as grab area.
+  std::unique_ptr<Package> package(
+      new Package(createUuid(), version, author, name, "", "",
+                  Package::AssemblyType::Smt));
+  std::shared_ptr<Footprint> footprint =
+      std::make_shared<Footprint>(createUuid(), ElementName("default"), "");
+  const Length padPitch(1270000);
+  for (int i = 0; i < padCount; ++i) {
+    const bool left = (i < padsPerRow);
+    const int row = left ? i : (padCount - 1 - i);
+    const Uuid uuid = createUuid();
+    package->getPads().append(std::make_shared<PackagePad>(
+        uuid, CircuitIdentifier(QString::number(i + 1))));
+    footprint->getPads().append(std::make_shared<FootprintPad>(
+        uuid, uuid,
+        Point(Length(left ? -2700000 : 2700000),
+              padPitch * (padsPerRow - 1 - 2 * row) / 2),
+        Angle::deg0(), FootprintPad::Shape::RoundedRect,
+        PositiveLength(1550000), PositiveLength(600000),
+        UnsignedLimitedRatio(Ratio::fromPercent(50)), Path(),
+        MaskConfig::automatic(), MaskConfig::automatic(), UnsignedLength(0),
+        FootprintPad::ComponentSide::Top, FootprintPad::Function::StandardPad,
+        PadHoleList{}));
+  }
+  footprint->getPolygons().append(std::make_shared<Polygon>(
+      createUuid(), Layer::topDocumentation(), UnsignedLength(200000), false,
+      true,
+      Path::rect(Point(Length(-1500000), padPitch * padsPerRow / 2),
+                 Point(Length(1500000), padPitch * -padsPerRow / 2))));
+  package->getFootprints().append(footprint);
+
+  // Component with one signal per pin.
+  std::unique_ptr<Component> component(
+      new Component(createUuid(), version, author, name, "", ""));
+  component->setPrefixes(NormDependentPrefixMap(ComponentPrefix("U")));
+  std::shared_ptr<ComponentSymbolVariant> symbolVariant =
+      std::make_shared<ComponentSymbolVariant>(createUuid(), "",
+                                               ElementName("default"), "");
+  std::shared_ptr<ComponentSymbolVariantItem> gate =
+      std::make_shared<ComponentSymbolVariantItem>(
+          createUuid(), symbol->getUuid(), Point(0, 0), Angle::deg0(), true,
+          ComponentSymbolVariantItemSuffix(""));
+  QList<Uuid> signalUuids;
+  for (const SymbolPin& pin : symbol->getPins()) {
+    const Uuid uuid = createUuid();
+    component->getSignals().append(std::make_shared<ComponentSignal>(
+        uuid, pin.getName(), SignalRole::passive(), QString(), false, false,
+        false));
+    gate->getPinSignalMap().append(std::make_shared<ComponentPinSignalMapItem>(
+        pin.getUuid(), uuid, CmpSigPinDisplayType::componentSignal()));
+    signalUuids.append(uuid);
+  }
+  symbolVariant->getSymbolItems().append(gate);
+  component->getSymbolVariants().append(symbolVariant);
+
+  // Device connecting each pad to the corresponding signal.
+  std::unique_ptr<Device> device(
+      new Device(createUuid(), version, author, name, "", "",
+                 component->getUuid(), package->getUuid()));
+  for (int i = 0; i < padCount; ++i) {
+    device->getPadSignalMap().append(std::make_shared<DevicePadSignalMapItem>(
+        package->getPads().at(i)->getUuid(), signalUuids.at(i)));
+  }
+
+  // Add elements to the project library, which takes the ownership.
+  const Part part{device.get(), component.get(), footprint->getUuid(), "U",
+                  calcPadsSize(*package, footprint->getUuid())};
+  project.getLibrary().addSymbol(*symbol.release());  // can throw
+  project.getLibrary().addPackage(*package.release());  // can throw
+  project.getLibrary().addComponent(*component.release());  // can throw
+  project.getLibrary().addDevice(*device.release());  // can throw
+  return {part};
+}
+
+QList<SyntheticProjectGenerator::Part>
+    SyntheticProjectGenerator::loadLibraryParts(Project& project) {
+  auto openDir = [](const FilePath& fp) {
+    return std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
+        TransactionalFileSystem::openRO(fp)));  // can throw
+  };
+
+  // Index the library elements. The directory names are the element UUIDs.
+  QHash<Uuid, FilePath> symbols, packages, components;
+  QList<FilePath> devices;
+  foreach (const FilePath& libDir, mSettings.libraries) {
+    std::unique_ptr<Library> lib = Library::open(openDir(libDir));
+    auto index = [&libDir](const QStringList& dirs,
+                           QHash<Uuid, FilePath>& map) {
+      foreach (const QString& dir, dirs) {
+        if (auto uuid = Uuid::tryFromString(dir.section('/', -1))) {
+          map.insert(*uuid, libDir.getPathTo(dir));
+        }
+      }
+    };
+    index(lib->searchForElements<Symbol>(), symbols);
+    index(lib->searchForElements<Package>(), packages);
+    index(lib->searchForElements<Component>(), components);
+    foreach (const QString& dir, lib->searchForElements<Device>()) {
+      devices.append(libDir.getPathTo(dir));
+    }
+  }
+
+  // Pick random devices. Sort first to be independent of the file system.
+  std::sort(devices.begin(), devices.end(),
+            [](const FilePath& a, const FilePath& b) {
+              return a.toStr() < b.toStr();
+            });
+  std::shuffle(devices.begin(), devices.end(), mRandom);
+
+  ProjectLibrary& library = project.getLibrary();
+  QList<Part> parts;
+  foreach (const FilePath& devFp, devices) {
+    if (parts.count() >= sMaxLibraryDevices) {
+      break;
+    }
+    std::unique_ptr<Device> device = Device::open(openDir(devFp));
+    const FilePath cmpFp = components.value(device->getComponentUuid());
+    const FilePath pkgFp = packages.value(device->getPackageUuid());
+    if (library.getDevice(device->getUuid()) || (!cmpFp.isValid()) ||
+        (!pkgFp.isValid())) {
+      continue;
+    }
+
+    // Load component and package, if not done already.
+    std::unique_ptr<Component> newComponent;
+    Component* component = library.getComponent(device->getComponentUuid());
+    if (!component) {
+      newComponent = Component::open(openDir(cmpFp));
+      component = newComponent.get();
+    }
+    std::unique_ptr<Package> newPackage;
+    Package* package = library.getPackage(device->getPackageUuid());
+    if (!package) {
+      newPackage = Package::open(openDir(pkgFp));
+      package = newPackage.get();
+    }
+    if (component->getSymbolVariants().isEmpty() ||
+        package->getFootprints().isEmpty()) {
+      continue;
+    }
+
+    // Add them to the project library, including the symbols.
+    if (newComponent) {
+      for (const ComponentSymbolVariantItem& item :
+           component->getSymbolVariants().first()->getSymbolItems()) {
+        const FilePath symFp = symbols.value(item.getSymbolUuid());
+        if (symFp.isValid() && (!library.getSymbol(item.getSymbolUuid()))) {
+          library.addSymbol(*Symbol::open(openDir(symFp)).release());
+        }
+      }
+      library.addComponent(*newComponent.release());
+    }
+    if (newPackage) {
+      library.addPackage(*newPackage.release());
+    }
+
+    const Uuid footprint = package->getFootprints().first()->getUuid();
+    const QString prefix =
+        *component->getPrefixes().value(project.getNormOrder());
+    parts.append(Part{device.get(), component, footprint,
+                      prefix.isEmpty() ? QString("U") : prefix,
+                      calcPadsSize(*package, footprint)});
+    library.addDevice(*device.release());
+  }
+  return parts;
+}
+
+void SyntheticProjectGenerator::addDevices(
+    Board& board, const QList<Part>& parts, const Point& cellSize,
+    int columns, const QList<NetSignal*>& nets,
+    QVector<QList<BI_FootprintPad*>>& netPads) {
+  Circuit& circuit = board.getProject().getCircuit();
+  const QSet<Uuid> assemblyVariants =
+      circuit.getAssemblyVariants().getUuidSet();
+  QHash<NetSignal*, int> netIndices;
+  for (int i = 0; i < nets.count(); ++i) {
+    netIndices.insert(nets.at(i), i);
+  }
+
+  const int deviceCount = std::max(mSettings.deviceCount, 1);
+  QHash<QString, int> prefixCounters;
+  for (int i = 0; i < deviceCount; ++i) {
+    const Part& part = parts.at(mRandom.bounded(parts.count()));
+
+    // Add component.
+    const int number = ++prefixCounters[part.prefix];
+    ComponentInstance* cmp = new ComponentInstance(
+        circuit, createUuid(), *part.component,
+        part.component->getSymbolVariants().first()->getUuid(),
+        CircuitIdentifier(part.prefix % QString::number(number)));
+    ComponentAssemblyOptionList options;
+    options.append(std::make_shared<ComponentAssemblyOption>(
+        part.device->getUuid(), part.device->getAttributes(),
+        assemblyVariants, PartList{}));
+    cmp->setAssemblyOptions(options);
+    circuit.addComponentInstance(*cmp);  // can throw
+
+    // Connect signals to nets of the neighborhood.
+    const int firstNet = (qint64(i) * nets.count()) / deviceCount;
+    foreach (ComponentSignalInstance* signal, cmp->getSignals()) {
+      const int net = (firstNet + mRandom.bounded(sNetWindow)) % nets.count();
+      signal->setNetSignal(nets.at(net));  // can throw
+    }
+
+    // Add device.
+    const Point position(cellSize.getX() * (i % columns),
+                         cellSize.getY() * (i / columns));
+    BI_Device* device =
+        new BI_Device(board, *cmp, part.device->getUuid(), part.footprint,
+                      position + (cellSize / 2), Angle::deg0(), false, false,
+                      true);  // can throw
+    board.addDeviceInstance(*device);  // can throw
+
+    // Memorize pads to be connected by traces.
+    foreach (BI_FootprintPad* pad, device->getPads()) {
+      NetSignal* net = pad->getCompSigInstNetSignal();
+      if (net && pad->isOnLayer(Layer::topCopper())) {
+        netPads[netIndices.value(net)].append(pad);
+      }
+    }
+  }
+}
+
+void SyntheticProjectGenerator::addTraces(
+    Board& board, const QList<NetSignal*>& nets,
+    const QVector<QList<BI_FootprintPad*>>& netPads) {
+  // Layers to change to when routing through vias.
+  QList<const Layer*> layers = Toolbox::toList(board.getCopperLayers());
+  std::sort(layers.begin(), layers.end(), [](const Layer* a, const Layer* b) {
+    return a->getCopperNumber() < b->getCopperNumber();
+  });
+  layers.removeAll(&Layer::topCopper());
+
+  const PositiveLength width(200000);
+  const PositiveLength viaSize(600000);
+  const PositiveLength viaDrill(300000);
+  const PositiveLength grid(100000);
+  int remainingTraces = std::max(mSettings.traceCount, 0);
+  int remainingVias = std::max(mSettings.viaCount, 0);
+  int layerIndex = 0;
+
+  // Connect the pads of each net in a chain. Nets are processed round-robin,
+  // one connection at a time, to distribute the traces over all nets.
+  QVector<int> nextPad(netPads.count(), 1);
+  bool added = true;
+  while (added && (remainingTraces > 0)) {
+    added = false;
+    for (int n = 0; (n < netPads.count()) && (remainingTraces > 0); ++n) {
+      const QList<BI_FootprintPad*>& pads = netPads.at(n);
+      if (nextPad[n] >= pads.count()) {
+        continue;
+      }
+      BI_FootprintPad* pad1 = pads.at(nextPad[n] - 1);
+      BI_FootprintPad* pad2 = pads.at(nextPad[n]);
+      ++nextPad[n];
+
+      BI_NetSegment* segment =
+          new BI_NetSegment(board, createUuid(), nets.at(n));
+      board.addNetSegment(*segment);  // can throw
+      QList<BI_Via*> vias;
+      QList<BI_NetLine*> lines;
+      if ((remainingVias >= 2) && (remainingTraces >= 3) &&
+          (!layers.isEmpty())) {
+        // Change to another layer in the middle of the connection.
+        const Point delta = pad2->getPosition() - pad1->getPosition();
+        BI_Via* via1 = new BI_Via(
+            *segment,
+            Via(createUuid(), Layer::topCopper(), Layer::botCopper(),
+                (pad1->getPosition() + delta / 4).mappedToGrid(grid), viaSize,
+                viaDrill, MaskConfig::off()));
+        BI_Via* via2 = new BI_Via(
+            *segment,
+            Via(createUuid(), Layer::topCopper(), Layer::botCopper(),
+                (pad2->getPosition() - delta / 4).mappedToGrid(grid), viaSize,
+                viaDrill, MaskConfig::off()));
+        const Layer& layer = *layers.at(layerIndex++ % layers.count());
+        vias << via1 << via2;
+        lines << new BI_NetLine(*segment, createUuid(), *pad1, *via1,
+                                Layer::topCopper(), width);
+        lines << new BI_NetLine(*segment, createUuid(), *via1, *via2, layer,
+                                width);
+        lines << new BI_NetLine(*segment, createUuid(), *via2, *pad2,
+                                Layer::topCopper(), width);
+        remainingVias -= 2;
+        remainingTraces -= 3;
+      } else {
+        lines << new BI_NetLine(*segment, createUuid(), *pad1, *pad2,
+                                Layer::topCopper(), width);
+        remainingTraces -= 1;
+      }
+      segment->addElements(vias, {}, lines);  // can throw
+      added = true;
+    }
+  }
+}
+
+void SyntheticProjectGenerator::addPlanes(Board& board,
+                                          const QList<NetSignal*>& nets,
+                                          const Point& boardSize) {
+  // Prefer inner layers for planes, like on real boards.
+  QList<const Layer*> layers = Toolbox::toList(board.getCopperLayers());
+  std::sort(layers.begin(), layers.end(), [](const Layer* a, const Layer* b) {
+    if (a->isInner() != b->isInner()) {
+      return a->isInner();
+    }
+    return a->getCopperNumber() > b->getCopperNumber();
+  });
+
+  const Point margin(1000000, 1000000);
+  const Path outline = Path::rect(margin, boardSize - margin);
+  for (int i = 0; i < std::max(mSettings.planeCount, 0); ++i) {
+    BI_Plane* plane =
+        new BI_Plane(board, createUuid(), *layers.at(i % layers.count()),
+                     nets.at(i % nets.count()), outline);
+    board.addPlane(*plane);  // can throw
+  }
+}
+
+Uuid SyntheticProjectGenerator::createUuid() noexcept {
+  // Random version 4 UUID, but derived from the seed.
+  QByteArray data(16, Qt::Uninitialized);
+  for (int i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<char>(mRandom.bounded(256));
+  }
+  data[6] = static_cast<char>((data[6] & 0x0F) | 0x40);
+  data[8] = static_cast<char>((data[8] & 0x3F) | 0x80);
+  const QString str = QUuid::fromRfc4122(data).toString();
+  return Uuid::fromString(str.mid(1, 36));  // Remove braces.
+}
+
+Point SyntheticProjectGenerator::calcPadsSize(const Package& package,
+                                              const Uuid& footprint) noexcept {
+  std::shared_ptr<const Footprint> fpt =
+      package.getFootprints().find(footprint);
+  if ((!fpt) || fpt->getPads().isEmpty()) {
+    return Point(0, 0);
+  }
+  Length minX = Length::max(), minY = Length::max();
+  Length maxX = Length::min(), maxY = Length::min();
+  for (const FootprintPad& pad : fpt->getPads()) {
+    const Length radius = std::max(*pad.getWidth(), *pad.getHeight()) / 2;
+    minX = std::min(minX, pad.getPosition().getX() - radius);
+    minY = std::min(minY, pad.getPosition().getY() - radius);
+    maxX = std::max(maxX, pad.getPosition().getX() + radius);
+    maxY = std::max(maxY, pad.getPosition().getY() + radius);
+  }
+  return Point(maxX - minX, maxY - minY);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,150 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_SYNTHETICPROJECTGENERATOR_H
+#define LIBREPCB_CORE_SYNTHETICPROJECTGENERATOR_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../fileio/filepath.h"
+#include "../types/point.h"
+#include "../types/uuid.h"
+
+#include <QtCore>
+
+#include <memory>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class BI_FootprintPad;
+class Board;
+class Component;
+class Device;
+class NetSignal;
+class Package;
+class Project;
+class TransactionalDirectory;
+
+/*******************************************************************************
+ *  Class SyntheticProjectGenerator
+ ******************************************************************************/
+
+/**
+ * @brief Generates large synthetic projects for scaling tests
+ *
+ * Creates a project containing a single board with a given number of
+ * devices, nets, traces, vias and planes. Devices are placed on a grid and
+ * nets are assigned to nearby devices, so traces stay local like on real
+ * boards. However, the routing does not care about clearances, thus the
+ * generated boards are not DRC-clean. They are intended for benchmarks and
+ * profiling, not as reference designs.
+ *
+ * All placement, connectivity, geometry and the UUIDs of generated objects
+ * are derived from #Settings::seed, so the same settings always lead to the
+ * same board.
+ *
+ * By default, synthetic library elements are created (a dual-row SMT part
+ * with #Settings::padsPerDevice pads). Alternatively, devices can be taken
+ * from existing libraries (e.g. the ones in the workspace) by specifying
+ * #Settings::libraries.
+ */
+class SyntheticProjectGenerator final {
+  Q_DECLARE_TR_FUNCTIONS(SyntheticProjectGenerator)
+
+public:
+  // Types
+  struct Settings {
+    quint32 seed = 0;
+    int deviceCount = 100;
+    int padsPerDevice = 8;  ///< Only used for synthetic library elements
+    int netCount = 100;
+    int traceCount = 300;  ///< Upper limit, actual count depends on nets
+    int viaCount = 100;  ///< Upper limit, actual count depends on nets
+    int planeCount = 2;
+    int copperLayerCount = 4;
+    QList<FilePath> libraries;  ///< Use devices from these libraries
+  };
+
+  // Constructors / Destructor
+  SyntheticProjectGenerator() = delete;
+  SyntheticProjectGenerator(const SyntheticProjectGenerator& other) = delete;
+  explicit SyntheticProjectGenerator(const Settings& settings) noexcept;
+  ~SyntheticProjectGenerator() noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Generate a new project
+   *
+   * @param directory   Empty directory to create the project in.
+   * @param filename    Name of the project file (*.lpp).
+   *
+   * @return The generated project. Note that it is not saved yet, call
+   *         Project::save() and save the file system to write it to disk.
+   *
+   * @throws Exception in case of an error.
+   */
+  std::unique_ptr<Project> generate(
+      std::unique_ptr<TransactionalDirectory> directory,
+      const QString& filename);
+
+  // Operator Overloadings
+  SyntheticProjectGenerator& operator=(const SyntheticProjectGenerator& rhs) =
+      delete;
+
+private:  // Types
+  struct Part {
+    const Device* device;
+    const Component* component;
+    Uuid footprint;
+    QString prefix;
+    Point size;  ///< Bounding box size of the footprint pads
+  };
+
+private:  // Methods
+  QList<Part> createSyntheticParts(Project& project);
+  QList<Part> loadLibraryParts(Project& project);
+  void addDevices(Board& board, const QList<Part>& parts,
+                  const Point& cellSize, int columns,
+                  const QList<NetSignal*>& nets,
+                  QVector<QList<BI_FootprintPad*>>& netPads);
+  void addTraces(Board& board, const QList<NetSignal*>& nets,
+                 const QVector<QList<BI_FootprintPad*>>& netPads);
+  void addPlanes(Board& board, const QList<NetSignal*>& nets,
+                 const Point& boardSize);
+  Uuid createUuid() noexcept;
+  static Point calcPadsSize(const Package& package,
+                            const Uuid& footprint) noexcept;
+
+private:  // Data
+  const Settings mSettings;
+  QRandomGenerator mRandom;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
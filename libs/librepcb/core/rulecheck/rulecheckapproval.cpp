@@ -0,0 +1,103 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "rulecheckapproval.h"
+
+#include "../serialization/sexpression.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Non-Member Functions
+ ******************************************************************************/
+
+static void serializeForFingerprint(QDataStream& stream,
+                                    const SExpression& node) noexcept {
+  stream << static_cast<qint32>(node.getType());
+  if (node.isList()) {
+    stream << node.getName();
+  } else if (!node.isLineBreak()) {
+    stream << node.getValue();
+  }
+  stream << static_cast<quint32>(node.getChildCount());
+  for (std::size_t i = 0; i < node.getChildCount(); ++i) {
+    serializeForFingerprint(stream, node.getChild(static_cast<int>(i)));
+  }
+}
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+RuleCheckApproval::RuleCheckApproval(const RuleCheckApproval& other) noexcept
+  : mNode(other.mNode),
+    mFingerprintHigh(other.mFingerprintHigh),
+    mFingerprintLow(other.mFingerprintLow) {
+}
+
+RuleCheckApproval::RuleCheckApproval(const SExpression& node) noexcept
+  : mNode(std::make_shared<SExpression>(node)),
+    mFingerprintHigh(0),
+    mFingerprintLow(0) {
+  // Note: The exact encoding does not matter as fingerprints are never
+  // written to disk, it just needs to be unambiguous.
+  QByteArray data;
+  {
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    serializeForFingerprint(stream, node);
+  }
+  const QByteArray hash =
+      QCryptographicHash::hash(data, QCryptographicHash::Md5);
+  Q_ASSERT(hash.size() == 16);
+  mFingerprintHigh = qFromLittleEndian<quint64>(hash.constData());
+  mFingerprintLow = qFromLittleEndian<quint64>(hash.constData() + 8);
+}
+
+RuleCheckApproval::~RuleCheckApproval() noexcept {
+}
+
+/*******************************************************************************
+ *  Operator Overloadings
+ ******************************************************************************/
+
+bool RuleCheckApproval::operator<(const RuleCheckApproval& rhs) const noexcept {
+  return (*mNode) < (*rhs.mNode);
+}
+
+RuleCheckApproval& RuleCheckApproval::operator=(
+    const RuleCheckApproval& rhs) noexcept {
+  mNode = rhs.mNode;
+  mFingerprintHigh = rhs.mFingerprintHigh;
+  mFingerprintLow = rhs.mFingerprintLow;
+  return *this;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,107 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_RULECHECKAPPROVAL_H
+#define LIBREPCB_CORE_RULECHECKAPPROVAL_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../qtcompat.h"
+
+#include <QtCore>
+
+#include <memory>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class SExpression;
+
+/*******************************************************************************
+ *  Class RuleCheckApproval
+ ******************************************************************************/
+
+/**
+ * @brief Approval of a ::librepcb::RuleCheckMessage
+ *
+ * An approval is identified by an ::librepcb::SExpression node, which is
+ * what gets serialized into the files. However, hashing and comparing such
+ * nodes is expensive since the whole tree needs to be traversed each time.
+ * With tens of thousands of messages, this dominated the approval
+ * bookkeeping after each rule check run.
+ *
+ * Therefore this class computes a 128-bit fingerprint of the node once at
+ * construction time, and uses only this fingerprint for hashing and equality
+ * comparison. This makes approvals cheap to store in a QSet and to use in
+ * set operations. The node itself is kept (implicitly shared) only for
+ * serialization.
+ *
+ * @note The ordering operator compares the nodes (not the fingerprints) to
+ *       keep the order of serialized approvals human-friendly and stable.
+ */
+class RuleCheckApproval final {
+public:
+  // Constructors / Destructor
+  RuleCheckApproval() = delete;
+  RuleCheckApproval(const RuleCheckApproval& other) noexcept;
+  explicit RuleCheckApproval(const SExpression& node) noexcept;
+  ~RuleCheckApproval() noexcept;
+
+  // Getters
+  const SExpression& getNode() const noexcept { return *mNode; }
+  quint64 getFingerprintHigh() const noexcept { return mFingerprintHigh; }
+  quint64 getFingerprintLow() const noexcept { return mFingerprintLow; }
+
+  // Operator Overloadings
+  bool operator==(const RuleCheckApproval& rhs) const noexcept {
+    return (mFingerprintHigh == rhs.mFingerprintHigh) &&
+        (mFingerprintLow == rhs.mFingerprintLow);
+  }
+  bool operator!=(const RuleCheckApproval& rhs) const noexcept {
+    return !(*this == rhs);
+  }
+  bool operator<(const RuleCheckApproval& rhs) const noexcept;
+  RuleCheckApproval& operator=(const RuleCheckApproval& rhs) noexcept;
+
+private:  // Data
+  std::shared_ptr<const SExpression> mNode;
+  quint64 mFingerprintHigh;
+  quint64 mFingerprintLow;
+};
+
+/*******************************************************************************
+ *  Non-Member Functions
+ ******************************************************************************/
+
+inline QtCompat::Hash qHash(const RuleCheckApproval& approval,
+                            QtCompat::Hash seed = 0) noexcept {
+  // The fingerprint is already uniformly distributed.
+  return ::qHash(approval.getFingerprintLow(), seed);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
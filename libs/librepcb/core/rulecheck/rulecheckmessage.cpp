@@ -36,7 +36,9 @@ RuleCheckMessage::RuleCheckMessage(const RuleCheckMessage& other) noexcept
     mMessage(other.mMessage),
     mDescription(other.mDescription),
     mApproval(new SExpression(*other.mApproval)),
-    mLocations(other.mLocations) {
+    mLocations(other.mLocations),
+    mApprovalCache(),
+    mApprovalCacheFlag() {
 }
 
 RuleCheckMessage::RuleCheckMessage(Severity severity, const QString& msg,
@@ -47,7 +49,9 @@ RuleCheckMessage::RuleCheckMessage(Severity severity, const QString& msg,
     mMessage(msg),
     mDescription(description),
     mApproval(SExpression::createList("approved")),
-    mLocations(locations) {
+    mLocations(locations),
+    mApprovalCache(),
+    mApprovalCacheFlag() {
   mApproval->appendChild(SExpression::createToken(approvalName));  // snake_case
 }
 
@@ -62,6 +66,16 @@ const QIcon& RuleCheckMessage::getSeverityIcon() const noexcept {
   return getSeverityIcon(mSeverity);
 }
 
+const RuleCheckApproval& RuleCheckMessage::getApproval() const noexcept {
+  // Subclasses extend mApproval in their constructors, so the fingerprint
+  // can only be calculated lazily. Messages are passed between threads, thus
+  // this needs to be thread-safe.
+  std::call_once(mApprovalCacheFlag, [this]() {
+    mApprovalCache.reset(new RuleCheckApproval(*mApproval));
+  });
+  return *mApprovalCache;
+}
+
 /*******************************************************************************
  *  Static Methods
  ******************************************************************************/
@@ -89,9 +103,10 @@ const QIcon& RuleCheckMessage::getSeverityIcon(Severity severity) noexcept {
   return icon[severity];
 }
 
-QSet<SExpression> RuleCheckMessage::getAllApprovals(
+QSet<RuleCheckApproval> RuleCheckMessage::getAllApprovals(
     const QVector<std::shared_ptr<const RuleCheckMessage>>& messages) noexcept {
-  QSet<SExpression> approvals;
+  QSet<RuleCheckApproval> approvals;
+  approvals.reserve(messages.count());
   foreach (const auto& msg, messages) {
     Q_ASSERT(msg);
     approvals.insert(msg->getApproval());
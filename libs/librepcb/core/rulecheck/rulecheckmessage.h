@@ -25,10 +25,12 @@
  ******************************************************************************/
 #include "../geometry/path.h"
 #include "../serialization/sexpression.h"
+#include "rulecheckapproval.h"
 
 #include <QtCore>
 
 #include <memory>
+#include <mutex>
 
 /*******************************************************************************
  *  Namespace / Forward Declarations
@@ -62,7 +64,7 @@ public:
   const QIcon& getSeverityIcon() const noexcept;
   const QString& getMessage() const noexcept { return mMessage; }
   const QString& getDescription() const noexcept { return mDescription; }
-  const SExpression& getApproval() const noexcept { return *mApproval; }
+  const RuleCheckApproval& getApproval() const noexcept;
   const QVector<Path>& getLocations() const noexcept { return mLocations; }
 
   // General Methods
@@ -78,7 +80,7 @@ public:
   // Static Methods
   static QString getSeverityTr(Severity severity) noexcept;
   static const QIcon& getSeverityIcon(Severity severity) noexcept;
-  static QSet<SExpression> getAllApprovals(
+  static QSet<RuleCheckApproval> getAllApprovals(
       const QVector<std::shared_ptr<const RuleCheckMessage>>&
           messages) noexcept;
 
@@ -97,8 +99,13 @@ protected:  // Data
   Severity mSeverity;
   QString mMessage;
   QString mDescription;
-  std::unique_ptr<SExpression> mApproval;
+  std::unique_ptr<SExpression> mApproval;  ///< Only modify in constructors!
   QVector<Path> mLocations;
+
+private:  // Data
+  /// Created from #mApproval on first access (after construction)
+  mutable std::unique_ptr<RuleCheckApproval> mApprovalCache;
+  mutable std::once_flag mApprovalCacheFlag;
 };
 
 typedef QVector<std::shared_ptr<const RuleCheckMessage>> RuleCheckMessageList;
@@ -1098,10 +1098,11 @@ void FileFormatMigrationV01::upgradeCutouts(SExpression& node,
     } else {
       // In footprints, the longest outline is only considered as the board
       // outlines if there is any pad located *within* the outline.
+      const QPainterPath outlinePx =
+          outlineObjects.last().outline.toQPainterPathPx();
       foreach (const SExpression* padNode, node.getChildren("pad")) {
         const Point padPosition(padNode->getChild("position"));
-        if (outlineObjects.last().outline.toQPainterPathPx().contains(
-                padPosition.toPxQPointF())) {
+        if (outlinePx.contains(padPosition.toPxQPointF())) {
           outlineObjects.removeLast();
           break;
         }
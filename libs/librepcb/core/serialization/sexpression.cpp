@@ -23,6 +23,8 @@
 #include "sexpression.h"
 
 #include "../exceptions.h"
+#include "../utils/memoryreport.h"
+#include "../utils/tracer.h"
 
 #include <QtCore>
 #include <QtGui>
@@ -179,6 +181,15 @@ const SExpression* SExpression::tryGetChild(
   return const_cast<SExpression*>(this)->tryGetChild(path);
 }
 
+qint64 SExpression::getApproxMemoryUsage() const noexcept {
+  qint64 bytes = sizeof(SExpression) + MemoryReport::estimate(mValue) +
+      mChildren.capacity() * sizeof(std::unique_ptr<SExpression>);
+  for (const auto& child : mChildren) {
+    bytes += child->getApproxMemoryUsage();
+  }
+  return bytes;
+}
+
 /*******************************************************************************
  *  Setters
  ******************************************************************************/
@@ -416,6 +427,7 @@ std::unique_ptr<SExpression> SExpression::createLineBreak() {
 std::unique_ptr<SExpression> SExpression::parse(const QByteArray& content,
                                                 const FilePath& filePath,
                                                 Mode mode) {
+  LIBREPCB_TRACE_SCOPE_DETAIL("sexpr", "parse", filePath.toNative());
   int index = 0;
   QString contentStr = QString::fromUtf8(content);
   skipWhitespaceAndComments(contentStr, index, true);  // Skip newlines as well.
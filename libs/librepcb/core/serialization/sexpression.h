@@ -105,6 +105,13 @@ public:
   QList<SExpression*> getChildren(const QString& name) noexcept;
   QList<const SExpression*> getChildren(const QString& name) const noexcept;
 
+  /**
+   * @brief Get the approximate memory footprint of this node
+   *
+   * @return Number of bytes, including all children.
+   */
+  qint64 getApproxMemoryUsage() const noexcept;
+
   /**
    * @brief Get a child by path
    *
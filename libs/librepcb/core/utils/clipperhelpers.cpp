@@ -24,11 +24,65 @@
 
 #include <QtCore>
 
+#include <atomic>
+#include <functional>
+#include <tuple>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
 namespace librepcb {
 
+/*******************************************************************************
+ *  Shape Cache
+ ******************************************************************************/
+
+/// Shape type, first size parameter, second size parameter, third size
+/// parameter, arc tolerance
+typedef std::tuple<int, LengthBase_t, LengthBase_t, LengthBase_t, LengthBase_t>
+    ShapeCacheKey;
+
+/// Upper limit to avoid growing infinitely when traces are modified
+static const int sShapeCacheMaxEntries = 10000;
+
+static QMutex sShapeCacheMutex;
+static QMap<ShapeCacheKey, ClipperLib::Path> sShapeCache;
+static std::atomic<quint64> sShapeCacheHits(0);
+static std::atomic<quint64> sShapeCacheMisses(0);
+
+static ClipperLib::Path getCachedShape(
+    const ShapeCacheKey& key, const Point& offset,
+    const std::function<Path()>& createShape,
+    const PositiveLength& maxArcTolerance) noexcept {
+  ClipperLib::Path path;
+  {
+    QMutexLocker lock(&sShapeCacheMutex);
+    auto it = sShapeCache.constFind(key);
+    if (it != sShapeCache.constEnd()) {
+      path = *it;
+    }
+  }
+  if (!path.empty()) {
+    ++sShapeCacheHits;
+  } else {
+    // Not cached yet, do the (expensive) conversion without holding the lock.
+    ++sShapeCacheMisses;
+    path = ClipperHelpers::convert(createShape(), maxArcTolerance);
+    QMutexLocker lock(&sShapeCacheMutex);
+    if (sShapeCache.count() >= sShapeCacheMaxEntries) {
+      sShapeCache.clear();
+    }
+    sShapeCache.insert(key, path);
+  }
+  const ClipperLib::cInt dx = offset.getX().toNm();
+  const ClipperLib::cInt dy = offset.getY().toNm();
+  for (ClipperLib::IntPoint& p : path) {
+    p.X += dx;
+    p.Y += dy;
+  }
+  return path;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -366,6 +420,35 @@ ClipperLib::IntPoint ClipperHelpers::convert(const Point& point) noexcept {
   return ClipperLib::IntPoint(point.getX().toNm(), point.getY().toNm());
 }
 
+ClipperLib::Path ClipperHelpers::convertCircle(
+    const Point& center, const PositiveLength& diameter,
+    const PositiveLength& maxArcTolerance) noexcept {
+  const ShapeCacheKey key(0, diameter->toNm(), 0, 0, maxArcTolerance->toNm());
+  return getCachedShape(
+      key, center, [&diameter]() { return Path::circle(diameter); },
+      maxArcTolerance);
+}
+
+ClipperLib::Path ClipperHelpers::convertObround(
+    const Point& p1, const Point& p2, const PositiveLength& width,
+    const PositiveLength& maxArcTolerance) noexcept {
+  const Point vector = p2 - p1;
+  const ShapeCacheKey key(1, vector.getX().toNm(), vector.getY().toNm(),
+                          width->toNm(), maxArcTolerance->toNm());
+  return getCachedShape(
+      key, p1,
+      [&vector, &width]() {
+        return Path::obround(Point(0, 0), vector, width);
+      },
+      maxArcTolerance);
+}
+
+ClipperHelpers::ShapeCacheStatistics
+    ClipperHelpers::getShapeCacheStatistics() noexcept {
+  return ShapeCacheStatistics{sShapeCacheHits.load(),
+                              sShapeCacheMisses.load()};
+}
+
 /*******************************************************************************
  *  Internal Helper Methods
  ******************************************************************************/
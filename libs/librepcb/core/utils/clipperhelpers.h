@@ -47,6 +47,15 @@ class ClipperHelpers final {
   Q_DECLARE_TR_FUNCTIONS(ClipperHelpers)
 
 public:
+  // Types
+
+  /// Hit/miss counters of the cache used by #convertCircle() and
+  /// #convertObround()
+  struct ShapeCacheStatistics {
+    quint64 hits;
+    quint64 misses;
+  };
+
   // Disable instantiation
   ClipperHelpers() = delete;
   ~ClipperHelpers() = delete;
@@ -107,6 +116,50 @@ public:
       const Path& path, const PositiveLength& maxArcTolerance) noexcept;
   static ClipperLib::IntPoint convert(const Point& point) noexcept;
 
+  /**
+   * @brief Convert a circle to a flattened Clipper path
+   *
+   * Equivalent to `convert(Path::circle(diameter).translated(center))`, but
+   * the flattened circle is cached per diameter and tolerance and only
+   * translated to the center. This method is thread-safe.
+   *
+   * @note  The vertices may differ from the uncached conversion by up to 1nm
+   *        due to rounding.
+   *
+   * @param center          Center of the circle.
+   * @param diameter        Diameter of the circle.
+   * @param maxArcTolerance Maximum tolerance when flattening arcs.
+   *
+   * @return Flattened circle.
+   */
+  static ClipperLib::Path convertCircle(
+      const Point& center, const PositiveLength& diameter,
+      const PositiveLength& maxArcTolerance) noexcept;
+
+  /**
+   * @brief Convert an obround to a flattened Clipper path
+   *
+   * Equivalent to `convert(Path::obround(p1, p2, width))`, but the flattened
+   * obround is cached per vector from p1 to p2, width and tolerance, and only
+   * translated to p1. So it is reused for traces of the same length and
+   * direction. This method is thread-safe.
+   *
+   * @note  The vertices may differ from the uncached conversion by up to 1nm
+   *        due to rounding.
+   *
+   * @param p1              Center of the first end.
+   * @param p2              Center of the second end.
+   * @param width           Width of the obround.
+   * @param maxArcTolerance Maximum tolerance when flattening arcs.
+   *
+   * @return Flattened obround.
+   */
+  static ClipperLib::Path convertObround(
+      const Point& p1, const Point& p2, const PositiveLength& width,
+      const PositiveLength& maxArcTolerance) noexcept;
+
+  static ShapeCacheStatistics getShapeCacheStatistics() noexcept;
+
 private:  // Internal Helper Methods
   static ClipperLib::Path convertHolesToCutIns(const ClipperLib::Path& outline,
                                                const ClipperLib::Paths& holes);
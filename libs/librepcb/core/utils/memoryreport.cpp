@@ -0,0 +1,156 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "memoryreport.h"
+
+#include <QtCore>
+
+#include <functional>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+MemoryReport::MemoryReport() noexcept : mEntries(), mIndices() {
+}
+
+MemoryReport::~MemoryReport() noexcept {
+}
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 MemoryReport::getTotalBytes(const QString& category) const noexcept {
+  const QString prefix = category % "/";
+  qint64 bytes = 0;
+  foreach (const Entry& entry, mEntries) {
+    if (category.isEmpty() || (entry.category == category) ||
+        entry.category.startsWith(prefix)) {
+      bytes += entry.bytes;
+    }
+  }
+  return bytes;
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void MemoryReport::add(const QString& category, qint64 bytes,
+                       int count) noexcept {
+  auto it = mIndices.find(category);
+  if (it != mIndices.end()) {
+    Entry& entry = mEntries[it.value()];
+    entry.bytes += bytes;
+    entry.count += count;
+  } else {
+    mIndices.insert(category, mEntries.count());
+    mEntries.append(Entry{category, bytes, count});
+  }
+}
+
+QStringList MemoryReport::toLines(const QString& indent) const noexcept {
+  // Determine the direct children of a category, in order of occurrence.
+  auto getChildren = [this](const QString& parent) {
+    const QString prefix = parent.isEmpty() ? QString() : (parent % "/");
+    QStringList children;
+    foreach (const Entry& entry, mEntries) {
+      if (entry.category.startsWith(prefix) &&
+          (entry.category.length() > prefix.length())) {
+        const QString name =
+            entry.category.mid(prefix.length()).section('/', 0, 0);
+        if (!children.contains(name)) {
+          children.append(name);
+        }
+      }
+    }
+    return children;
+  };
+
+  QStringList lines;
+  std::function<void(const QString&, int)> addLines =
+      [&](const QString& parent, int depth) {
+        foreach (const QString& name, getChildren(parent)) {
+          const QString category =
+              parent.isEmpty() ? name : (parent % "/" % name);
+          QString line = indent % QString(depth * 2, ' ') % name % ": " %
+              formatBytes(getTotalBytes(category));
+          auto it = mIndices.find(category);
+          if ((it != mIndices.end()) && (mEntries.at(it.value()).count > 1)) {
+            line += QString(" (%1)").arg(mEntries.at(it.value()).count);
+          }
+          lines.append(line);
+          addLines(category, depth + 1);
+        }
+      };
+  addLines(QString(), 0);
+  return lines;
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+QString MemoryReport::formatBytes(qint64 bytes) noexcept {
+  // Note: Not using QLocale::formattedDataSize() to get locale-independent
+  // output which is required for the command line interface.
+  if (bytes < 1024) {
+    return QString("%1 B").arg(bytes);
+  } else if (bytes < 1024 * 1024) {
+    return QString("%1 KiB").arg(bytes / 1024.0, 0, 'f', 1);
+  } else if (bytes < 1024 * 1024 * 1024) {
+    return QString("%1 MiB").arg(bytes / (1024.0 * 1024.0), 0, 'f', 1);
+  } else {
+    return QString("%1 GiB").arg(bytes / (1024.0 * 1024.0 * 1024.0), 0, 'f',
+                                 1);
+  }
+}
+
+qint64 MemoryReport::estimate(const QString& str) noexcept {
+  return (str.capacity() > 0)
+      ? (str.capacity() * static_cast<qint64>(sizeof(QChar)) +
+         getAllocationOverhead())
+      : 0;
+}
+
+qint64 MemoryReport::estimate(const QByteArray& data) noexcept {
+  return (data.capacity() > 0) ? (data.capacity() + getAllocationOverhead())
+                               : 0;
+}
+
+qint64 MemoryReport::getAllocationOverhead() noexcept {
+  // Reference counter & size of implicitly shared Qt containers, or control
+  // block of std::shared_ptr.
+  return 2 * sizeof(void*);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
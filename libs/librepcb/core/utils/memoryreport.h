@@ -0,0 +1,153 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_MEMORYREPORT_H
+#define LIBREPCB_CORE_MEMORYREPORT_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class MemoryReport
+ ******************************************************************************/
+
+/**
+ * @brief Collects the approximate memory footprint of objects by category
+ *
+ * Model classes and caches implement either a `getApproxMemoryUsage()` method
+ * returning their own footprint in bytes (e.g. ::librepcb::Path), or a
+ * `reportMemoryUsage()` method adding a breakdown of their content to a
+ * memory report (e.g. ::librepcb::Board).
+ *
+ * Categories are hierarchical, separated by a slash (e.g.
+ * `"Board 'default'/Planes"`). The reported numbers are estimations based on
+ * object sizes and container capacities, they do not include allocator
+ * overhead or fragmentation. They are intended to compare the footprint of
+ * different parts of a project, not to exactly match the process memory.
+ */
+class MemoryReport final {
+  Q_DECLARE_TR_FUNCTIONS(MemoryReport)
+
+public:
+  // Types
+  struct Entry {
+    QString category;
+    qint64 bytes;
+    int count;
+  };
+
+  // Constructors / Destructor
+  MemoryReport() noexcept;
+  MemoryReport(const MemoryReport& other) = default;
+  ~MemoryReport() noexcept;
+
+  // Getters
+
+  /**
+   * @brief Get all entries, in the order of their first occurrence
+   *
+   * @return All reported categories.
+   */
+  const QList<Entry>& getEntries() const noexcept { return mEntries; }
+
+  /**
+   * @brief Get the total number of bytes of a category and its subcategories
+   *
+   * @param category  The category. If empty, the sum of all entries is
+   *                  returned.
+   *
+   * @return Number of bytes.
+   */
+  qint64 getTotalBytes(const QString& category = QString()) const noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Add bytes to a category
+   *
+   * Adding to an already existing category accumulates bytes and count.
+   *
+   * @param category  The (hierarchical) category.
+   * @param bytes     Number of bytes to add.
+   * @param count     Number of objects the bytes belong to.
+   */
+  void add(const QString& category, qint64 bytes, int count = 1) noexcept;
+
+  /**
+   * @brief Render the report as an indented tree
+   *
+   * Parent categories show the total of their subcategories.
+   *
+   * @param indent  Indentation prepended to every line.
+   *
+   * @return Lines of the report.
+   */
+  QStringList toLines(const QString& indent = QString()) const noexcept;
+
+  // Static Methods
+
+  /**
+   * @brief Format a number of bytes in a human readable way
+   *
+   * @param bytes   Number of bytes.
+   *
+   * @return Formatted string, e.g. "1.5 MiB".
+   */
+  static QString formatBytes(qint64 bytes) noexcept;
+
+  /// Approximate heap footprint of a string
+  static qint64 estimate(const QString& str) noexcept;
+
+  /// Approximate heap footprint of a byte array
+  static qint64 estimate(const QByteArray& data) noexcept;
+
+  /// Approximate heap footprint of a vector of trivial elements
+  template <typename T>
+  static qint64 estimate(const QVector<T>& vector) noexcept {
+    return vector.capacity() > 0
+        ? (vector.capacity() * static_cast<qint64>(sizeof(T)) +
+           getAllocationOverhead())
+        : 0;
+  }
+
+  /// Approximate overhead of a single heap allocation (e.g. a shared pointer)
+  static qint64 getAllocationOverhead() noexcept;
+
+  // Operator Overloadings
+  MemoryReport& operator=(const MemoryReport& rhs) = default;
+
+private:  // Data
+  QList<Entry> mEntries;
+  QHash<QString, int> mIndices;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
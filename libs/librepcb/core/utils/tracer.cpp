@@ -0,0 +1,190 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "tracer.h"
+
+#include "../exceptions.h"
+#include "../fileio/fileutils.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Private Types
+ ******************************************************************************/
+
+namespace {
+
+struct TraceEvent {
+  const char* category;
+  const char* name;
+  QString detail;
+  qint64 startNs;
+  qint64 durationNs;
+  int threadId;
+};
+
+struct TraceState {
+  QMutex mutex;
+  FilePath filePath;
+  QElapsedTimer timer;
+  QVector<TraceEvent> events;
+  QHash<Qt::HANDLE, int> threadIds;
+  QStringList threadNames;  // Index = thread ID.
+};
+
+TraceState& state() noexcept {
+  static TraceState s;
+  return s;
+}
+
+int getThreadId(TraceState& s) noexcept {
+  const Qt::HANDLE handle = QThread::currentThreadId();
+  auto it = s.threadIds.find(handle);
+  if (it != s.threadIds.end()) {
+    return it.value();
+  }
+  const int id = s.threadNames.count();
+  QString name = QThread::currentThread()->objectName();
+  if (QCoreApplication* app = QCoreApplication::instance()) {
+    if (QThread::currentThread() == app->thread()) {
+      name = "Main";
+    }
+  }
+  if (name.isEmpty()) {
+    name = QString("Worker %1").arg(id);
+  }
+  s.threadIds.insert(handle, id);
+  s.threadNames.append(name);
+  return id;
+}
+
+}  // namespace
+
+/*******************************************************************************
+ *  Static Variables
+ ******************************************************************************/
+
+std::atomic<bool> Tracer::sEnabled(false);
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void Tracer::start(const FilePath& fp) noexcept {
+  TraceState& s = state();
+  QMutexLocker lock(&s.mutex);
+  s.filePath = fp;
+  s.events.clear();
+  s.threadIds.clear();
+  s.threadNames.clear();
+  s.timer.start();
+  sEnabled.store(true);
+  qInfo().noquote() << "Tracing enabled, writing trace to" << fp.toNative();
+}
+
+void Tracer::startFromEnvironment() noexcept {
+  const QString path = QString(qgetenv("LIBREPCB_TRACE_FILE")).trimmed();
+  if (!path.isEmpty()) {
+    start(FilePath(QFileInfo(path).absoluteFilePath()));
+  }
+}
+
+bool Tracer::stop() noexcept {
+  TraceState& s = state();
+  QMutexLocker lock(&s.mutex);
+  if (!sEnabled.exchange(false)) {
+    return true;
+  }
+
+  const qint64 pid = QCoreApplication::applicationPid();
+  QJsonArray events;
+  for (int i = 0; i < s.threadNames.count(); ++i) {
+    QJsonObject obj;
+    obj["name"] = "thread_name";
+    obj["ph"] = "M";
+    obj["pid"] = pid;
+    obj["tid"] = i;
+    obj["args"] = QJsonObject{{"name", s.threadNames.at(i)}};
+    events.append(obj);
+  }
+  foreach (const TraceEvent& event, s.events) {
+    // Note: Chrome expects timestamps in microseconds.
+    QJsonObject obj;
+    obj["name"] = event.name;
+    obj["cat"] = event.category;
+    obj["ph"] = "X";
+    obj["ts"] = event.startNs / 1000.0;
+    obj["dur"] = event.durationNs / 1000.0;
+    obj["pid"] = pid;
+    obj["tid"] = event.threadId;
+    if (!event.detail.isEmpty()) {
+      obj["args"] = QJsonObject{{"detail", event.detail}};
+    }
+    events.append(obj);
+  }
+  const int count = s.events.count();
+  s.events.clear();
+  s.threadIds.clear();
+  s.threadNames.clear();
+
+  QJsonObject root;
+  root["traceEvents"] = events;
+  root["displayTimeUnit"] = "ms";
+  try {
+    const QByteArray content =
+        QJsonDocument(root).toJson(QJsonDocument::Compact);
+    FileUtils::writeFile(s.filePath, content);  // can throw
+    qInfo().noquote() << "Wrote" << count << "trace events to"
+                      << s.filePath.toNative();
+    return true;
+  } catch (const Exception& e) {
+    qCritical().noquote() << "Failed to write trace file:" << e.getMsg();
+    return false;
+  }
+}
+
+qint64 Tracer::getTimestampNs() noexcept {
+  return state().timer.nsecsElapsed();
+}
+
+void Tracer::addEvent(const char* category, const char* name,
+                      const QString& detail, qint64 startNs,
+                      qint64 endNs) noexcept {
+  TraceState& s = state();
+  QMutexLocker lock(&s.mutex);
+  if (!isEnabled()) {
+    return;  // Tracing stopped while the scope was active.
+  }
+  s.events.append(TraceEvent{category, name, detail, startNs, endNs - startNs,
+                             getThreadId(s)});
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
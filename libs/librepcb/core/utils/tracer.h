@@ -0,0 +1,218 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_TRACER_H
+#define LIBREPCB_CORE_TRACER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../fileio/filepath.h"
+
+#include <QtCore>
+
+#include <atomic>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class Tracer
+ ******************************************************************************/
+
+/**
+ * @brief Records the duration of scoped operations into a trace file
+ *
+ * Tracing is disabled by default. After calling #start(), every
+ * ::librepcb::TraceScope records an event which is written to the trace file
+ * by #stop() in the Chrome trace event format. The file can be opened with
+ * https://ui.perfetto.dev or `chrome://tracing` to get a timeline of all
+ * operations on all threads.
+ *
+ * Tracing can also be enabled without recompiling or passing any command line
+ * argument by setting the environment variable `LIBREPCB_TRACE_FILE` to the
+ * path of the trace file to write (see #startFromEnvironment()).
+ *
+ * As long as tracing is disabled, a trace scope costs only a relaxed atomic
+ * load, so it is fine to place them on hot paths.
+ *
+ * @note All methods are thread-safe.
+ *
+ * @see ::librepcb::TraceScope, #LIBREPCB_TRACE_SCOPE
+ */
+class Tracer final {
+public:
+  // Constructors / Destructor
+  Tracer() = delete;
+  Tracer(const Tracer& other) = delete;
+  ~Tracer() = delete;
+
+  // General Methods
+
+  /**
+   * @brief Check whether tracing is currently enabled
+   *
+   * @return True if events are recorded, false if not.
+   */
+  static bool isEnabled() noexcept {
+    return sEnabled.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Enable tracing
+   *
+   * Previously recorded but not yet written events are discarded.
+   *
+   * @param fp    The file to write the trace to when calling #stop().
+   */
+  static void start(const FilePath& fp) noexcept;
+
+  /**
+   * @brief Enable tracing if the environment variable `LIBREPCB_TRACE_FILE`
+   *        is set
+   *
+   * Relative paths are interpreted relative to the current working directory.
+   */
+  static void startFromEnvironment() noexcept;
+
+  /**
+   * @brief Disable tracing and write all recorded events to the trace file
+   *
+   * Does nothing if tracing is not enabled.
+   *
+   * @return False if the trace file could not be written, true otherwise.
+   */
+  static bool stop() noexcept;
+
+  /**
+   * @brief Get the current timestamp of the trace clock
+   *
+   * @return Nanoseconds since tracing was started.
+   */
+  static qint64 getTimestampNs() noexcept;
+
+  /**
+   * @brief Record a completed operation
+   *
+   * Usually not called directly, use ::librepcb::TraceScope instead.
+   *
+   * @param category  Category of the event (must be a string literal).
+   * @param name      Name of the event (must be a string literal).
+   * @param detail    Optional detail, e.g. the processed file or layer.
+   * @param startNs   Start timestamp, see #getTimestampNs().
+   * @param endNs     End timestamp, see #getTimestampNs().
+   */
+  static void addEvent(const char* category, const char* name,
+                       const QString& detail, qint64 startNs,
+                       qint64 endNs) noexcept;
+
+  // Operator Overloadings
+  Tracer& operator=(const Tracer& rhs) = delete;
+
+private:  // Data
+  static std::atomic<bool> sEnabled;
+};
+
+/*******************************************************************************
+ *  Class TraceScope
+ ******************************************************************************/
+
+/**
+ * @brief Records the lifetime of a scope as ::librepcb::Tracer event
+ *
+ * Usually created with one of the #LIBREPCB_TRACE_SCOPE,
+ * #LIBREPCB_TRACE_SCOPE_DETAIL or #LIBREPCB_TRACE_FUNCTION macros. If tracing
+ * was disabled when entering the scope, nothing is recorded.
+ */
+class TraceScope final {
+public:
+  // Constructors / Destructor
+  TraceScope() = delete;
+  TraceScope(const TraceScope& other) = delete;
+  TraceScope(const char* category, const char* name,
+             const QString& detail = QString()) noexcept
+    : mCategory(category),
+      mName(name),
+      mDetail(detail),
+      mStartNs(Tracer::isEnabled() ? Tracer::getTimestampNs() : -1) {}
+  ~TraceScope() noexcept {
+    if (mStartNs >= 0) {
+      Tracer::addEvent(mCategory, mName, mDetail, mStartNs,
+                       Tracer::getTimestampNs());
+    }
+  }
+
+  // Operator Overloadings
+  TraceScope& operator=(const TraceScope& rhs) = delete;
+
+private:  // Data
+  const char* mCategory;
+  const char* mName;
+  QString mDetail;
+  qint64 mStartNs;
+};
+
+/*******************************************************************************
+ *  Macros
+ ******************************************************************************/
+
+#define LIBREPCB_TRACE_CONCAT_IMPL(a, b) a##b
+#define LIBREPCB_TRACE_CONCAT(a, b) LIBREPCB_TRACE_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Trace the rest of the current scope
+ *
+ * @param category  Category string literal, e.g. "drc".
+ * @param name      Name string literal, e.g. "checkVias".
+ */
+#define LIBREPCB_TRACE_SCOPE(category, name)                            \
+  const ::librepcb::TraceScope LIBREPCB_TRACE_CONCAT(traceScope, __LINE__)( \
+      category, name)
+
+/**
+ * @brief Trace the rest of the current scope with a detail string
+ *
+ * The detail expression is only evaluated if tracing is enabled.
+ *
+ * @param category  Category string literal, e.g. "planes".
+ * @param name      Name string literal, e.g. "layer".
+ * @param detail    Expression convertible to QString, e.g. a layer name.
+ */
+#define LIBREPCB_TRACE_SCOPE_DETAIL(category, name, detail)             \
+  const ::librepcb::TraceScope LIBREPCB_TRACE_CONCAT(traceScope, __LINE__)( \
+      category, name,                                                   \
+      ::librepcb::Tracer::isEnabled() ? QString(detail) : QString())
+
+/**
+ * @brief Trace the rest of the current function, named after the function
+ *
+ * @param category  Category string literal, e.g. "gerber".
+ */
+#define LIBREPCB_TRACE_FUNCTION(category) \
+  LIBREPCB_TRACE_SCOPE(category, __func__)
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
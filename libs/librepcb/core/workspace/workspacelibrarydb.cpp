@@ -285,6 +285,11 @@ void WorkspaceLibraryDb::startLibraryRescan() noexcept {
   mLibraryScanner->startScan();
 }
 
+void WorkspaceLibraryDb::startLibraryElementsRescan(
+    const QSet<FilePath>& elementDirs) noexcept {
+  mLibraryScanner->startElementsScan(elementDirs);
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
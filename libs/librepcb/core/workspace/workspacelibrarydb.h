@@ -406,6 +406,13 @@ public:
    */
   void startLibraryRescan() noexcept;
 
+  /**
+   * @brief Rescan only the given library elements and update the database
+   *
+   * @param elementDirs   Directories of the modified library elements.
+   */
+  void startLibraryElementsRescan(const QSet<FilePath>& elementDirs) noexcept;
+
   // Operator Overloadings
   WorkspaceLibraryDb& operator=(const WorkspaceLibraryDb& rhs) = delete;
 
@@ -33,6 +33,7 @@
 #include "../library/sym/symbol.h"
 #include "../sqlitedatabase.h"
 #include "../utils/toolbox.h"
+#include "../utils/tracer.h"
 #include "workspacelibrarydbwriter.h"
 
 #include <QtCore>
@@ -53,6 +54,9 @@ WorkspaceLibraryScanner::WorkspaceLibraryScanner(
     mDbFilePath(dbFilePath),
     mSemaphore(0),
     mAbort(false),
+    mScanPending(false),
+    mFullScanPending(false),
+    mPendingElementDirs(),
     mLastProgressPercent(100) {
   connect(
       this, &WorkspaceLibraryScanner::scanProgressUpdate, this,
@@ -83,6 +87,17 @@ WorkspaceLibraryScanner::~WorkspaceLibraryScanner() noexcept {
  ******************************************************************************/
 
 void WorkspaceLibraryScanner::startScan() noexcept {
+  QMutexLocker lock(&mPendingMutex);
+  mScanPending = true;
+  mFullScanPending = true;
+  mSemaphore.release();
+}
+
+void WorkspaceLibraryScanner::startElementsScan(
+    const QSet<FilePath>& elementDirs) noexcept {
+  QMutexLocker lock(&mPendingMutex);
+  mScanPending = true;
+  mPendingElementDirs |= elementDirs;
   mSemaphore.release();
 }
 
@@ -106,6 +121,24 @@ void WorkspaceLibraryScanner::run() noexcept {
 }
 
 void WorkspaceLibraryScanner::scan() noexcept {
+  LIBREPCB_TRACE_SCOPE("library", "scan");
+
+  // Take over the pending scan request. Multiple requests may have been
+  // merged into a single one, so there might be nothing left to do.
+  bool scanPending = false;
+  bool fullScan = false;
+  QSet<FilePath> elementDirs;
+  {
+    QMutexLocker lock(&mPendingMutex);
+    std::swap(scanPending, mScanPending);
+    std::swap(fullScan, mFullScanPending);
+    std::swap(elementDirs, mPendingElementDirs);
+  }
+  if (!scanPending) {
+    return;
+  }
+
+  bool committed = false;
   try {
     QElapsedTimer timer;
     timer.start();
@@ -132,17 +165,32 @@ void WorkspaceLibraryScanner::scan() noexcept {
     SQLiteDatabase::TransactionScopeGuard transactionGuard(db);  // can throw
 
     // clear all tables
-    writer.removeAllElements<ComponentCategory>();
-    writer.removeAllElements<PackageCategory>();
-    writer.removeAllElements<Symbol>();
-    writer.removeAllElements<Package>();
-    writer.removeAllElements<Component>();
-    writer.removeAllElements<Device>();
+    if (fullScan) {
+      writer.removeAllElements<ComponentCategory>();
+      writer.removeAllElements<PackageCategory>();
+      writer.removeAllElements<Symbol>();
+      writer.removeAllElements<Package>();
+      writer.removeAllElements<Component>();
+      writer.removeAllElements<Device>();
+    }
 
-    // scan all libraries
+    // rescan only the requested elements, if this is not a full scan
     int count = 0;
     qreal percent = 1;
-    foreach (const std::shared_ptr<Library>& lib, libraries) {
+    foreach (const FilePath& fp, fullScan ? QSet<FilePath>() : elementDirs) {
+      if (mAbort || (mSemaphore.available() > 0)) break;
+      count += updateElementInDb<ComponentCategory>(writer, fp, libIds);
+      count += updateElementInDb<PackageCategory>(writer, fp, libIds);
+      count += updateElementInDb<Symbol>(writer, fp, libIds);
+      count += updateElementInDb<Package>(writer, fp, libIds);
+      count += updateElementInDb<Component>(writer, fp, libIds);
+      count += updateElementInDb<Device>(writer, fp, libIds);
+      emit scanProgressUpdate(percent += qreal(98) / elementDirs.count());
+    }
+
+    // scan all libraries
+    foreach (const std::shared_ptr<Library>& lib,
+             fullScan ? libraries : QList<std::shared_ptr<Library>>()) {
       FilePath fp = lib->getDirectory().getAbsPath();
       Q_ASSERT(libIds.contains(fp));
       int libId = libIds[fp];
@@ -175,6 +223,7 @@ void WorkspaceLibraryScanner::scan() noexcept {
     // commit transaction
     if ((!mAbort) && (mSemaphore.available() == 0)) {
       transactionGuard.commit();  // can throw
+      committed = true;
       qDebug() << "Workspace library scan succeeded:" << count << "elements in"
                << timer.elapsed() << "ms.";
       emit scanSucceeded(count);
@@ -185,6 +234,16 @@ void WorkspaceLibraryScanner::scan() noexcept {
   } catch (const Exception& e) {
     qDebug() << "Workspace library scan failed:" << e.getMsg();
     emit scanFailed(e.getMsg());
+    committed = true;  // Don't retry, it would most likely fail again.
+  }
+
+  // If the scan was aborted due to a new request, merge this request into
+  // the new one to not lose any modified elements.
+  if (!committed) {
+    QMutexLocker lock(&mPendingMutex);
+    mScanPending = true;
+    mFullScanPending = mFullScanPending || fullScan;
+    mPendingElementDirs |= elementDirs;
   }
   emit scanProgressUpdate(100);
   emit scanFinished();
@@ -268,6 +327,24 @@ QHash<FilePath, int> WorkspaceLibraryScanner::updateLibraries(
   return dbLibIds;
 }
 
+template <typename ElementType>
+int WorkspaceLibraryScanner::updateElementInDb(
+    WorkspaceLibraryDbWriter& writer, const FilePath& fp,
+    const QHash<FilePath, int>& libIds) {
+  if (fp.getParentDir().getFilename() != ElementType::getShortElementName()) {
+    return 0;
+  }
+  writer.removeElement<ElementType>(fp);
+  const FilePath libPath = fp.getParentDir().getParentDir();
+  if ((!libIds.contains(libPath)) ||
+      (!LibraryBaseElement::isValidElementDirectory<ElementType>(fp))) {
+    return 0;  // Element or library has been removed.
+  }
+  return addElementsToDb<ElementType>(writer, libPath,
+                                      {fp.toRelative(libPath)},
+                                      libIds.value(libPath));
+}
+
 template <typename ElementType>
 int WorkspaceLibraryScanner::addElementsToDb(WorkspaceLibraryDbWriter& writer,
                                              const FilePath& libPath,
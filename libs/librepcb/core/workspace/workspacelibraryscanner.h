@@ -63,8 +63,24 @@ public:
   int getProgressPercent() const noexcept { return mLastProgressPercent; }
 
   // General Methods
+
+  /**
+   * @brief Rescan all libraries
+   */
   void startScan() noexcept;
 
+  /**
+   * @brief Rescan only some library elements
+   *
+   * Much faster than a full scan if only a few elements have been modified,
+   * e.g. after an incremental library update. The metadata of the libraries
+   * themselves is always updated.
+   *
+   * @param elementDirs   Library element directories to rescan. Directories
+   *                      which no longer exist are removed from the database.
+   */
+  void startElementsScan(const QSet<FilePath>& elementDirs) noexcept;
+
   // Operator Overloadings
   WorkspaceLibraryScanner& operator=(const WorkspaceLibraryScanner& rhs) =
       delete;
@@ -87,6 +103,9 @@ private:  // Methods
       SQLiteDatabase& db, WorkspaceLibraryDbWriter& writer,
       const QList<std::shared_ptr<Library>>& libs);
   template <typename ElementType>
+  int updateElementInDb(WorkspaceLibraryDbWriter& writer, const FilePath& fp,
+                        const QHash<FilePath, int>& libIds);
+  template <typename ElementType>
   int addElementsToDb(WorkspaceLibraryDbWriter& writer, const FilePath& libPath,
                       const QStringList& dirs, int libId);
   template <typename ElementType>
@@ -109,6 +128,10 @@ private:  // Data
   const FilePath mDbFilePath;  ///< Path to the SQLite database file.
   QSemaphore mSemaphore;
   volatile bool mAbort;
+  QMutex mPendingMutex;  ///< Protects the pending scan request below
+  bool mScanPending;  ///< Whether any scan was requested
+  bool mFullScanPending;  ///< Whether a full scan was requested
+  QSet<FilePath> mPendingElementDirs;  ///< Element dirs requested to rescan
   int mLastProgressPercent;
 };
 
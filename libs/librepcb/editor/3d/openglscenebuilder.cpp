@@ -22,9 +22,11 @@
  ******************************************************************************/
 #include "openglscenebuilder.h"
 
+#include "opengltrianglebuffer.h"
 #include "opengltriangleobject.h"
 
 #include <librepcb/core/3d/occmodel.h>
+#include <librepcb/core/application.h>
 #include <librepcb/core/exceptions.h>
 #include <librepcb/core/fileio/filesystem.h>
 #include <librepcb/core/fileio/fileutils.h>
@@ -33,6 +35,7 @@
 #include <librepcb/core/utils/clipperhelpers.h>
 #include <librepcb/core/utils/scopeguard.h>
 #include <librepcb/core/utils/toolbox.h>
+#include <librepcb/core/utils/tracer.h>
 #include <librepcb_build_env.h>
 
 #include <QtConcurrent>
@@ -64,7 +67,11 @@ namespace editor {
  ******************************************************************************/
 
 OpenGlSceneBuilder::OpenGlSceneBuilder(QObject* parent) noexcept
-  : QObject(parent), mMaxArcTolerance(5000), mFuture(), mAbort(false) {
+  : QObject(parent),
+    mMaxArcTolerance(5000),
+    mFuture(),
+    mAbort(false),
+    mMeshCache(Application::getCacheDir().getPathTo("3d-models")) {
   qRegisterMetaType<std::shared_ptr<OpenGlObject>>();
 }
 
@@ -108,6 +115,8 @@ void OpenGlSceneBuilder::run(std::shared_ptr<SceneData3D> data) noexcept {
   // Note: This method is called from a different thread, thus be careful with
   //       calling other methods to only call thread-safe methods!
 
+  LIBREPCB_TRACE_SCOPE("scene", "build3d");
+
   QElapsedTimer timer;
   timer.start();
   qDebug() << "Start building board 3D scene in worker thread...";
@@ -275,16 +284,52 @@ void OpenGlSceneBuilder::run(std::shared_ptr<SceneData3D> data) noexcept {
       if (mAbort) return;
     }
 
-    // Add/update devices.
-    QSet<Uuid> deviceUuids;
+    // Read the STEP files of all devices. Models which are not loaded yet
+    // are loaded (or fetched from the cache) and tesselated in parallel on
+    // the global thread pool, each unique model only once.
+    QVector<QByteArray> deviceKeys;
+    QHash<QByteArray, QFuture<StepModel>> futures;
     if (std::shared_ptr<FileSystem> fs = data->getFileSystem()) {
       for (const auto& obj : data->getDevices()) {
         const QByteArray content = fs->readIfExists(obj.stepFile);
-        publishDevice(obj, content, d + 0.067, scaleFactor,
-                      data->getStepAlphaValue());
-        deviceUuids.insert(obj.uuid);
-        if (mAbort) return;
+        const QByteArray key = MeshCache::calcKey(content);
+        if ((!mStepModels.contains(key)) && (!futures.contains(key))) {
+#if (QT_VERSION_MAJOR >= 6)
+          futures.insert(key,
+                         QtConcurrent::run(&OpenGlSceneBuilder::loadStepModel,
+                                           this, key, content, obj.name));
+#else
+          futures.insert(key,
+                         QtConcurrent::run(this,
+                                           &OpenGlSceneBuilder::loadStepModel,
+                                           key, content, obj.name));
+#endif
+        }
+        deviceKeys.append(key);
+      }
+    }
+    for (auto it = futures.begin(); it != futures.end(); ++it) {
+      // Upload each model only once, all devices share the same buffers.
+      const StepModel model = it.value().result();  // Blocks.
+      if (mAbort) continue;  // Don't keep incomplete models.
+      QMap<Color, std::shared_ptr<OpenGlTriangleBuffer>> buffers;
+      for (auto modelIt = model.begin(); modelIt != model.end(); modelIt++) {
+        buffers.insert(modelIt.key(),
+                       std::make_shared<OpenGlTriangleBuffer>(modelIt.value()));
       }
+      mStepModels.insert(it.key(), buffers);
+    }
+    futures.clear();
+    if (mAbort) return;
+
+    // Add/update devices in their original order.
+    QSet<Uuid> deviceUuids;
+    for (int i = 0; i < deviceKeys.count(); ++i) {
+      const SceneData3D::DeviceData& obj = data->getDevices().at(i);
+      publishDevice(obj, deviceKeys.at(i), d + 0.067, scaleFactor,
+                    data->getStepAlphaValue());
+      deviceUuids.insert(obj.uuid);
+      if (mAbort) return;
     }
 
     // Remove all no longer existing devices.
@@ -294,6 +339,17 @@ void OpenGlSceneBuilder::run(std::shared_ptr<SceneData3D> data) noexcept {
       }
     }
 
+    // Release all no longer used models. Their vertex buffers are destroyed
+    // once the removed devices are not drawn anymore.
+    const QSet<QByteArray> usedKeys = Toolbox::toSet(deviceKeys);
+    for (auto it = mStepModels.begin(); it != mStepModels.end();) {
+      if (usedKeys.contains(it.key())) {
+        ++it;
+      } else {
+        it = mStepModels.erase(it);
+      }
+    }
+
     qDebug() << "Successfully built 3D scene in" << timer.elapsed() << "ms.";
   } catch (const Exception& e) {
     qCritical().noquote() << "Failed to build 3D scene after" << timer.elapsed()
@@ -421,24 +477,32 @@ void OpenGlSceneBuilder::publishTriangleData(
   }
 }
 
-void OpenGlSceneBuilder::publishDevice(const SceneData3D::DeviceData& obj,
-                                       const QByteArray& stepContent, qreal z,
-                                       qreal scaleFactor, qreal alpha) {
+OpenGlSceneBuilder::StepModel OpenGlSceneBuilder::loadStepModel(
+    const QByteArray& key, const QByteArray& stepContent,
+    const QString& name) const noexcept {
   StepModel model;
-  if (mStepModels.contains(stepContent)) {
-    model = mStepModels.value(stepContent);
-  } else {
-    if (stepContent.size()) {
+  if (stepContent.size() && (!mAbort)) {
+    if (tl::optional<StepModel> cachedModel = mMeshCache.load(key)) {
+      model = *cachedModel;
+    } else {
       try {
         std::unique_ptr<OccModel> occModel = OccModel::loadStep(stepContent);
         model = occModel->tesselate();
+        mMeshCache.store(key, model);
       } catch (const Exception& e) {
         qCritical().nospace()
-            << "Failed to draw 3D model of " << obj.name << ": " << e.getMsg();
+            << "Failed to draw 3D model of " << name << ": " << e.getMsg();
       }
     }
-    mStepModels.insert(stepContent, model);
   }
+  return model;
+}
+
+void OpenGlSceneBuilder::publishDevice(const SceneData3D::DeviceData& obj,
+                                       const QByteArray& key, qreal z,
+                                       qreal scaleFactor, qreal alpha) {
+  const QMap<Color, std::shared_ptr<OpenGlTriangleBuffer>> model =
+      mStepModels.value(key);
 
   QMatrix4x4 m;
   m.scale(scaleFactor);
@@ -464,10 +528,6 @@ void OpenGlSceneBuilder::publishDevice(const SceneData3D::DeviceData& obj,
     }
   }
   for (auto it = model.begin(); it != model.end(); it++) {
-    QVector<QVector3D> vertices = it.value();
-    for (auto& vertex : vertices) {
-      vertex = m.map(vertex);
-    }
     std::shared_ptr<OpenGlTriangleObject> obj = items.value(it.key());
     QColor color = QColor::fromRgbF(
         std::get<0>(it.key()), std::get<1>(it.key()), std::get<2>(it.key()));
@@ -475,11 +535,11 @@ void OpenGlSceneBuilder::publishDevice(const SceneData3D::DeviceData& obj,
       color.setAlphaF(alpha);
     }
     if (obj) {
-      obj->setData(color, vertices);
+      obj->setData(color, it.value(), m);
       emit objectUpdated(obj);
     } else {
       obj = std::make_shared<OpenGlTriangleObject>();
-      obj->setData(color, vertices);
+      obj->setData(color, it.value(), m);
       items[it.key()] = obj;
       emit objectAdded(obj);
     }
@@ -23,6 +23,7 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
+#include <librepcb/core/3d/meshcache.h>
 #include <librepcb/core/3d/scenedata3d.h>
 #include <polyclipping/clipper.hpp>
 
@@ -37,6 +38,7 @@ namespace librepcb {
 namespace editor {
 
 class OpenGlObject;
+class OpenGlTriangleBuffer;
 class OpenGlTriangleObject;
 
 /*******************************************************************************
@@ -105,9 +107,10 @@ private:  // Methods
                                       qreal scaleFactor);
   void publishTriangleData(const QString& id, const QColor& color,
                            const QVector<QVector3D>& triangles);
-  void publishDevice(const SceneData3D::DeviceData& obj,
-                     const QByteArray& stepContent, qreal z, qreal scaleFactor,
-                     qreal alpha);
+  StepModel loadStepModel(const QByteArray& key, const QByteArray& stepContent,
+                          const QString& name) const noexcept;
+  void publishDevice(const SceneData3D::DeviceData& obj, const QByteArray& key,
+                     qreal z, qreal scaleFactor, qreal alpha);
 
 private:  // Data
   const PositiveLength mMaxArcTolerance;
@@ -117,7 +120,11 @@ private:  // Data
   // Thread data.
   QHash<QString, std::shared_ptr<OpenGlTriangleObject>> mBoardObjects;
   QHash<Uuid, QMap<Color, std::shared_ptr<OpenGlTriangleObject>>> mDevices;
-  QHash<QByteArray, StepModel> mStepModels;  ///< Cache
+  /// Vertex buffers of all loaded models, shared by all devices using the
+  /// same model (key: MeshCache::calcKey())
+  QHash<QByteArray, QMap<Color, std::shared_ptr<OpenGlTriangleBuffer>>>
+      mStepModels;
+  const MeshCache mMeshCache;  ///< Persistent cache of tesselated models
 };
 
 /*******************************************************************************
@@ -0,0 +1,95 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "opengltrianglebuffer.h"
+
+#include <QtCore>
+#include <QtOpenGL>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace editor {
+
+QMutex OpenGlTriangleBuffer::sDestroyedBuffersMutex;
+QList<QOpenGLBuffer> OpenGlTriangleBuffer::sDestroyedBuffers;
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+OpenGlTriangleBuffer::OpenGlTriangleBuffer(
+    const QVector<QVector3D>& triangles) noexcept
+  : mBuffer(QOpenGLBuffer::VertexBuffer),
+    mCount(triangles.count()),
+    mMutex(),
+    mNewTriangles(triangles) {
+}
+
+OpenGlTriangleBuffer::~OpenGlTriangleBuffer() noexcept {
+  if (mBuffer.isCreated()) {
+    // Note: QOpenGLBuffer is implicitly shared, i.e. this doesn't copy data.
+    QMutexLocker lock(&sDestroyedBuffersMutex);
+    sDestroyedBuffers.append(mBuffer);
+  }
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+int OpenGlTriangleBuffer::bind() noexcept {
+  QMutexLocker lock(&mMutex);
+  if (!mBuffer.isCreated()) {
+    mBuffer.create();
+  }
+  mBuffer.bind();
+  if (mNewTriangles) {
+    mBuffer.allocate(mNewTriangles->data(),
+                     mNewTriangles->count() * sizeof(QVector3D));
+    mNewTriangles = tl::nullopt;  // Release memory, not needed anymore.
+  }
+  return mCount;
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+void OpenGlTriangleBuffer::releaseDestroyedBuffers() noexcept {
+  QList<QOpenGLBuffer> buffers;
+  {
+    QMutexLocker lock(&sDestroyedBuffersMutex);
+    std::swap(buffers, sDestroyedBuffers);
+  }
+  for (QOpenGLBuffer& buffer : buffers) {
+    buffer.destroy();
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace librepcb
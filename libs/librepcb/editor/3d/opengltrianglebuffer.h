@@ -0,0 +1,104 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_EDITOR_OPENGLTRIANGLEBUFFER_H
+#define LIBREPCB_EDITOR_OPENGLTRIANGLEBUFFER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <optional/tl/optional.hpp>
+
+#include <QtCore>
+#include <QtOpenGL>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace editor {
+
+/*******************************************************************************
+ *  Class OpenGlTriangleBuffer
+ ******************************************************************************/
+
+/**
+ * @brief Vertex buffer containing triangles of a 3D mesh
+ *
+ * A buffer can be shared by several ::librepcb::editor::OpenGlTriangleObject
+ * instances (e.g. all devices using the same 3D model), each of them drawing
+ * the triangles with its own transformation. The triangles are kept in RAM
+ * only until they are uploaded to the graphics memory.
+ *
+ * @note The constructor and destructor are thread-safe, i.e. buffers can be
+ *       created and destroyed in any thread. #bind() and
+ *       #releaseDestroyedBuffers() must be called from the OpenGL thread.
+ */
+class OpenGlTriangleBuffer final {
+public:
+  // Constructors / Destructor
+  OpenGlTriangleBuffer() = delete;
+  OpenGlTriangleBuffer(const OpenGlTriangleBuffer& other) = delete;
+  explicit OpenGlTriangleBuffer(const QVector<QVector3D>& triangles) noexcept;
+  ~OpenGlTriangleBuffer() noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Bind the buffer (upload the triangles first, if not done yet)
+   *
+   * @return Number of vertices in the buffer.
+   */
+  int bind() noexcept;
+
+  // Static Methods
+
+  /**
+   * @brief Release the graphics memory of destroyed buffers
+   *
+   * The last reference to a buffer might be dropped in any thread and
+   * without a current OpenGL context, thus the destructor only memorizes the
+   * OpenGL buffer. This method actually releases them and must be called
+   * while the OpenGL context is current (e.g. by
+   * ::librepcb::editor::OpenGlView).
+   */
+  static void releaseDestroyedBuffers() noexcept;
+
+  // Operator Overloadings
+  OpenGlTriangleBuffer& operator=(const OpenGlTriangleBuffer& rhs) = delete;
+
+private:  // Data
+  QOpenGLBuffer mBuffer;
+  int mCount;
+
+  QMutex mMutex;
+  tl::optional<QVector<QVector3D>> mNewTriangles;
+
+  static QMutex sDestroyedBuffersMutex;
+  static QList<QOpenGLBuffer> sDestroyedBuffers;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace librepcb
+
+#endif
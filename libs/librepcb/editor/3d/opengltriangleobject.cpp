@@ -22,6 +22,8 @@
  ******************************************************************************/
 #include "opengltriangleobject.h"
 
+#include "opengltrianglebuffer.h"
+
 #include <QtCore>
 #include <QtOpenGL>
 
@@ -36,15 +38,10 @@ namespace editor {
  ******************************************************************************/
 
 OpenGlTriangleObject::OpenGlTriangleObject() noexcept
-  : mBuffer(QOpenGLBuffer::VertexBuffer),
-    mCount(0),
-    mMutex(),
-    mColor(Qt::black),
-    mNewTriangles() {
+  : mMutex(), mColor(Qt::black), mBuffer(), mTransform() {
 }
 
 OpenGlTriangleObject::~OpenGlTriangleObject() noexcept {
-  mBuffer.destroy();
 }
 
 /*******************************************************************************
@@ -53,35 +50,41 @@ OpenGlTriangleObject::~OpenGlTriangleObject() noexcept {
 
 void OpenGlTriangleObject::setData(const QColor& color,
                                    const QVector<QVector3D>& data) noexcept {
+  setData(color, std::make_shared<OpenGlTriangleBuffer>(data), QMatrix4x4());
+}
+
+void OpenGlTriangleObject::setData(
+    const QColor& color, const std::shared_ptr<OpenGlTriangleBuffer>& buffer,
+    const QMatrix4x4& transform) noexcept {
   QMutexLocker lock(&mMutex);
   mColor = color;
-  mNewTriangles = data;
+  mBuffer = buffer;
+  mTransform = transform;
 }
 
 void OpenGlTriangleObject::draw(QOpenGLFunctions& gl,
                                 QOpenGLShaderProgram& program) noexcept {
-  // Update buffer, if needed.
+  QColor color;
+  std::shared_ptr<OpenGlTriangleBuffer> buffer;
+  QMatrix4x4 transform;
   {
     QMutexLocker lock(&mMutex);
-    if (!mBuffer.isCreated()) {
-      mBuffer.create();
-    }
-    mBuffer.bind();
-    if (mNewTriangles) {
-      mBuffer.allocate(mNewTriangles->data(),
-                       mNewTriangles->count() * sizeof(QVector3D));
-      mCount = mNewTriangles->count();
-      mNewTriangles = tl::nullopt;
-    }
+    color = mColor;
+    buffer = mBuffer;
+    transform = mTransform;
+  }
+  if (!buffer) {
+    return;
   }
 
-  program.setAttributeValue("a_color", mColor);
+  program.setAttributeValue("a_color", color);
+  program.setUniformValue("model_matrix", transform);
 
-  mBuffer.bind();
+  const int count = buffer->bind();
   int vertexLocation = program.attributeLocation("a_position");
   program.enableAttributeArray(vertexLocation);
   program.setAttributeBuffer(vertexLocation, GL_FLOAT, 0, 3, sizeof(QVector3D));
-  gl.glDrawArrays(GL_TRIANGLES, 0, mCount);
+  gl.glDrawArrays(GL_TRIANGLES, 0, count);
 }
 
 /*******************************************************************************
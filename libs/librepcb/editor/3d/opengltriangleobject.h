@@ -25,17 +25,19 @@
  ******************************************************************************/
 #include "openglobject.h"
 
-#include <optional/tl/optional.hpp>
-
 #include <QtCore>
 #include <QtOpenGL>
 
+#include <memory>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
 namespace librepcb {
 namespace editor {
 
+class OpenGlTriangleBuffer;
+
 /*******************************************************************************
  *  Class OpenGlTriangleObject
  ******************************************************************************/
@@ -52,6 +54,9 @@ public:
 
   // General Methods
   void setData(const QColor& color, const QVector<QVector3D>& data) noexcept;
+  void setData(const QColor& color,
+               const std::shared_ptr<OpenGlTriangleBuffer>& buffer,
+               const QMatrix4x4& transform) noexcept;
   virtual void draw(QOpenGLFunctions& gl,
                     QOpenGLShaderProgram& program) noexcept override;
 
@@ -59,12 +64,10 @@ public:
   OpenGlTriangleObject& operator=(const OpenGlTriangleObject& rhs) = delete;
 
 private:  // Data
-  QOpenGLBuffer mBuffer;
-  int mCount;
-
   QMutex mMutex;
   QColor mColor;
-  tl::optional<QVector<QVector3D>> mNewTriangles;
+  std::shared_ptr<OpenGlTriangleBuffer> mBuffer;  ///< Might be shared
+  QMatrix4x4 mTransform;
 };
 
 /*******************************************************************************
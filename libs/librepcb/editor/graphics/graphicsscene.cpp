@@ -82,6 +82,19 @@ void GraphicsScene::clearSelectionRect() noexcept {
   mSelectionRectItem->setRect(QRectF());
 }
 
+QSet<const QGraphicsItem*> GraphicsScene::findItemsInArea(
+    const QRectF& rect) const noexcept {
+  QSet<const QGraphicsItem*> result;
+  foreach (const QGraphicsItem* item,
+           items(rect, Qt::IntersectsItemBoundingRect)) {
+    while (item && (!result.contains(item))) {
+      result.insert(item);
+      item = item->parentItem();
+    }
+  }
+  return result;
+}
+
 QPixmap GraphicsScene::toPixmap(int dpi, const QColor& background) noexcept {
   QRectF rect = itemsBoundingRect();
   return toPixmap(QSize(qCeil(dpi * Length::fromPx(rect.width()).toInch()),
@@ -56,6 +56,22 @@ public:
   void setSelectionRectColors(const QColor& line, const QColor& fill) noexcept;
   void setSelectionRect(const Point& p1, const Point& p2) noexcept;
   void clearSelectionRect() noexcept;
+
+  /**
+   * @brief Get all items located within a given area
+   *
+   * This uses the spatial index (BSP tree) of the scene, so it is fast even
+   * for scenes containing a huge number of items. Since the bounding rect of
+   * an item does not necessarily contain the bounding rects of its children,
+   * all parents of matching items are added to the result as well.
+   *
+   * @param rect    The area in scene coordinates.
+   *
+   * @return All items (and their parents) whose bounding rect intersects
+   *         the passed area.
+   */
+  QSet<const QGraphicsItem*> findItemsInArea(const QRectF& rect) const
+      noexcept;
   QPixmap toPixmap(int dpi,
                    const QColor& background = Qt::transparent) noexcept;
   QPixmap toPixmap(const QSize& size,
@@ -0,0 +1,187 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_EDITOR_GRAPHICSSCENECACHE_H
+#define LIBREPCB_EDITOR_GRAPHICSSCENECACHE_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/core/types/uuid.h>
+
+#include <QtCore>
+#include <QtWidgets>
+
+#include <memory>
+#include <vector>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace editor {
+
+/*******************************************************************************
+ *  Class GraphicsSceneCache
+ ******************************************************************************/
+
+/**
+ * @brief LRU cache for graphics scenes of currently not visible pages/boards
+ *
+ * Creating the graphics scene of a large schematic page or board takes quite
+ * some time, so the editors keep the scenes of recently visited pages alive
+ * to make switching back to them instant. Since cached scenes stay connected
+ * to their schematic/board, they are kept up to date while not visible.
+ *
+ * The memory budget is specified as the total number of graphics items of
+ * all cached scenes. If the budget is exceeded, the least recently used
+ * scenes are destroyed. The default budget can be overridden with the
+ * environment variable `LIBREPCB_SCENE_CACHE_ITEMS` (0 disables caching).
+ *
+ * @tparam T  Type of the cached scenes (a QGraphicsScene subclass).
+ */
+template <typename T>
+class GraphicsSceneCache final {
+public:
+  // Constructors / Destructor
+  explicit GraphicsSceneCache(int maxCost = getDefaultMaxCost()) noexcept
+    : mMaxCost(maxCost), mEntries() {}
+  GraphicsSceneCache(const GraphicsSceneCache& other) = delete;
+  ~GraphicsSceneCache() noexcept {}
+
+  // Getters
+  int getMaxCost() const noexcept { return mMaxCost; }
+  int getTotalCost() const noexcept {
+    int cost = 0;
+    for (const Entry& entry : mEntries) {
+      cost += entry.cost;
+    }
+    return cost;
+  }
+  int getCount() const noexcept { return static_cast<int>(mEntries.size()); }
+  bool contains(const Uuid& key) const noexcept { return indexOf(key) >= 0; }
+  QList<Uuid> getKeys() const noexcept {
+    QList<Uuid> keys;
+    for (const Entry& entry : mEntries) {
+      keys.append(entry.key);
+    }
+    return keys;
+  }
+
+  // Setters
+  void setMaxCost(int cost) noexcept {
+    mMaxCost = cost;
+    trim();
+  }
+
+  // General Methods
+
+  /**
+   * @brief Remove a scene from the cache and pass its ownership to the caller
+   *
+   * @param key     UUID of the schematic/board.
+   *
+   * @return The cached scene, or nullptr if it is not cached.
+   */
+  std::unique_ptr<T> take(const Uuid& key) noexcept {
+    std::unique_ptr<T> scene;
+    const int index = indexOf(key);
+    if (index >= 0) {
+      scene = std::move(mEntries.at(index).scene);
+      mEntries.erase(mEntries.begin() + index);
+    }
+    return scene;
+  }
+
+  /**
+   * @brief Add a (no longer visible) scene to the cache
+   *
+   * The scene becomes the most recently used one. If the budget is exceeded
+   * afterwards, the least recently used scenes (possibly including the added
+   * one) are destroyed.
+   *
+   * @param key     UUID of the schematic/board.
+   * @param scene   The scene to add.
+   */
+  void insert(const Uuid& key, std::unique_ptr<T> scene) noexcept {
+    remove(key);
+    if (scene) {
+      const int cost = scene->items().count();
+      mEntries.insert(mEntries.begin(), Entry{key, std::move(scene), cost});
+      trim();
+    }
+  }
+
+  void remove(const Uuid& key) noexcept {
+    const int index = indexOf(key);
+    if (index >= 0) {
+      mEntries.erase(mEntries.begin() + index);
+    }
+  }
+
+  void clear() noexcept { mEntries.clear(); }
+
+  // Static Methods
+  static int getDefaultMaxCost() noexcept {
+    bool ok = false;
+    const int cost =
+        qEnvironmentVariableIntValue("LIBREPCB_SCENE_CACHE_ITEMS", &ok);
+    return ok ? cost : 200000;
+  }
+
+  // Operator Overloadings
+  GraphicsSceneCache& operator=(const GraphicsSceneCache& rhs) = delete;
+
+private:  // Methods
+  int indexOf(const Uuid& key) const noexcept {
+    for (int i = 0; i < getCount(); ++i) {
+      if (mEntries.at(i).key == key) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  void trim() noexcept {
+    int cost = getTotalCost();
+    while ((!mEntries.empty()) && (cost > mMaxCost)) {
+      cost -= mEntries.back().cost;
+      mEntries.pop_back();
+    }
+  }
+
+private:  // Data
+  struct Entry {
+    Uuid key;
+    std::unique_ptr<T> scene;
+    int cost;
+  };
+
+  int mMaxCost;
+  std::vector<Entry> mEntries;  ///< Most recently used first
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace librepcb
+
+#endif
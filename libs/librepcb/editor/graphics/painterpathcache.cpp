@@ -0,0 +1,80 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "painterpathcache.h"
+
+#include <librepcb/core/geometry/path.h>
+
+#include <QtCore>
+#include <QtGui>
+
+#include <algorithm>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace editor {
+
+/*******************************************************************************
+ *  Non-Member Functions
+ ******************************************************************************/
+
+struct PainterPathCacheData {
+  QMutex mutex;
+  // The cost of an entry is its number of vertices.
+  QCache<Path, QPainterPath> cache{100000};
+};
+
+static PainterPathCacheData& getCacheData() noexcept {
+  static PainterPathCacheData data;
+  return data;
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+QPainterPath PainterPathCache::get(const Path& path) noexcept {
+  PainterPathCacheData& data = getCacheData();
+  QMutexLocker lock(&data.mutex);
+  if (const QPainterPath* cached = data.cache.object(path)) {
+    return *cached;
+  }
+  const QPainterPath painterPath = path.toQPainterPathPx();
+  const int cost = std::max(static_cast<int>(path.getVertices().count()), 1);
+  data.cache.insert(path, new QPainterPath(painterPath), cost);
+  return painterPath;
+}
+
+void PainterPathCache::clear() noexcept {
+  PainterPathCacheData& data = getCacheData();
+  QMutexLocker lock(&data.mutex);
+  data.cache.clear();
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace librepcb
@@ -0,0 +1,89 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_EDITOR_PAINTERPATHCACHE_H
+#define LIBREPCB_EDITOR_PAINTERPATHCACHE_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+#include <QtGui>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class Path;
+
+namespace editor {
+
+/*******************************************************************************
+ *  Class PainterPathCache
+ ******************************************************************************/
+
+/**
+ * @brief Cache for QPainterPath representations of ::librepcb::Path objects
+ *
+ * ::librepcb::Path does not cache its QPainterPath since that would only
+ * waste memory in headless contexts like the command line interface. Graphics
+ * items often convert identical paths (e.g. the same footprint polygon of
+ * many devices, or all vias of the same size), so this cache keeps the
+ * converted paths keyed by their content. Thanks to implicit sharing, all
+ * graphics items of identical paths then share the same QPainterPath data.
+ *
+ * The cache is limited to a fixed number of vertices in total, the least
+ * recently used entries are dropped first. All methods are thread-safe.
+ */
+class PainterPathCache final {
+public:
+  // Constructors / Destructor
+  PainterPathCache() = delete;
+  PainterPathCache(const PainterPathCache& other) = delete;
+  ~PainterPathCache() = delete;
+
+  // Operator Overloadings
+  PainterPathCache& operator=(const PainterPathCache& rhs) = delete;
+
+  // Static Methods
+
+  /**
+   * @brief Get the QPainterPath of a path, converting it only if not cached
+   *
+   * @param path    The path to convert.
+   *
+   * @return Same as ::librepcb::Path::toQPainterPathPx().
+   */
+  static QPainterPath get(const Path& path) noexcept;
+
+  /**
+   * @brief Remove all entries from the cache
+   */
+  static void clear() noexcept;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace librepcb
+
+#endif
@@ -23,6 +23,7 @@
 #include "polygongraphicsitem.h"
 
 #include "graphicslayer.h"
+#include "painterpathcache.h"
 
 #include <librepcb/core/utils/toolbox.h>
 
@@ -216,7 +217,7 @@ void PolygonGraphicsItem::updatePath() noexcept {
     }
     mVertexHandles.append(VertexHandle{p, maxRadius.toPx()});
   }
-  setPath(mPolygon.getPathForRendering().toQPainterPathPx());
+  setPath(PainterPathCache::get(mPolygon.getPathForRendering()));
   updateBoundingRectMargin();
 }
 
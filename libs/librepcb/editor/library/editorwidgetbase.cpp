@@ -191,7 +191,7 @@ void EditorWidgetBase::setMessageApproved(
     LibraryBaseElement& element, std::shared_ptr<const RuleCheckMessage> msg,
     bool approve) noexcept {
   if (msg) {
-    QSet<SExpression> approvals = element.getMessageApprovals();
+    QSet<RuleCheckApproval> approvals = element.getMessageApprovals();
     if (approve) {
       approvals.insert(msg->getApproval());
     } else {
@@ -288,7 +288,7 @@ void EditorWidgetBase::updateCheckMessages() noexcept {
   try {
     RuleCheckMessageList msgs;
     if (runChecks(msgs)) {  // can throw
-      const QSet<SExpression> approvals =
+      const QSet<RuleCheckApproval> approvals =
           RuleCheckMessage::getAllApprovals(msgs);
       mSupportedApprovals |= approvals;
       mDisappearedApprovals = mSupportedApprovals - approvals;
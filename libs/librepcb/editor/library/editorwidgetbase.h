@@ -267,8 +267,8 @@ protected:  // Data
   QString mStatusBarMessage;
 
   // Memorized message approvals
-  QSet<SExpression> mSupportedApprovals;
-  QSet<SExpression> mDisappearedApprovals;
+  QSet<RuleCheckApproval> mSupportedApprovals;
+  QSet<RuleCheckApproval> mDisappearedApprovals;
 };
 
 inline QtCompat::Hash qHash(const EditorWidgetBase::Feature& feature,
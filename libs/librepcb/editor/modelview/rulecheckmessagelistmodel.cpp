@@ -0,0 +1,333 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "rulecheckmessagelistmodel.h"
+
+#include <librepcb/core/serialization/sexpression.h>
+
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace editor {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+RuleCheckMessageListModel::RuleCheckMessageListModel(QObject* parent) noexcept
+  : QAbstractListModel(parent),
+    mMessages(),
+    mApprovals(),
+    mFilter(),
+    mCollator(),
+    mItems(),
+    mRows(),
+    mPlaceholderVisible(false),
+    mPendingRows(),
+    mPendingRowsBegin(0),
+    mUnapprovedMessageCount(tl::nullopt) {
+  mCollator.setNumericMode(true);
+  mCollator.setCaseSensitivity(Qt::CaseInsensitive);
+  mCollator.setIgnorePunctuation(false);
+}
+
+RuleCheckMessageListModel::~RuleCheckMessageListModel() noexcept {
+}
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+std::shared_ptr<const RuleCheckMessage> RuleCheckMessageListModel::getMessage(
+    const QModelIndex& index) const noexcept {
+  if (index.isValid() && (!mPlaceholderVisible) && (index.row() >= 0) &&
+      (index.row() < rowCount())) {
+    return getRow(index.row()).item->msg;
+  } else {
+    return nullptr;
+  }
+}
+
+/*******************************************************************************
+ *  Setters
+ ******************************************************************************/
+
+void RuleCheckMessageListModel::setMessages(
+    const tl::optional<RuleCheckMessageList>& messages) noexcept {
+  if (messages != mMessages) {
+    mMessages = messages;
+
+    // Sort the messages only once, then updating the rows is cheap.
+    mItems.clear();
+    if (mMessages) {
+      mItems.reserve(mMessages->count());
+      foreach (const auto& msg, *mMessages) {
+        if (msg) {
+          mItems.push_back(std::make_shared<Item>(
+              Item{msg, getType(*msg), mCollator.sortKey(msg->getMessage())}));
+        }
+      }
+    }
+    std::sort(mItems.begin(), mItems.end(),
+              [](const std::shared_ptr<const Item>& lhs,
+                 const std::shared_ptr<const Item>& rhs) {
+                return lessThan(*lhs, *rhs);
+              });
+
+    updateRows();
+  }
+}
+
+void RuleCheckMessageListModel::setApprovals(
+    const QSet<RuleCheckApproval>& approvals) noexcept {
+  if (approvals != mApprovals) {
+    mApprovals = approvals;
+    updateRows();
+  }
+}
+
+void RuleCheckMessageListModel::setFilter(const QString& filter) noexcept {
+  const QString trimmed = filter.trimmed();
+  if (trimmed != mFilter) {
+    mFilter = trimmed;
+    updateRows();
+  }
+}
+
+/*******************************************************************************
+ *  Inherited from QAbstractItemModel
+ ******************************************************************************/
+
+int RuleCheckMessageListModel::rowCount(const QModelIndex& parent) const {
+  if (parent.isValid()) {
+    return 0;
+  } else if (mPlaceholderVisible) {
+    return 1;
+  } else {
+    return static_cast<int>(mRows.size() + mPendingRows.size() -
+                            mPendingRowsBegin);
+  }
+}
+
+QVariant RuleCheckMessageListModel::data(const QModelIndex& index,
+                                         int role) const {
+  if ((!index.isValid()) || (index.row() >= rowCount())) {
+    return QVariant();
+  }
+
+  if (mPlaceholderVisible) {
+    if (role == Qt::DisplayRole) {
+      return tr("Looks good so far :-)");
+    } else {
+      return QVariant();
+    }
+  }
+
+  const Row& row = getRow(index.row());
+  switch (role) {
+    case Qt::DisplayRole:
+    case Qt::ToolTipRole:
+      return row.item->msg->getMessage();
+    case Qt::DecorationRole:
+      return row.item->msg->getSeverityIcon();
+    case ApprovedRole:
+      return row.approved;
+    default:
+      return QVariant();
+  }
+}
+
+Qt::ItemFlags RuleCheckMessageListModel::flags(const QModelIndex& index) const {
+  if (mPlaceholderVisible) {
+    return Qt::NoItemFlags;
+  } else {
+    return QAbstractListModel::flags(index);
+  }
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void RuleCheckMessageListModel::updateRows() noexcept {
+  // Determine new rows. The items are already sorted, so it's enough to put
+  // the approved messages after the unapproved messages.
+  std::vector<bool> approved(mItems.size());
+  int unapprovedMessageCount = 0;
+  for (std::size_t i = 0; i < mItems.size(); ++i) {
+    approved[i] = mApprovals.contains(mItems.at(i)->msg->getApproval());
+    if (!approved[i]) {
+      ++unapprovedMessageCount;
+    }
+  }
+  std::vector<Row> newRows;
+  newRows.reserve(mItems.size());
+  for (bool approvedPass : {false, true}) {
+    for (std::size_t i = 0; i < mItems.size(); ++i) {
+      if ((approved[i] == approvedPass) &&
+          (mFilter.isEmpty() ||
+           mItems.at(i)->msg->getMessage().contains(mFilter,
+                                                    Qt::CaseInsensitive))) {
+        newRows.push_back(Row{mItems.at(i), approvedPass});
+      }
+    }
+  }
+
+  // Apply the differences between the old and new (both sorted) rows with
+  // as few row removals/insertions as possible, and in contiguous blocks to
+  // keep the overhead in attached views low. To avoid moving rows around in
+  // memory for every block, the old rows are moved to mPendingRows and the
+  // new rows are appended to mRows while processing the old rows.
+  setPlaceholderVisible(false);
+  Q_ASSERT(mPendingRows.empty());
+  mPendingRows.swap(mRows);
+  mPendingRowsBegin = 0;
+  const std::size_t oldCount = mPendingRows.size();
+  const std::size_t newCount = newRows.size();
+  std::size_t i = 0;  // Index in newRows, mRows equals newRows[0..i).
+  while ((mPendingRowsBegin < oldCount) || (i < newCount)) {
+    const std::size_t old = mPendingRowsBegin;
+    if ((old < oldCount) && (i < newCount) &&
+        isSame(mPendingRows.at(old), newRows.at(i))) {
+      mRows.push_back(newRows.at(i));  // Keep the new message object.
+      ++mPendingRowsBegin;
+      ++i;
+      continue;
+    }
+    const int row = static_cast<int>(mRows.size());
+
+    // Remove all old rows which are sorted before the next new row.
+    std::size_t removeCount = 0;
+    while ((old + removeCount < oldCount) &&
+           ((i >= newCount) ||
+            ((!isSame(mPendingRows.at(old + removeCount), newRows.at(i))) &&
+             (!lessThan(newRows.at(i), mPendingRows.at(old + removeCount)))))) {
+      ++removeCount;
+    }
+    if (removeCount > 0) {
+      beginRemoveRows(QModelIndex(), row,
+                      row + static_cast<int>(removeCount) - 1);
+      mPendingRowsBegin += removeCount;
+      endRemoveRows();
+      continue;
+    }
+
+    // Insert all new rows which are sorted before the next old row.
+    std::size_t insertCount = 0;
+    while ((i + insertCount < newCount) &&
+           ((old >= oldCount) ||
+            lessThan(newRows.at(i + insertCount), mPendingRows.at(old)))) {
+      ++insertCount;
+    }
+    Q_ASSERT(insertCount > 0);
+    beginInsertRows(QModelIndex(), row,
+                    row + static_cast<int>(insertCount) - 1);
+    mRows.insert(mRows.end(), newRows.begin() + i,
+                 newRows.begin() + i + insertCount);
+    endInsertRows();
+    i += insertCount;
+  }
+  mPendingRows.clear();
+  mPendingRowsBegin = 0;
+  setPlaceholderVisible(mMessages && mMessages->isEmpty());
+
+  // Update count of unapproved messages.
+  if (mMessages) {
+    mUnapprovedMessageCount = unapprovedMessageCount;
+  } else {
+    mUnapprovedMessageCount = tl::nullopt;
+  }
+}
+
+const RuleCheckMessageListModel::Row& RuleCheckMessageListModel::getRow(
+    int index) const noexcept {
+  const std::size_t i = static_cast<std::size_t>(index);
+  if (i < mRows.size()) {
+    return mRows.at(i);
+  } else {
+    return mPendingRows.at(mPendingRowsBegin + i - mRows.size());
+  }
+}
+
+void RuleCheckMessageListModel::setPlaceholderVisible(bool visible) noexcept {
+  Q_ASSERT((!visible) || mRows.empty());
+  if (visible && (!mPlaceholderVisible)) {
+    beginInsertRows(QModelIndex(), 0, 0);
+    mPlaceholderVisible = true;
+    endInsertRows();
+  } else if ((!visible) && mPlaceholderVisible) {
+    beginRemoveRows(QModelIndex(), 0, 0);
+    mPlaceholderVisible = false;
+    endRemoveRows();
+  }
+}
+
+bool RuleCheckMessageListModel::lessThan(const Item& lhs,
+                                         const Item& rhs) noexcept {
+  if (lhs.msg->getSeverity() != rhs.msg->getSeverity()) {
+    return lhs.msg->getSeverity() > rhs.msg->getSeverity();
+  } else if (lhs.type != rhs.type) {
+    return lhs.type < rhs.type;
+  } else {
+    return lhs.sortKey.compare(rhs.sortKey) < 0;
+  }
+}
+
+bool RuleCheckMessageListModel::lessThan(const Row& lhs,
+                                         const Row& rhs) noexcept {
+  if (lhs.approved != rhs.approved) {
+    return rhs.approved;
+  } else {
+    return lessThan(*lhs.item, *rhs.item);
+  }
+}
+
+bool RuleCheckMessageListModel::isSame(const Row& lhs,
+                                       const Row& rhs) noexcept {
+  return (lhs.approved == rhs.approved) &&
+      ((lhs.item->msg == rhs.item->msg) ||
+       ((*lhs.item->msg) == (*rhs.item->msg)));
+}
+
+QString RuleCheckMessageListModel::getType(
+    const RuleCheckMessage& msg) noexcept {
+  try {
+    // The approval node is of the form "(approved <type> ...)".
+    const SExpression& approval = msg.getApproval().getNode();
+    if (const SExpression* node = approval.tryGetChild("@0")) {
+      return node->getValue();
+    }
+  } catch (...) {
+  }
+  return QString();
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace librepcb
@@ -0,0 +1,150 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_EDITOR_RULECHECKMESSAGELISTMODEL_H
+#define LIBREPCB_EDITOR_RULECHECKMESSAGELISTMODEL_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/core/rulecheck/rulecheckmessage.h>
+#include <optional/tl/optional.hpp>
+
+#include <QtCore>
+
+#include <memory>
+#include <vector>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace editor {
+
+/*******************************************************************************
+ *  Class RuleCheckMessageListModel
+ ******************************************************************************/
+
+/**
+ * @brief List model for ::librepcb::RuleCheckMessage objects
+ *
+ * The messages are grouped by approval state, severity and message type, and
+ * sorted by their text within each group. Optionally they are filtered by a
+ * search text.
+ *
+ * Replacing the messages (e.g. after re-running a rule check) or changing
+ * the approvals or the filter does not reset the model. Instead, only the
+ * rows which actually changed are removed/inserted, so views keep their
+ * current item and scroll position and only need to update the affected
+ * rows. Together with a view which creates its items lazily (e.g. a
+ * QListView), this allows to display hundreds of thousands of messages.
+ *
+ * The messages are sorted only when they are set, so updating the approvals
+ * or the filter just needs a linear pass over the sorted messages. Also
+ * applying the differences to the displayed rows takes linear time.
+ *
+ * If there are no messages at all (but the rule check was run), a single
+ * placeholder row is shown for which getMessage() returns nullptr.
+ */
+class RuleCheckMessageListModel final : public QAbstractListModel {
+  Q_OBJECT
+
+public:
+  enum Role {
+    ApprovedRole = Qt::UserRole,  ///< bool
+  };
+
+  // Constructors / Destructor
+  RuleCheckMessageListModel(const RuleCheckMessageListModel& other) = delete;
+  explicit RuleCheckMessageListModel(QObject* parent = nullptr) noexcept;
+  ~RuleCheckMessageListModel() noexcept;
+
+  // Getters
+  const tl::optional<RuleCheckMessageList>& getMessages() const noexcept {
+    return mMessages;
+  }
+  const tl::optional<int>& getUnapprovedMessageCount() const noexcept {
+    return mUnapprovedMessageCount;
+  }
+  const QString& getFilter() const noexcept { return mFilter; }
+  std::shared_ptr<const RuleCheckMessage> getMessage(
+      const QModelIndex& index) const noexcept;
+
+  // Setters
+  void setMessages(const tl::optional<RuleCheckMessageList>& messages) noexcept;
+  void setApprovals(const QSet<RuleCheckApproval>& approvals) noexcept;
+  void setFilter(const QString& filter) noexcept;
+
+  // Inherited from QAbstractItemModel
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+  QVariant data(const QModelIndex& index,
+                int role = Qt::DisplayRole) const override;
+  Qt::ItemFlags flags(const QModelIndex& index) const override;
+
+  // Operator Overloadings
+  RuleCheckMessageListModel& operator=(const RuleCheckMessageListModel& rhs) =
+      delete;
+
+private:  // Types
+  /// Message data which does not depend on approvals and filter, thus it is
+  /// determined only once in #setMessages()
+  struct Item {
+    std::shared_ptr<const RuleCheckMessage> msg;
+    QString type;  ///< Message type, used for grouping
+    QCollatorSortKey sortKey;  ///< Sort key of the message text
+  };
+  struct Row {
+    std::shared_ptr<const Item> item;
+    bool approved;
+  };
+
+private:  // Methods
+  void updateRows() noexcept;
+  const Row& getRow(int index) const noexcept;
+  void setPlaceholderVisible(bool visible) noexcept;
+  static bool lessThan(const Item& lhs, const Item& rhs) noexcept;
+  static bool lessThan(const Row& lhs, const Row& rhs) noexcept;
+  static bool isSame(const Row& lhs, const Row& rhs) noexcept;
+  static QString getType(const RuleCheckMessage& msg) noexcept;
+
+private:  // Data
+  tl::optional<RuleCheckMessageList> mMessages;
+  QSet<RuleCheckApproval> mApprovals;
+  QString mFilter;
+  QCollator mCollator;
+  std::vector<std::shared_ptr<const Item>> mItems;  ///< Sorted, w/o approval
+  std::vector<Row> mRows;  ///< Displayed messages (sorted & filtered)
+  bool mPlaceholderVisible;  ///< Placeholder row, see class description
+
+  /// Old rows not processed yet while updating the rows. Until then, these
+  /// rows (starting at #mPendingRowsBegin) are displayed after #mRows.
+  std::vector<Row> mPendingRows;
+  std::size_t mPendingRowsBegin;
+
+  tl::optional<int> mUnapprovedMessageCount;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace librepcb
+
+#endif
@@ -114,6 +114,7 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project)
         mProjectEditor.getWorkspace().getSettings(), this)),
     mActiveBoard(nullptr),
     mGraphicsScene(),
+    mSceneCache(),
     mOpenGlSceneBuilder(),
     mOpenGlSceneBuildScheduled(false),
     mTimestampOfLastOpenGlSceneRebuild(0),
@@ -321,6 +322,14 @@ bool BoardEditor::setActiveBoardIndex(int index) noexcept {
 
     clearDrcMarker();  // Avoid dangling pointers.
     mUi->graphicsView->setScene(nullptr);
+    if (mGraphicsScene &&
+        mProject.getBoards().contains(&mGraphicsScene->getBoard())) {
+      // Keep the scene alive to make switching back to this board fast.
+      mGraphicsScene->clearSelection();
+      const Uuid uuid = mGraphicsScene->getBoard().getUuid();
+      mSceneCache.insert(
+          uuid, std::unique_ptr<BoardGraphicsScene>(mGraphicsScene.take()));
+    }
     mGraphicsScene.reset();
     mActiveBoard = newBoard;
 
@@ -330,17 +339,21 @@ bool BoardEditor::setActiveBoardIndex(int index) noexcept {
               &BoardEditor::updateEnabledCopperLayers);
       updateEnabledCopperLayers();
       loadLayersVisibility();
-      // show scene, restore view scene rect, set grid properties
-      mGraphicsScene.reset(new BoardGraphicsScene(
-          *mActiveBoard, *this, mProjectEditor.getHighlightedNetSignals()));
-      connect(&mProjectEditor, &ProjectEditor::highlightedNetSignalsChanged,
-              mGraphicsScene.data(),
-              &BoardGraphicsScene::updateHighlightedNetSignals);
-      const Theme& theme =
-          mProjectEditor.getWorkspace().getSettings().themes.getActive();
-      mGraphicsScene->setSelectionRectColors(
-          theme.getColor(Theme::Color::sBoardSelection).getPrimaryColor(),
-          theme.getColor(Theme::Color::sBoardSelection).getSecondaryColor());
+      // show scene (from cache, if available), restore view scene rect, set
+      // grid properties
+      mGraphicsScene.reset(mSceneCache.take(mActiveBoard->getUuid()).release());
+      if (!mGraphicsScene) {
+        mGraphicsScene.reset(new BoardGraphicsScene(
+            *mActiveBoard, *this, mProjectEditor.getHighlightedNetSignals()));
+        connect(&mProjectEditor, &ProjectEditor::highlightedNetSignalsChanged,
+                mGraphicsScene.data(),
+                &BoardGraphicsScene::updateHighlightedNetSignals);
+        const Theme& theme =
+            mProjectEditor.getWorkspace().getSettings().themes.getActive();
+        mGraphicsScene->setSelectionRectColors(
+            theme.getColor(Theme::Color::sBoardSelection).getPrimaryColor(),
+            theme.getColor(Theme::Color::sBoardSelection).getSecondaryColor());
+      }
       mUi->graphicsView->setScene(mGraphicsScene.data());
       const QRectF sceneRect = mVisibleSceneRect.value(mActiveBoard->getUuid());
       if (!sceneRect.isEmpty()) {
@@ -362,7 +375,7 @@ bool BoardEditor::setActiveBoardIndex(int index) noexcept {
     mDockDrc->setMessages(mActiveBoard ? mDrcMessages[mActiveBoard->getUuid()]
                                        : tl::nullopt);
     mDockDrc->setApprovals(mActiveBoard ? mActiveBoard->getDrcMessageApprovals()
-                                        : QSet<SExpression>());
+                                        : QSet<RuleCheckApproval>());
 
     // update toolbars
     mActionGridProperties->setEnabled(mActiveBoard != nullptr);
@@ -424,6 +437,13 @@ void BoardEditor::boardAdded(int newIndex) {
 }
 
 void BoardEditor::boardRemoved(int oldIndex) {
+  // Drop cached scenes of removed boards.
+  foreach (const Uuid& uuid, mSceneCache.getKeys()) {
+    if (!mProject.getBoardByUuid(uuid)) {
+      mSceneCache.remove(uuid);
+    }
+  }
+
   mUi->tabBar->removeTab(oldIndex);  // calls setActiveBoardIndex() if needed
 
   // To avoid wasting space, only show the tab bar if there are multiple boards.
@@ -1365,7 +1385,7 @@ void BoardEditor::runDrc(bool quick) noexcept {
     mDockDrc->setMessages(result.messages);
 
     // Detect & remove disappeared messages.
-    const QSet<SExpression> approvals =
+    const QSet<RuleCheckApproval> approvals =
         RuleCheckMessage::getAllApprovals(result.messages);
     if (board->updateDrcMessageApprovals(approvals, quick)) {
       mDockDrc->setApprovals(board->getDrcMessageApprovals());
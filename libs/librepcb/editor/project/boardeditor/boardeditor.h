@@ -25,6 +25,7 @@
  ******************************************************************************/
 #include "../../dialogs/graphicsexportdialog.h"
 #include "../../graphics/graphicslayer.h"
+#include "../../graphics/graphicsscenecache.h"
 #include "../../widgets/if_graphicsvieweventhandler.h"
 #include "ui_boardeditor.h"
 
@@ -188,6 +189,7 @@ private:
   QPointer<Board> mActiveBoard;
   QList<std::shared_ptr<GraphicsLayer>> mLayers;
   QScopedPointer<BoardGraphicsScene> mGraphicsScene;
+  GraphicsSceneCache<BoardGraphicsScene> mSceneCache;  ///< Inactive boards
   QScopedPointer<OpenGlSceneBuilder> mOpenGlSceneBuilder;
   bool mOpenGlSceneBuildScheduled;
   qint64 mTimestampOfLastOpenGlSceneRebuild;
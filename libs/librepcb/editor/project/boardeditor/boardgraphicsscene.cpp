@@ -49,6 +49,7 @@
 #include <librepcb/core/project/board/items/bi_zone.h>
 #include <librepcb/core/project/project.h>
 #include <librepcb/core/types/layer.h>
+#include <librepcb/core/utils/tracer.h>
 
 #include <QtCore>
 #include <QtWidgets>
@@ -71,6 +72,7 @@ BoardGraphicsScene::BoardGraphicsScene(
     mBoard(board),
     mLayerProvider(lp),
     mHighlightedNetSignals(highlightedNetSignals) {
+  LIBREPCB_TRACE_SCOPE_DETAIL("scene", "buildBoard", *board.getName());
   foreach (BI_Device* obj, mBoard.getDeviceInstances()) {
     addDevice(*obj);
   }
@@ -181,6 +181,15 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
   const QPainterPath posAreaLarge =
       mContext.editorGraphicsView.calcPosWithTolerance(pos, 1.5);
 
+  // Use the spatial index of the scene to determine the items close to the
+  // cursor, to avoid the expensive grab area check for all other items.
+  QRectF searchArea = posAreaLarge.boundingRect();
+  if (flags.testFlag(FindFlag::AcceptNextGridMatch)) {
+    searchArea |= QRectF(posOnGrid, QSizeF(1, 1)).translated(-0.5, -0.5);
+  }
+  const QSet<const QGraphicsItem*> candidates =
+      scene->findItemsInArea(searchArea);
+
   // Note: The order of adding the items is very important (the top most item
   // must appear as the first item in the list)! For that, we work with
   // priorities (0 = highest priority):
@@ -248,10 +257,11 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
     }
   };
   auto processItem = [&pos, &posExact, &posOnGrid, &posArea, &posAreaLarge,
-                      flags, &except, &addItem, &canSkip](
+                      &candidates, flags, &except, &addItem, &canSkip](
                          std::shared_ptr<QGraphicsItem> item,
-                         const Point& nearestPos, int priority, bool large) {
-    if (except.contains(item)) {
+                         const std::function<Point()>& calcNearestPos,
+                         int priority, bool large) {
+    if ((!candidates.contains(item.get())) || except.contains(item)) {
       return;
     }
     auto prio = std::make_pair(priority, 0);
@@ -262,7 +272,9 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
     if (grabArea.isEmpty()) {
       return;
     }
-    const int distance = qRound((nearestPos - pos).getLength()->toPx());
+    // Only calculate the nearest position of items close to the cursor since
+    // it might be expensive (e.g. for planes with many vertices).
+    const int distance = qRound((calcNearestPos() - pos).getLength()->toPx());
     prio = std::make_pair(priority, distance);
     if (canSkip(prio)) {
       return;
@@ -294,9 +306,17 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
   if (flags.testFlag(FindFlag::Holes)) {
     for (auto it = scene->getHoles().begin(); it != scene->getHoles().end();
          it++) {
-      processItem(it.value(),
-                  it.key()->getData().getPath()->getVertices().first().getPos(),
-                  5, false);
+      processItem(
+          it.value(),
+          [&it]() {
+            return it.key()
+                ->getData()
+                .getPath()
+                ->getVertices()
+                .first()
+                .getPos();
+          },
+          5, false);
     }
   }
 
@@ -306,7 +326,9 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
       if (netsignals.isEmpty() ||
           netsignals.contains(it.key()->getNetSegment().getNetSignal())) {
         if ((!cuLayer) || (it.key()->getVia().isOnLayer(*cuLayer))) {
-          processItem(it.value(), it.key()->getPosition(), 0, false);
+          processItem(
+              it.value(), [&it]() { return it.key()->getPosition(); }, 0,
+              false);
         }
       }
     }
@@ -319,8 +341,9 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
           netsignals.contains(it.key()->getNetSegment().getNetSignal())) {
         const Layer* layer = it.key()->getLayerOfTraces();
         if ((!cuLayer) || (&*cuLayer == layer)) {
-          processItem(it.value(), it.key()->getPosition(),
-                      10 + (layer ? priorityFromLayer(*layer) : 0), false);
+          processItem(
+              it.value(), [&it]() { return it.key()->getPosition(); },
+              10 + (layer ? priorityFromLayer(*layer) : 0), false);
         }
       }
     }
@@ -333,12 +356,15 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
           netsignals.contains(it.key()->getNetSegment().getNetSignal())) {
         const Layer& layer = it.key()->getLayer();
         if ((!cuLayer) || (*cuLayer == layer)) {
-          processItem(it.value(),
-                      Toolbox::nearestPointOnLine(
-                          pos.mappedToGrid(getGridInterval()),
-                          it.key()->getStartPoint().getPosition(),
-                          it.key()->getEndPoint().getPosition()),
-                      20 + priorityFromLayer(layer), false);
+          processItem(
+              it.value(),
+              [this, &it, &pos]() {
+                return Toolbox::nearestPointOnLine(
+                    pos.mappedToGrid(getGridInterval()),
+                    it.key()->getStartPoint().getPosition(),
+                    it.key()->getEndPoint().getPosition());
+              },
+              20 + priorityFromLayer(layer), false);
         }
       }
     }
@@ -352,7 +378,10 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
         if ((!cuLayer) || (*cuLayer == it.key()->getLayer())) {
           processItem(
               it.value(),
-              it.key()->getOutline().calcNearestPointBetweenVertices(pos),
+              [&it, &pos]() {
+                return it.key()->getOutline().calcNearestPointBetweenVertices(
+                    pos);
+              },
               30 + priorityFromLayer(it.key()->getLayer()),
               true);  // Probably large grab area makes sense?
         }
@@ -373,8 +402,12 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
         }
         processItem(
             it.value(),
-            it.key()->getData().getOutline().calcNearestPointBetweenVertices(
-                pos),
+            [&it, &pos]() {
+              return it.key()
+                  ->getData()
+                  .getOutline()
+                  .calcNearestPointBetweenVertices(pos);
+            },
             priority,
             true);  // Probably large grab area makes sense?
       }
@@ -384,8 +417,9 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
   if (flags.testFlag(FindFlag::Devices)) {
     for (auto it = scene->getDevices().begin(); it != scene->getDevices().end();
          it++) {
-      processItem(it.value(), it.key()->getPosition(),
-                  40 + (it.key()->getMirrored() ? 300 : 100), false);
+      processItem(
+          it.value(), [&it]() { return it.key()->getPosition(); },
+          40 + (it.key()->getMirrored() ? 300 : 100), false);
     }
   }
 
@@ -400,7 +434,9 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
           const int priority = it.key()->getLibPad().isTht()
               ? 1
               : (50 + (it.key()->getMirrored() ? 300 : 100));
-          processItem(it.value(), it.key()->getPosition(), priority, false);
+          processItem(
+              it.value(), [&it]() { return it.key()->getPosition(); },
+              priority, false);
         }
       }
     }
@@ -411,7 +447,12 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
          it != scene->getPolygons().end(); it++) {
       processItem(
           it.value(),
-          it.key()->getData().getPath().calcNearestPointBetweenVertices(pos),
+          [&it, &pos]() {
+            return it.key()
+                ->getData()
+                .getPath()
+                .calcNearestPointBetweenVertices(pos);
+          },
           60 + priorityFromLayer(it.key()->getData().getLayer()),
           true);  // Probably large grab area makes sense?
     }
@@ -420,9 +461,9 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
   if (flags.testFlag(FindFlag::StrokeTexts)) {
     for (auto it = scene->getStrokeTexts().begin();
          it != scene->getStrokeTexts().end(); it++) {
-      processItem(it.value(), it.key()->getData().getPosition(),
-                  60 + priorityFromLayer(it.key()->getData().getLayer()),
-                  false);
+      processItem(
+          it.value(), [&it]() { return it.key()->getData().getPosition(); },
+          60 + priorityFromLayer(it.key()->getData().getLayer()), false);
     }
   }
 
@@ -24,6 +24,7 @@
 
 #include "../../../graphics/graphicslayer.h"
 #include "../../../graphics/origincrossgraphicsitem.h"
+#include "../../../graphics/painterpathcache.h"
 #include "../../../graphics/primitivecirclegraphicsitem.h"
 #include "../../../graphics/primitiveholegraphicsitem.h"
 #include "../../../graphics/primitivepathgraphicsitem.h"
@@ -82,11 +83,11 @@ BGI_Device::BGI_Device(BI_Device& device,
 
   for (auto& obj : mDevice.getLibFootprint().getPolygons()) {
     auto i = std::make_shared<PrimitivePathGraphicsItem>(this);
-    i->setPath(obj.getPathForRendering().toQPainterPathPx());
+    i->setPath(PainterPathCache::get(obj.getPathForRendering()));
     i->setLineWidth(obj.getLineWidth());
     i->setFlag(QGraphicsItem::ItemStacksBehindParent, true);
     if (obj.isGrabArea()) {
-      mShape |= Toolbox::shapeFromPath(obj.getPath().toQPainterPathPx(),
+      mShape |= Toolbox::shapeFromPath(PainterPathCache::get(obj.getPath()),
                                        QPen(Qt::SolidPattern, 0),
                                        Qt::SolidPattern, obj.getLineWidth());
     }
@@ -123,6 +124,16 @@ BGI_Device::~BGI_Device() noexcept {
  *  Inherited from QGraphicsItem
  ******************************************************************************/
 
+QRectF BGI_Device::boundingRect() const noexcept {
+  // The children might be invisible while the grab area is still active, so
+  // the grab area needs to be covered explicitly for the scene's spatial index.
+  QRectF rect = mOriginCrossGraphicsItem->boundingRect();
+  if (mGrabAreaLayer && mGrabAreaLayer->isVisible()) {
+    rect |= mShape.boundingRect();
+  }
+  return rect;
+}
+
 QPainterPath BGI_Device::shape() const noexcept {
   QPainterPath p = mOriginCrossGraphicsItem->shape();
   if (mGrabAreaLayer && mGrabAreaLayer->isVisible()) {
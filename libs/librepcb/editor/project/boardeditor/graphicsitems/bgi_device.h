@@ -74,6 +74,7 @@ public:
   BI_Device& getDevice() noexcept { return mDevice; }
 
   // Inherited from QGraphicsItem
+  QRectF boundingRect() const noexcept override;
   QPainterPath shape() const noexcept override;
 
   // Operator Overloadings
@@ -23,6 +23,7 @@
 #include "bgi_netpoint.h"
 
 #include "../../../graphics/graphicslayer.h"
+#include "../../../graphics/painterpathcache.h"
 #include "../boardgraphicsscene.h"
 
 #include <librepcb/core/project/board/items/bi_netpoint.h>
@@ -150,8 +151,8 @@ void BGI_NetPoint::updatePosition() noexcept {
 void BGI_NetPoint::updateDiameter() noexcept {
   prepareGeometryChange();
   if (mNetPoint.getMaxTraceWidth() > 0) {
-    mShape = Path::circle(PositiveLength(*mNetPoint.getMaxTraceWidth()))
-                 .toQPainterPathPx();
+    mShape = PainterPathCache::get(
+        Path::circle(PositiveLength(*mNetPoint.getMaxTraceWidth())));
   } else {
     mShape = QPainterPath();
   }
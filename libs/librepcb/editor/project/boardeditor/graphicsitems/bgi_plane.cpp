@@ -59,6 +59,13 @@ BGI_Plane::BGI_Plane(BI_Plane& plane, const IF_GraphicsLayerProvider& lp,
     mOnLayerEditedSlot(*this, &BGI_Plane::layerEdited) {
   setFlag(QGraphicsItem::ItemIsSelectable, true);
 
+  // Planes often consist of very complex areas (e.g. many thermal cutouts),
+  // thus rendering them is expensive. Cache the rendered item to avoid
+  // re-rendering on every repaint, e.g. when panning. The cache is
+  // invalidated by update() calls of this item only, so other items do not
+  // affect it.
+  setCacheMode(QGraphicsItem::DeviceCoordinateCache);
+
   updateOutlineAndFragments();
   updateLayer();
   updateVisibility();
@@ -176,11 +183,15 @@ void BGI_Plane::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
       }
     }
 
-    // Draw plane only if plane should be visible.
+    // Draw plane only if plane should be visible. If the tolerance of the
+    // simplified areas is below the size of a pixel, use them since they
+    // look the same but are much cheaper to render.
     if (mPlane.isVisible()) {
+      const qreal tolerancePx = Length(sLowDetailToleranceNm).toPx() * lod;
       painter->setPen(Qt::NoPen);
       painter->setBrush(mLayer->getColor(highlight));
-      foreach (const QPainterPath& area, mAreas) {
+      foreach (const QPainterPath& area,
+               (tolerancePx < 0.5) ? mAreasLowDetail : mAreas) {
         painter->drawPath(area);
       }
     }
@@ -264,8 +275,10 @@ void BGI_Plane::updateOutlineAndFragments() noexcept {
 
   // get areas
   mAreas.clear();
+  mAreasLowDetail.clear();
   for (const Path& r : mPlane.getFragments()) {
     mAreas.append(r.toQPainterPathPx());
+    mAreasLowDetail.append(toLowDetailPath(r));
     mBoundingRect = mBoundingRect.united(mAreas.last().boundingRect());
   }
 
@@ -311,6 +324,41 @@ void BGI_Plane::updateBoundingRectMargin() noexcept {
   update();
 }
 
+QPainterPath BGI_Plane::toLowDetailPath(const Path& path) noexcept {
+  const QVector<Vertex>& vertices = path.getVertices();
+  if (path.isCurved() || (vertices.count() < 4)) {
+    return path.toQPainterPathPx();
+  }
+
+  // Remove all vertices which are closer than the tolerance to the previous
+  // vertex. Fragments which collapse completely are replaced by their
+  // bounding rect, which is more or less a single pixel anyway.
+  const qreal toleranceSq =
+      std::pow(Length(sLowDetailToleranceNm).toPx(), 2);
+  QPolygonF allPoints;
+  QPolygonF polygon;
+  allPoints.reserve(vertices.count());
+  for (const Vertex& vertex : vertices) {
+    const QPointF p = vertex.getPos().toPxQPointF();
+    allPoints.append(p);
+    if (!polygon.isEmpty()) {
+      const QPointF diff = p - polygon.last();
+      if (((diff.x() * diff.x()) + (diff.y() * diff.y())) < toleranceSq) {
+        continue;
+      }
+    }
+    polygon.append(p);
+  }
+  QPainterPath result;
+  if (polygon.count() < 3) {
+    result.addRect(allPoints.boundingRect());
+  } else {
+    result.addPolygon(polygon);
+    result.closeSubpath();
+  }
+  return result;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
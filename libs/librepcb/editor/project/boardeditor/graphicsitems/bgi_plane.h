@@ -104,6 +104,7 @@ private:  // Methods
   void updateLayer() noexcept;
   void updateVisibility() noexcept;
   void updateBoundingRectMargin() noexcept;
+  static QPainterPath toLowDetailPath(const Path& path) noexcept;
 
 private:  // Data
   // General Attributes
@@ -118,6 +119,7 @@ private:  // Data
   QPainterPath mShape;
   QPainterPath mOutline;
   QVector<QPainterPath> mAreas;
+  QVector<QPainterPath> mAreasLowDetail;  ///< Simplified for low zoom levels
   qreal mLineWidthPx;
   qreal mVertexHandleRadiusPx;
   struct VertexHandle {
@@ -129,6 +131,9 @@ private:  // Data
   // Slots
   BI_Plane::OnEditedSlot mOnEditedSlot;
   GraphicsLayer::OnEditedSlot mOnLayerEditedSlot;
+
+  /// Max. deviation of #mAreasLowDetail from the exact plane areas
+  static constexpr LengthBase_t sLowDetailToleranceNm = 100000;  // 0.1mm
 };
 
 /*******************************************************************************
@@ -23,6 +23,7 @@
 #include "bgi_via.h"
 
 #include "../../../graphics/graphicslayer.h"
+#include "../../../graphics/painterpathcache.h"
 #include "../../../graphics/primitivepathgraphicsitem.h"
 #include "../boardgraphicsscene.h"
 
@@ -222,15 +223,15 @@ void BGI_Via::updatePosition() noexcept {
 void BGI_Via::updateShapes() noexcept {
   prepareGeometryChange();
 
-  mShape = mVia.getVia().getOutline().toQPainterPathPx();
+  mShape = PainterPathCache::get(mVia.getVia().getOutline());
   mCopper = mVia.getVia().toQPainterPathPx();
   if (auto diameter = mVia.getStopMaskDiameterBottom()) {
-    mStopMaskBottom = Path::circle(*diameter).toQPainterPathPx();
+    mStopMaskBottom = PainterPathCache::get(Path::circle(*diameter));
   } else {
     mStopMaskBottom = QPainterPath();
   }
   if (auto diameter = mVia.getStopMaskDiameterTop()) {
-    mStopMaskTop = Path::circle(*diameter).toQPainterPathPx();
+    mStopMaskTop = PainterPathCache::get(Path::circle(*diameter));
   } else {
     mStopMaskTop = QPainterPath();
   }
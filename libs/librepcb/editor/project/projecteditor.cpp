@@ -41,11 +41,13 @@
 #include <librepcb/core/project/erc/electricalrulecheck.h>
 #include <librepcb/core/project/project.h>
 #include <librepcb/core/project/projectlibrary.h>
+#include <librepcb/core/serialization/sexpression.h>
 #include <librepcb/core/utils/scopeguard.h>
 #include <librepcb/core/workspace/workspace.h>
 #include <librepcb/core/workspace/workspacelibrarydb.h>
 #include <librepcb/core/workspace/workspacesettings.h>
 
+#include <QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -69,6 +71,7 @@ ProjectEditor::ProjectEditor(
     mSchematicEditor(nullptr),
     mBoardEditor(nullptr),
     mLastAutosaveStateId(0),
+    mPendingAutosaveStateId(),
     mManualModificationsMade(false) {
   try {
     if (upgradeMessages) {
@@ -118,11 +121,18 @@ ProjectEditor::ProjectEditor(
             &ProjectEditor::autosaveProject);
     mAutoSaveTimer.start(1000 * intervalSecs);
   }
+  connect(&mAutosaveWatcher, &QFutureWatcher<bool>::finished, this, [this]() {
+    if (mAutosaveWatcher.result() && mPendingAutosaveStateId) {
+      mLastAutosaveStateId = *mPendingAutosaveStateId;
+    }
+    mPendingAutosaveStateId = tl::nullopt;
+  });
 }
 
 ProjectEditor::~ProjectEditor() noexcept {
-  // stop the autosave timer
+  // stop the autosave timer and wait until a running autosave is finished
   mAutoSaveTimer.stop();
+  mAutosaveWatcher.waitForFinished();
 
   // abort all active commands!
   mSchematicEditor->abortAllCommands();
@@ -491,12 +501,17 @@ bool ProjectEditor::saveProject() noexcept {
     QGuiApplication::setOverrideCursor(Qt::WaitCursor);
     auto csg = scopeGuard([]() { QGuiApplication::restoreOverrideCursor(); });
 
+    // Let a running autosave finish first, so it can't write an outdated
+    // backup after the project was saved.
+    mAutosaveWatcher.waitForFinished();
+
     // Save project.
     qDebug() << "Save project...";
     emit projectAboutToBeSaved();
     mProject.save();  // can throw
     mProject.getDirectory().getFileSystem()->save();  // can throw
     mLastAutosaveStateId = mUndoStack->getUniqueStateId();
+    mPendingAutosaveStateId = tl::nullopt;  // Outdated by this save.
     mManualModificationsMade = false;
 
     // saving was successful --> clean the undo stack
@@ -522,9 +537,10 @@ bool ProjectEditor::autosaveProject() noexcept {
     return false;
   }
 
-  if (mUndoStack->isCommandGroupActive()) {
-    // the user is executing a command at the moment, so we should not save now,
-    // try it a few seconds later instead...
+  if (mUndoStack->isCommandGroupActive() || mAutosaveWatcher.isRunning()) {
+    // the user is executing a command at the moment (or the previous autosave
+    // is still running), so we should not save now, try it a few seconds later
+    // instead...
     QTimer::singleShot(10000, this, &ProjectEditor::autosaveProject);
     return false;
   }
@@ -532,10 +548,35 @@ bool ProjectEditor::autosaveProject() noexcept {
   try {
     qDebug() << "Autosave project...";
     emit projectAboutToBeSaved();
-    mProject.save();  // can throw
-    mProject.getDirectory().getFileSystem()->autosave();  // can throw
-    mLastAutosaveStateId = mUndoStack->getUniqueStateId();
-    qDebug() << "Successfully autosaved project.";
+
+    // Only the S-Expression trees are created in the GUI thread. They are a
+    // snapshot of the project, so converting them to file content and writing
+    // the files is done in a worker thread while the project can be modified.
+    // The content is passed as overlay to the autosave instead of writing it
+    // to the file system, to never overwrite newer content saved meanwhile.
+    // Only files whose content has changed are written to disk.
+    std::shared_ptr<const Project::SerializedFiles> files =
+        std::make_shared<Project::SerializedFiles>(
+            mProject.serialize());  // can throw
+    mProject.updateDateTime();
+    mPendingAutosaveStateId = mUndoStack->getUniqueStateId();
+    std::shared_ptr<TransactionalFileSystem> fs =
+        mProject.getDirectory().getFileSystem();
+    const QString dirPath = mProject.getDirectory().getPath();
+    mAutosaveWatcher.setFuture(QtConcurrent::run([fs, dirPath, files]() {
+      try {
+        QHash<QString, QByteArray> overlay;
+        for (auto it = files->begin(); it != files->end(); it++) {
+          overlay.insert(dirPath % "/" % it.key(), it.value()->toByteArray());
+        }
+        fs->autosave(overlay);  // can throw
+        qDebug() << "Successfully autosaved project.";
+        return true;
+      } catch (const Exception& e) {
+        qCritical().noquote() << "Failed to autosave project:" << e.getMsg();
+        return false;
+      }
+    }));
     return true;
   } catch (Exception& exc) {
     return false;
@@ -581,7 +622,7 @@ bool ProjectEditor::closeAndDestroy(bool askForSave,
 
 void ProjectEditor::setErcMessageApproved(const RuleCheckMessage& msg,
                                           bool approve) noexcept {
-  QSet<SExpression> approvals = mProject.getErcMessageApprovals();
+  QSet<RuleCheckApproval> approvals = mProject.getErcMessageApprovals();
   if (approve) {
     approvals.insert(msg.getApproval());
   } else {
@@ -614,7 +655,7 @@ void ProjectEditor::runErc() noexcept {
     mErcMessages = erc.runChecks();
 
     // Detect disappeared messages & remove their approvals.
-    QSet<SExpression> approvals =
+    QSet<RuleCheckApproval> approvals =
         RuleCheckMessage::getAllApprovals(mErcMessages);
     mSupportedErcApprovals |= approvals;
     mDisappearedErcApprovals = mSupportedErcApprovals - approvals;
@@ -629,7 +670,7 @@ void ProjectEditor::runErc() noexcept {
 }
 
 void ProjectEditor::saveErcMessageApprovals(
-    const QSet<SExpression>& approvals) noexcept {
+    const QSet<RuleCheckApproval>& approvals) noexcept {
   if (mProject.setErcMessageApprovals(approvals)) {
     setManualModificationsMade();
   }
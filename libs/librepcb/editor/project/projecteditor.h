@@ -200,9 +200,13 @@ public slots:
   /**
    * @brief Make a automatic backup of the project (save to temporary files)
    *
+   * The project is serialized in the GUI thread, but the modified files are
+   * written to disk in a worker thread to not block the GUI.
+   *
    * @note The whole save procedere is described in @ref doc_project_save.
    *
-   * @return true on success, false on failure
+   * @return true if the autosave was started, false if it was skipped or
+   *         failed
    */
   bool autosaveProject() noexcept;
 
@@ -270,7 +274,8 @@ signals:
 
 private:  // Methods
   void runErc() noexcept;
-  void saveErcMessageApprovals(const QSet<SExpression>& approvals) noexcept;
+  void saveErcMessageApprovals(
+      const QSet<RuleCheckApproval>& approvals) noexcept;
   int getCountOfVisibleEditorWindows() const noexcept;
   void searchAndOpenDatasheet(const QString& mpn, const QString& manufacturer,
                               QPointer<QWidget> parent) const noexcept;
@@ -285,8 +290,11 @@ private:  // Data
   /// functionality (see also @ref doc_project_save)
   QTimer mAutoSaveTimer;
 
-  QSet<SExpression> mSupportedErcApprovals;
-  QSet<SExpression> mDisappearedErcApprovals;
+  /// Watcher of the autosave running in a worker thread
+  QFutureWatcher<bool> mAutosaveWatcher;
+
+  QSet<RuleCheckApproval> mSupportedErcApprovals;
+  QSet<RuleCheckApproval> mDisappearedErcApprovals;
   RuleCheckMessageList mErcMessages;
 
   std::shared_ptr<QSet<const NetSignal*>> mHighlightedNetSignals;
@@ -298,6 +306,10 @@ private:  // Data
   /// The UndoStack state ID of the last successful project (auto)save
   uint mLastAutosaveStateId;
 
+  /// The UndoStack state ID of the currently running autosave, reset by a
+  /// manual save to not overwrite its (newer) state ID when finished
+  tl::optional<uint> mPendingAutosaveStateId;
+
   /// Modifications bypassing the undo stack
   bool mManualModificationsMade;
 };
@@ -144,6 +144,15 @@ QList<std::shared_ptr<QGraphicsItem>> SchematicEditorState::findItemsAtPos(
     posAreaInGrid.addEllipse(pos.toPxQPointF(), gridDistancePx, gridDistancePx);
   }
 
+  // Use the spatial index of the scene to determine the items close to the
+  // cursor, to avoid the expensive grab area check for all other items.
+  QRectF searchArea = posAreaLarge.boundingRect();
+  if (flags.testFlag(FindFlag::AcceptNearestWithinGrid)) {
+    searchArea |= posAreaInGrid.boundingRect();
+  }
+  const QSet<const QGraphicsItem*> candidates =
+      scene->findItemsInArea(searchArea);
+
   // Note: The order of adding the items is very important (the top most item
   // must appear as the first item in the list)! For that, we work with
   // priorities (0 = highest priority):
@@ -182,11 +191,12 @@ QList<std::shared_ptr<QGraphicsItem>> SchematicEditorState::findItemsAtPos(
         lowestPriority && (prio > (*lowestPriority));
   };
   auto processItem = [&pos, &posExact, &posArea, &posAreaLarge, &posAreaInGrid,
-                      flags, &except, &addItem, &canSkip](
+                      &candidates, flags, &except, &addItem, &canSkip](
                          std::shared_ptr<QGraphicsItem> item,
-                         const Point& nearestPos, int priority, bool large,
+                         const std::function<Point()>& calcNearestPos,
+                         int priority, bool large,
                          const tl::optional<UnsignedLength>& maxDistance) {
-    if (except.contains(item)) {
+    if ((!candidates.contains(item.get())) || except.contains(item)) {
       return false;
     }
     auto prio = std::make_pair(priority, 0);
@@ -194,7 +204,9 @@ QList<std::shared_ptr<QGraphicsItem>> SchematicEditorState::findItemsAtPos(
       return false;
     }
     const QPainterPath grabArea = item->mapToScene(item->shape());
-    const UnsignedLength distance = (nearestPos - pos).getLength();
+    // Only calculate the nearest position of items close to the cursor since
+    // it might be expensive (e.g. for polygons with many vertices).
+    const UnsignedLength distance = (calcNearestPos() - pos).getLength();
     if ((maxDistance) && (distance > (*maxDistance))) {
       return false;
     }
@@ -232,8 +244,9 @@ QList<std::shared_ptr<QGraphicsItem>> SchematicEditorState::findItemsAtPos(
   if (flags.testFlag(FindFlag::NetPoints)) {
     for (auto it = scene->getNetPoints().begin();
          it != scene->getNetPoints().end(); it++) {
-      processItem(it.value(), it.key()->getPosition(),
-                  it.key()->isVisibleJunction() ? 0 : 10, false, tl::nullopt);
+      processItem(
+          it.value(), [&it]() { return it.key()->getPosition(); },
+          it.key()->isVisibleJunction() ? 0 : 10, false, tl::nullopt);
     }
   }
 
@@ -242,9 +255,12 @@ QList<std::shared_ptr<QGraphicsItem>> SchematicEditorState::findItemsAtPos(
          it != scene->getNetLines().end(); it++) {
       processItem(
           it.value(),
-          Toolbox::nearestPointOnLine(pos.mappedToGrid(getGridInterval()),
-                                      it.key()->getStartPoint().getPosition(),
-                                      it.key()->getEndPoint().getPosition()),
+          [this, &it, &pos]() {
+            return Toolbox::nearestPointOnLine(
+                pos.mappedToGrid(getGridInterval()),
+                it.key()->getStartPoint().getPosition(),
+                it.key()->getEndPoint().getPosition());
+          },
           20, true, tl::nullopt);  // Large grab area, better usability!
     }
   }
@@ -252,7 +268,9 @@ QList<std::shared_ptr<QGraphicsItem>> SchematicEditorState::findItemsAtPos(
   if (flags.testFlag(FindFlag::NetLabels)) {
     for (auto it = scene->getNetLabels().begin();
          it != scene->getNetLabels().end(); it++) {
-      processItem(it.value(), it.key()->getPosition(), 30, false, tl::nullopt);
+      processItem(
+          it.value(), [&it]() { return it.key()->getPosition(); }, 30, false,
+          tl::nullopt);
     }
   }
 
@@ -261,10 +279,10 @@ QList<std::shared_ptr<QGraphicsItem>> SchematicEditorState::findItemsAtPos(
          it++) {
       // Higher priority if origin cross is below cursor. Required for
       // https://github.com/LibrePCB/LibrePCB/issues/1319.
-      if (!processItem(it.value(), it.key()->getPosition(), 40, false,
+      auto calcPos = [&it]() { return it.key()->getPosition(); };
+      if (!processItem(it.value(), calcPos, 40, false,
                        UnsignedLength(700000))) {
-        processItem(it.value(), it.key()->getPosition(), 70, false,
-                    tl::nullopt);
+        processItem(it.value(), calcPos, 70, false, tl::nullopt);
       }
     }
   }
@@ -275,8 +293,9 @@ QList<std::shared_ptr<QGraphicsItem>> SchematicEditorState::findItemsAtPos(
          it != scene->getSymbolPins().end(); it++) {
       if (flags.testFlag(FindFlag::SymbolPins) ||
           (it.key()->getComponentSignalInstance())) {
-        processItem(it.value(), it.key()->getPosition(), 40, false,
-                    tl::nullopt);
+        processItem(
+            it.value(), [&it]() { return it.key()->getPosition(); }, 40, false,
+            tl::nullopt);
       }
     }
   }
@@ -286,7 +305,12 @@ QList<std::shared_ptr<QGraphicsItem>> SchematicEditorState::findItemsAtPos(
          it != scene->getPolygons().end(); it++) {
       processItem(
           it.value(),
-          it.key()->getPolygon().getPath().calcNearestPointBetweenVertices(pos),
+          [&it, &pos]() {
+            return it.key()
+                ->getPolygon()
+                .getPath()
+                .calcNearestPointBetweenVertices(pos);
+          },
           80, true, tl::nullopt);  // Probably large grab area makes sense?
     }
   }
@@ -294,7 +318,9 @@ QList<std::shared_ptr<QGraphicsItem>> SchematicEditorState::findItemsAtPos(
   if (flags.testFlag(FindFlag::Texts)) {
     for (auto it = scene->getTexts().begin(); it != scene->getTexts().end();
          it++) {
-      processItem(it.value(), it.key()->getPosition(), 60, false, tl::nullopt);
+      processItem(
+          it.value(), [&it]() { return it.key()->getPosition(); }, 60, false,
+          tl::nullopt);
     }
   }
 
@@ -25,6 +25,7 @@
 #include "../../../graphics/circlegraphicsitem.h"
 #include "../../../graphics/graphicslayer.h"
 #include "../../../graphics/origincrossgraphicsitem.h"
+#include "../../../graphics/painterpathcache.h"
 #include "../../../graphics/polygongraphicsitem.h"
 #include "../schematicgraphicsscene.h"
 
@@ -83,7 +84,7 @@ SGI_Symbol::SGI_Symbol(SI_Symbol& symbol,
     i->setFlag(QGraphicsItem::ItemIsSelectable, true);
     i->setFlag(QGraphicsItem::ItemStacksBehindParent, true);
     if (obj.isGrabArea()) {
-      mShape |= Toolbox::shapeFromPath(obj.getPath().toQPainterPathPx(),
+      mShape |= Toolbox::shapeFromPath(PainterPathCache::get(obj.getPath()),
                                        Qt::SolidLine, Qt::SolidPattern,
                                        obj.getLineWidth());
     }
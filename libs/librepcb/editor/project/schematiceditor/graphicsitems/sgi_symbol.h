@@ -69,6 +69,11 @@ public:
   SI_Symbol& getSymbol() noexcept { return mSymbol; }
 
   // Inherited from QGraphicsItem
+  QRectF boundingRect() const noexcept override {
+    // Cover the grab area even if the children are invisible, for the
+    // scene's spatial index.
+    return mShape.boundingRect();
+  }
   QPainterPath shape() const noexcept override { return mShape; }
 
   // Operator Overloadings
@@ -86,6 +86,7 @@ SchematicEditor::SchematicEditor(ProjectEditor& projectEditor, Project& project)
         mProjectEditor.getWorkspace().getSettings(), this)),
     mActiveSchematicIndex(-1),
     mGraphicsScene(),
+    mSceneCache(),
     mVisibleSceneRect(),
     mFsm() {
   mUi->setupUi(this);
@@ -200,6 +201,15 @@ SchematicEditor::SchematicEditor(ProjectEditor& projectEditor, Project& project)
   mActionShowPinNumbers->setChecked(
       clientSettings.value("schematic_editor/show_pin_numbers", true).toBool());
 
+  // Drop cached scenes of removed schematic pages.
+  connect(&mProject, &Project::schematicRemoved, this, [this]() {
+    foreach (const Uuid& uuid, mSceneCache.getKeys()) {
+      if (!mProject.getSchematicByUuid(uuid)) {
+        mSceneCache.remove(uuid);
+      }
+    }
+  });
+
   // Load first schematic page
   if (mProject.getSchematics().count() > 0) setActiveSchematicIndex(0);
 
@@ -255,6 +265,14 @@ bool SchematicEditor::setActiveSchematicIndex(int index) noexcept {
         mUi->graphicsView->getVisibleSceneRect();
   }
   mUi->graphicsView->setScene(nullptr);
+  if (mGraphicsScene &&
+      mProject.getSchematics().contains(&mGraphicsScene->getSchematic())) {
+    // Keep the scene alive to make switching back to this page fast.
+    mGraphicsScene->clearSelection();
+    const Uuid uuid = mGraphicsScene->getSchematic().getUuid();
+    mSceneCache.insert(
+        uuid, std::unique_ptr<SchematicGraphicsScene>(mGraphicsScene.take()));
+  }
   mGraphicsScene.reset();
   while (!mSchematicConnections.isEmpty()) {
     disconnect(mSchematicConnections.takeLast());
@@ -263,17 +281,22 @@ bool SchematicEditor::setActiveSchematicIndex(int index) noexcept {
   schematic = mProject.getSchematicByIndex(index);
 
   if (schematic) {
-    // show scene, restore view scene rect, set grid properties
-    mGraphicsScene.reset(new SchematicGraphicsScene(
-        *schematic, *this, mProjectEditor.getHighlightedNetSignals()));
-    connect(&mProjectEditor, &ProjectEditor::highlightedNetSignalsChanged,
-            mGraphicsScene.data(),
-            &SchematicGraphicsScene::updateHighlightedNetSignals);
-    const Theme& theme =
-        mProjectEditor.getWorkspace().getSettings().themes.getActive();
-    mGraphicsScene->setSelectionRectColors(
-        theme.getColor(Theme::Color::sSchematicSelection).getPrimaryColor(),
-        theme.getColor(Theme::Color::sSchematicSelection).getSecondaryColor());
+    // show scene (from cache, if available), restore view scene rect, set
+    // grid properties
+    mGraphicsScene.reset(mSceneCache.take(schematic->getUuid()).release());
+    if (!mGraphicsScene) {
+      mGraphicsScene.reset(new SchematicGraphicsScene(
+          *schematic, *this, mProjectEditor.getHighlightedNetSignals()));
+      connect(&mProjectEditor, &ProjectEditor::highlightedNetSignalsChanged,
+              mGraphicsScene.data(),
+              &SchematicGraphicsScene::updateHighlightedNetSignals);
+      const Theme& theme =
+          mProjectEditor.getWorkspace().getSettings().themes.getActive();
+      mGraphicsScene->setSelectionRectColors(
+          theme.getColor(Theme::Color::sSchematicSelection).getPrimaryColor(),
+          theme.getColor(Theme::Color::sSchematicSelection)
+              .getSecondaryColor());
+    }
     mUi->graphicsView->setScene(mGraphicsScene.data());
     const QRectF sceneRect = mVisibleSceneRect.value(schematic->getUuid());
     if (!sceneRect.isEmpty()) {
@@ -25,6 +25,7 @@
  ******************************************************************************/
 #include "../../dialogs/graphicsexportdialog.h"
 #include "../../graphics/graphicslayer.h"
+#include "../../graphics/graphicsscenecache.h"
 #include "../../widgets/if_graphicsvieweventhandler.h"
 #include "ui_schematiceditor.h"
 
@@ -155,6 +156,7 @@ private:
   int mActiveSchematicIndex;
   QList<std::shared_ptr<GraphicsLayer>> mLayers;
   QScopedPointer<SchematicGraphicsScene> mGraphicsScene;
+  GraphicsSceneCache<SchematicGraphicsScene> mSceneCache;  ///< Inactive pages
   QHash<Uuid, QRectF> mVisibleSceneRect;
   QScopedPointer<SchematicEditorFsm> mFsm;
 
@@ -40,6 +40,7 @@
 #include <librepcb/core/project/schematic/items/si_symbolpin.h>
 #include <librepcb/core/project/schematic/items/si_text.h>
 #include <librepcb/core/project/schematic/schematic.h>
+#include <librepcb/core/utils/tracer.h>
 
 #include <QtCore>
 #include <QtWidgets>
@@ -62,6 +63,8 @@ SchematicGraphicsScene::SchematicGraphicsScene(
     mSchematic(schematic),
     mLayerProvider(lp),
     mHighlightedNetSignals(highlightedNetSignals) {
+  LIBREPCB_TRACE_SCOPE_DETAIL("scene", "buildSchematic",
+                              *schematic.getName());
   foreach (SI_Symbol* obj, mSchematic.getSymbols()) {
     addSymbol(*obj);
   }
@@ -23,6 +23,7 @@
 #include "openglview.h"
 
 #include "../3d/openglobject.h"
+#include "../3d/opengltrianglebuffer.h"
 #include "waitingspinnerwidget.h"
 
 #include <librepcb/core/application.h>
@@ -103,6 +104,7 @@ OpenGlView::OpenGlView(QWidget* parent) noexcept
 OpenGlView::~OpenGlView() noexcept {
   makeCurrent();
   mObjects.clear();
+  OpenGlTriangleBuffer::releaseDestroyedBuffers();
   doneCurrent();
 }
 
@@ -275,6 +277,9 @@ void OpenGlView::paintGL() {
     return;
   }
 
+  // Release graphics memory of no longer used objects.
+  OpenGlTriangleBuffer::releaseDestroyedBuffers();
+
   // Clear color and depth buffer.
   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
@@ -101,7 +101,8 @@ void RuleCheckDock::setMessages(
   updateTitle(mUi->lstMessages->getUnapprovedMessageCount());
 }
 
-void RuleCheckDock::setApprovals(const QSet<SExpression>& approvals) noexcept {
+void RuleCheckDock::setApprovals(
+    const QSet<RuleCheckApproval>& approvals) noexcept {
   mUi->lstMessages->setApprovals(approvals);
   updateTitle(mUi->lstMessages->getUnapprovedMessageCount());
 }
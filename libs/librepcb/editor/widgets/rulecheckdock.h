@@ -75,7 +75,7 @@ public:
   void setProgressPercent(int percent) noexcept;
   void setProgressStatus(const QString& status) noexcept;
   void setMessages(const tl::optional<RuleCheckMessageList>& messages) noexcept;
-  void setApprovals(const QSet<SExpression>& approvals) noexcept;
+  void setApprovals(const QSet<RuleCheckApproval>& approvals) noexcept;
 
   // Operator Overloadings
   RuleCheckDock& operator=(const RuleCheckDock& rhs) = delete;
@@ -22,8 +22,6 @@
  ******************************************************************************/
 #include "rulechecklistwidget.h"
 
-#include <librepcb/core/utils/toolbox.h>
-
 #include <algorithm>
 
 /*******************************************************************************
@@ -33,24 +31,227 @@ namespace librepcb {
 namespace editor {
 
 /*******************************************************************************
- *  Constructors / Destructor
+ *  Class RuleCheckListItemDelegate
+ ******************************************************************************/
+
+RuleCheckListItemDelegate::RuleCheckListItemDelegate(
+    IF_RuleCheckHandler& handler, QObject* parent) noexcept
+  : QStyledItemDelegate(parent), mHandler(handler) {
+}
+
+RuleCheckListItemDelegate::~RuleCheckListItemDelegate() noexcept {
+}
+
+QSize RuleCheckListItemDelegate::sizeHint(const QStyleOptionViewItem& option,
+                                          const QModelIndex& index) const {
+  // Make the rows high enough for the buttons.
+  QSize size = QStyledItemDelegate::sizeHint(option, index);
+  size.setHeight(std::max(size.height(), option.fontMetrics.height() + 8));
+  return size;
+}
+
+void RuleCheckListItemDelegate::paint(QPainter* painter,
+                                      const QStyleOptionViewItem& option,
+                                      const QModelIndex& index) const {
+  if (!getMessage(index)) {
+    QStyledItemDelegate::paint(painter, option, index);  // Placeholder.
+    return;
+  }
+
+  QStyleOptionViewItem opt = option;
+  initStyleOption(&opt, index);
+  const QWidget* widget = opt.widget;
+  QStyle* style = widget ? widget->style() : QApplication::style();
+  const bool approved =
+      index.data(RuleCheckMessageListModel::ApprovedRole).toBool();
+
+  // Background.
+  style->drawPrimitive(QStyle::PE_PanelItemViewItem, &opt, painter, widget);
+
+  // Buttons.
+  int textRight = opt.rect.right();
+  foreach (const Button& button, getButtons(opt, index)) {
+    QStyleOptionToolButton btnOpt;
+    btnOpt.palette = opt.palette;
+    btnOpt.font = opt.font;
+    btnOpt.fontMetrics = opt.fontMetrics;
+    btnOpt.rect = button.rect;
+    btnOpt.text = button.text;
+    btnOpt.toolButtonStyle = Qt::ToolButtonTextOnly;
+    btnOpt.subControls = QStyle::SC_ToolButton;
+    btnOpt.state = QStyle::State_Enabled | QStyle::State_Raised;
+    if (button.action == Action::Approve) {
+      btnOpt.state |= approved ? QStyle::State_On : QStyle::State_Off;
+    }
+    style->drawComplexControl(QStyle::CC_ToolButton, &btnOpt, painter, widget);
+    textRight = std::min(textRight, button.rect.left() - 4);
+  }
+
+  // Severity icon.
+  const QRect iconRect(opt.rect.left(), opt.rect.top(), opt.rect.height(),
+                       opt.rect.height());
+  opt.icon.paint(painter, iconRect.adjusted(2, 2, -2, -2), Qt::AlignCenter,
+                 approved ? QIcon::Disabled : QIcon::Normal);
+
+  // Message.
+  QFont font = opt.font;
+  if (approved) {
+    font.setItalic(true);
+    font.setStrikeOut(true);
+  }
+  const QRect textRect(iconRect.right() + 4, opt.rect.top(),
+                       textRight - iconRect.right() - 4, opt.rect.height());
+  const QPalette::ColorGroup group = (opt.state & QStyle::State_Active)
+      ? QPalette::Active
+      : QPalette::Inactive;
+  const QPalette::ColorRole role = (opt.state & QStyle::State_Selected)
+      ? QPalette::HighlightedText
+      : QPalette::Text;
+  painter->save();
+  painter->setFont(font);
+  painter->setPen(opt.palette.color(group, role));
+  painter->drawText(textRect, Qt::AlignLeft | Qt::AlignVCenter,
+                    QFontMetrics(font).elidedText(opt.text, Qt::ElideRight,
+                                                  textRect.width()));
+  painter->restore();
+}
+
+bool RuleCheckListItemDelegate::editorEvent(QEvent* event,
+                                            QAbstractItemModel* model,
+                                            const QStyleOptionViewItem& option,
+                                            const QModelIndex& index) {
+  if ((event->type() == QEvent::MouseButtonPress) ||
+      (event->type() == QEvent::MouseButtonRelease) ||
+      (event->type() == QEvent::MouseButtonDblClick)) {
+    const QMouseEvent* e = static_cast<const QMouseEvent*>(event);
+    foreach (const Button& button, getButtons(option, index)) {
+      if (!button.rect.contains(e->pos())) {
+        continue;
+      }
+      if ((event->type() == QEvent::MouseButtonRelease) &&
+          (e->button() == Qt::LeftButton)) {
+        // Note: The handler might modify the model, thus the index must not
+        // be used anymore afterwards.
+        std::shared_ptr<const RuleCheckMessage> msg = getMessage(index);
+        const bool approved =
+            index.data(RuleCheckMessageListModel::ApprovedRole).toBool();
+        switch (button.action) {
+          case Action::Fix:
+            mHandler.ruleCheckFixRequested(msg);
+            break;
+          case Action::Approve:
+            mHandler.ruleCheckApproveRequested(msg, !approved);
+            break;
+          case Action::Details:
+            mHandler.ruleCheckDescriptionRequested(msg);
+            break;
+        }
+      }
+      return true;  // Don't select the item when clicking on a button.
+    }
+  }
+  return QStyledItemDelegate::editorEvent(event, model, option, index);
+}
+
+bool RuleCheckListItemDelegate::helpEvent(QHelpEvent* event,
+                                          QAbstractItemView* view,
+                                          const QStyleOptionViewItem& option,
+                                          const QModelIndex& index) {
+  if (event && (event->type() == QEvent::ToolTip)) {
+    foreach (const Button& button, getButtons(option, index)) {
+      if (button.rect.contains(event->pos())) {
+        QToolTip::showText(event->globalPos(), button.toolTip, view);
+        return true;
+      }
+    }
+  }
+  return QStyledItemDelegate::helpEvent(event, view, option, index);
+}
+
+std::shared_ptr<const RuleCheckMessage> RuleCheckListItemDelegate::getMessage(
+    const QModelIndex& index) const noexcept {
+  const RuleCheckMessageListModel* model =
+      qobject_cast<const RuleCheckMessageListModel*>(index.model());
+  return model ? model->getMessage(index) : nullptr;
+}
+
+QList<RuleCheckListItemDelegate::Button> RuleCheckListItemDelegate::getButtons(
+    const QStyleOptionViewItem& option,
+    const QModelIndex& index) const noexcept {
+  QList<Button> buttons;
+  std::shared_ptr<const RuleCheckMessage> msg = getMessage(index);
+  if (!msg) {
+    return buttons;
+  }
+  if (mHandler.ruleCheckFixAvailable(msg)) {
+    buttons.append(Button{Action::Fix, tr("Fix"), tr("Fix Problem"), QRect()});
+  }
+  buttons.append(
+      Button{Action::Approve, "✔", tr("Approve/Disapprove"), QRect()});
+  buttons.append(Button{Action::Details, "?", tr("Details"), QRect()});
+
+  // Layout the buttons right-aligned.
+  const int height = option.rect.height();
+  int right = option.rect.right() + 1;
+  for (int i = buttons.count() - 1; i >= 0; --i) {
+    const int width = std::max(
+        height, option.fontMetrics.horizontalAdvance(buttons.at(i).text) + 8);
+    buttons[i].rect = QRect(right - width, option.rect.top(), width, height);
+    right -= width;
+  }
+  return buttons;
+}
+
+/*******************************************************************************
+ *  Class RuleCheckListWidget
  ******************************************************************************/
 
 RuleCheckListWidget::RuleCheckListWidget(QWidget* parent) noexcept
   : QWidget(parent),
-    mListWidget(new QListWidget(this)),
+    mModel(new RuleCheckMessageListModel(this)),
+    mDelegate(new RuleCheckListItemDelegate(*this, this)),
+    mFilterEdit(new QLineEdit(this)),
+    mFilterDelayTimer(new QTimer(this)),
+    mListView(new QListView(this)),
     mReadOnly(false),
-    mHandler(nullptr),
-    mApprovals(),
-    mUnapprovedMessageCount(tl::nullopt) {
+    mHandler(nullptr) {
   QVBoxLayout* layout = new QVBoxLayout(this);
   layout->setContentsMargins(0, 0, 0, 0);
-  layout->addWidget(mListWidget.data());
-  connect(mListWidget.data(), &QListWidget::currentItemChanged, this,
-          &RuleCheckListWidget::currentItemChanged);
-  connect(mListWidget.data(), &QListWidget::itemDoubleClicked, this,
-          &RuleCheckListWidget::itemDoubleClicked);
-  updateList();  // Ensure consistent GUI enabled state.
+  layout->setSpacing(3);
+
+  mFilterEdit->setPlaceholderText(tr("Filter messages..."));
+  mFilterEdit->setClearButtonEnabled(true);
+  layout->addWidget(mFilterEdit.data());
+
+  // Filtering many messages takes some time, so don't filter on every
+  // keystroke but only after typing paused. Clearing the filter is applied
+  // immediately.
+  mFilterDelayTimer->setSingleShot(true);
+  mFilterDelayTimer->setInterval(250);
+  connect(mFilterDelayTimer.data(), &QTimer::timeout, this,
+          [this]() { mModel->setFilter(mFilterEdit->text()); });
+  connect(mFilterEdit.data(), &QLineEdit::textChanged, this,
+          [this](const QString& text) {
+            if (text.trimmed().isEmpty()) {
+              mFilterDelayTimer->stop();
+              mModel->setFilter(text);
+            } else {
+              mFilterDelayTimer->start();
+            }
+          });
+
+  // Uniform item sizes are important for the performance with many messages.
+  mListView->setUniformItemSizes(true);
+  mListView->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+  mListView->setModel(mModel.data());
+  mListView->setItemDelegate(mDelegate.data());
+  connect(mListView->selectionModel(), &QItemSelectionModel::currentChanged,
+          this, &RuleCheckListWidget::currentChanged);
+  connect(mListView.data(), &QListView::doubleClicked, this,
+          &RuleCheckListWidget::doubleClicked);
+  layout->addWidget(mListView.data());
+
+  updateState();  // Ensure consistent GUI enabled state.
 }
 
 RuleCheckListWidget::~RuleCheckListWidget() noexcept {
@@ -63,102 +264,54 @@ RuleCheckListWidget::~RuleCheckListWidget() noexcept {
 void RuleCheckListWidget::setReadOnly(bool readOnly) noexcept {
   if (readOnly != mReadOnly) {
     mReadOnly = readOnly;
-    updateList();
+    mListView->viewport()->update();  // Show/hide "fix" buttons.
   }
 }
 
 void RuleCheckListWidget::setHandler(IF_RuleCheckHandler* handler) noexcept {
   mHandler = handler;
+  mListView->viewport()->update();  // Show/hide "fix" buttons.
 }
 
 void RuleCheckListWidget::setMessages(
     const tl::optional<RuleCheckMessageList>& messages) noexcept {
-  if (messages != mMessages) {
-    mMessages = messages;
-    updateList();
-  }
+  mModel->setMessages(messages);
+  updateState();
 }
 
 void RuleCheckListWidget::setApprovals(
-    const QSet<SExpression>& approvals) noexcept {
-  if (approvals != mApprovals) {
-    mApprovals = approvals;
-    updateList();
-  }
+    const QSet<RuleCheckApproval>& approvals) noexcept {
+  mModel->setApprovals(approvals);
 }
 
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
 
-void RuleCheckListWidget::updateList() noexcept {
-  // Sort by approval state, severity and message.
-  mDisplayedMessages = mMessages ? (*mMessages) : RuleCheckMessageList();
-  Toolbox::sortNumeric(
-      mDisplayedMessages,
-      [this](const QCollator& cmp,
-             const std::shared_ptr<const RuleCheckMessage>& lhs,
-             const std::shared_ptr<const RuleCheckMessage>& rhs) {
-        if (lhs && rhs) {
-          const bool lhsApproved = mApprovals.contains(lhs->getApproval());
-          const bool rhsApproved = mApprovals.contains(rhs->getApproval());
-          if (lhsApproved != rhsApproved) {
-            return rhsApproved;
-          } else if (lhs->getSeverity() != rhs->getSeverity()) {
-            return lhs->getSeverity() > rhs->getSeverity();
-          } else {
-            return cmp(lhs->getMessage(), rhs->getMessage());
-          }
-        } else {
-          return false;
-        }
-      },
-      Qt::CaseInsensitive, false);
-
-  // Update list widget.
-  mListWidget->setUpdatesEnabled(false);  // Avoid flicker.
-  const bool signalsBlocked = blockSignals(true);
-  mListWidget->clear();
-  int unapprovedMessageCount = 0;
-  foreach (const auto& msg, mDisplayedMessages) {
-    QListWidgetItem* item = new QListWidgetItem();
-    mListWidget->addItem(item);
-    const bool approved = mApprovals.contains(msg->getApproval());
-    RuleCheckListItemWidget* widget =
-        new RuleCheckListItemWidget(msg, *this, approved);
-    mListWidget->setItemWidget(item, widget);
-    if (!approved) {
-      ++unapprovedMessageCount;
-    }
-  }
-  if (mMessages && mMessages->isEmpty()) {
-    mListWidget->addItem(tr("Looks good so far :-)"));
-  }
-  mListWidget->setEnabled(!mDisplayedMessages.isEmpty());
-  blockSignals(signalsBlocked);
-  mListWidget->setUpdatesEnabled(true);
+void RuleCheckListWidget::updateState() noexcept {
+  const int count =
+      mModel->getMessages() ? mModel->getMessages()->count() : 0;
+  mListView->setEnabled(count > 0);
 
-  // Update count of unapproved messages.
-  if (mMessages) {
-    mUnapprovedMessageCount = unapprovedMessageCount;
-  } else {
-    mUnapprovedMessageCount = tl::nullopt;
+  // The filter is only useful if there are many messages.
+  const bool showFilter = (count > 10);
+  if ((!showFilter) && (!mFilterEdit->text().isEmpty())) {
+    mFilterEdit->clear();
   }
+  mFilterEdit->setVisible(showFilter);
 }
 
-void RuleCheckListWidget::currentItemChanged(
-    QListWidgetItem* current, QListWidgetItem* previous) noexcept {
+void RuleCheckListWidget::currentChanged(const QModelIndex& current,
+                                         const QModelIndex& previous) noexcept {
   Q_UNUSED(previous);
-  std::shared_ptr<const RuleCheckMessage> msg =
-      mDisplayedMessages.value(mListWidget->row(current));
+  std::shared_ptr<const RuleCheckMessage> msg = mModel->getMessage(current);
   if (msg && mHandler) {
     mHandler->ruleCheckMessageSelected(msg);
   }
 }
 
-void RuleCheckListWidget::itemDoubleClicked(QListWidgetItem* item) noexcept {
-  std::shared_ptr<const RuleCheckMessage> msg =
-      mDisplayedMessages.value(mListWidget->row(item));
+void RuleCheckListWidget::doubleClicked(const QModelIndex& index) noexcept {
+  std::shared_ptr<const RuleCheckMessage> msg = mModel->getMessage(index);
   if (msg && mHandler) {
     mHandler->ruleCheckMessageDoubleClicked(msg);
   }
@@ -23,6 +23,8 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
+#include "../modelview/rulecheckmessagelistmodel.h"
+
 #include <librepcb/core/rulecheck/rulecheckmessage.h>
 #include <optional/tl/optional.hpp>
 
@@ -63,99 +65,61 @@ protected:
 };
 
 /*******************************************************************************
- *  Class RuleCheckListItemWidget
+ *  Class RuleCheckListItemDelegate
  ******************************************************************************/
 
 /**
- * @brief The RuleCheckListItemWidget class
+ * @brief Item delegate painting a ::librepcb::RuleCheckMessage list item
+ *
+ * Paints the severity icon, the message and the "Fix", "Approve" and
+ * "Details" buttons of a ::librepcb::editor::RuleCheckMessageListModel row.
+ * The buttons are only painted, clicks on them are handled in editorEvent(),
+ * so no widgets need to be created for the items.
  */
-class RuleCheckListItemWidget final : public QWidget {
+class RuleCheckListItemDelegate final : public QStyledItemDelegate {
   Q_OBJECT
 
 public:
   // Constructors / Destructor
-  explicit RuleCheckListItemWidget(std::shared_ptr<const RuleCheckMessage> msg,
-                                   IF_RuleCheckHandler& handler, bool approved,
-                                   QWidget* parent = nullptr) noexcept
-    : QWidget(parent),
-      mMessage(msg),
-      mHandler(handler),
-      mIconLabel(new QLabel(this)) {
-    if (!msg) return;
-    QHBoxLayout* layout = new QHBoxLayout(this);
-    layout->setContentsMargins(0, 0, 0, 0);
-    layout->setSpacing(0);
-
-    // severity icon
-    mIconLabel->setScaledContents(true);
-    mIconLabel->setPixmap(msg->getSeverityIcon().pixmap(
-        48, approved ? QIcon::Disabled : QIcon::Normal));
-    layout->addWidget(mIconLabel.data());
-    layout->addSpacing(3);
-
-    // message
-    QLabel* lblMsg = new QLabel(msg->getMessage(), this);
-    lblMsg->setToolTip(msg->getMessage());
-    if (approved) {
-      QFont font = lblMsg->font();
-      font.setItalic(true);
-      font.setStrikeOut(true);
-      lblMsg->setFont(font);
-    }
-    layout->addWidget(lblMsg);
-    layout->addSpacing(3);
-    layout->setStretch(1, 100);
-
-    // "fix" button
-    if (mHandler.ruleCheckFixAvailable(mMessage)) {
-      QToolButton* btnFix = new QToolButton(this);
-      btnFix->setText(tr("Fix"));
-      btnFix->setToolTip(tr("Fix Problem"));
-      btnFix->setStatusTip(
-          tr("Automatically apply a modification to fix this message"));
-      connect(btnFix, &QToolButton::clicked, this,
-              [this]() { mHandler.ruleCheckFixRequested(mMessage); });
-      layout->addWidget(btnFix);
-    }
-
-    // "approve" button
-    QToolButton* btnApprove = new QToolButton(this);
-    btnApprove->setText("✔");
-    btnApprove->setToolTip(tr("Approve/Disapprove"));
-    btnApprove->setStatusTip(tr("Mark/unmark this message as approved"));
-    btnApprove->setCheckable(true);
-    btnApprove->setChecked(approved);
-    connect(btnApprove, &QToolButton::clicked, this, [this, msg](bool checked) {
-      mHandler.ruleCheckApproveRequested(mMessage, checked);
-    });
-    layout->addWidget(btnApprove);
-
-    // "details" button
-    QToolButton* btnDetails = new QToolButton(this);
-    btnDetails->setText("?");
-    btnDetails->setToolTip(tr("Details"));
-    btnDetails->setStatusTip(tr("Show more information about this message"));
-    connect(btnDetails, &QToolButton::clicked, this,
-            [this]() { mHandler.ruleCheckDescriptionRequested(mMessage); });
-    layout->addWidget(btnDetails);
-  }
-  RuleCheckListItemWidget(const RuleCheckListItemWidget& other) = delete;
-  ~RuleCheckListItemWidget() noexcept {}
+  RuleCheckListItemDelegate() = delete;
+  RuleCheckListItemDelegate(const RuleCheckListItemDelegate& other) = delete;
+  explicit RuleCheckListItemDelegate(IF_RuleCheckHandler& handler,
+                                     QObject* parent = nullptr) noexcept;
+  ~RuleCheckListItemDelegate() noexcept;
+
+  // Inherited from QStyledItemDelegate
+  QSize sizeHint(const QStyleOptionViewItem& option,
+                 const QModelIndex& index) const override;
+  void paint(QPainter* painter, const QStyleOptionViewItem& option,
+             const QModelIndex& index) const override;
+  bool editorEvent(QEvent* event, QAbstractItemModel* model,
+                   const QStyleOptionViewItem& option,
+                   const QModelIndex& index) override;
+  bool helpEvent(QHelpEvent* event, QAbstractItemView* view,
+                 const QStyleOptionViewItem& option,
+                 const QModelIndex& index) override;
 
   // Operator Overloadings
-  RuleCheckListItemWidget& operator=(const RuleCheckListItemWidget& rhs) =
+  RuleCheckListItemDelegate& operator=(const RuleCheckListItemDelegate& rhs) =
       delete;
 
+private:  // Types
+  enum class Action { Fix, Approve, Details };
+  struct Button {
+    Action action;
+    QString text;
+    QString toolTip;
+    QRect rect;
+  };
+
 private:  // Methods
-  void resizeEvent(QResizeEvent* event) override {
-    QWidget::resizeEvent(event);
-    mIconLabel->setFixedWidth(mIconLabel->height());
-  }
+  std::shared_ptr<const RuleCheckMessage> getMessage(
+      const QModelIndex& index) const noexcept;
+  QList<Button> getButtons(const QStyleOptionViewItem& option,
+                           const QModelIndex& index) const noexcept;
 
 private:  // Data
-  std::shared_ptr<const RuleCheckMessage> mMessage;
   IF_RuleCheckHandler& mHandler;
-  QScopedPointer<QLabel> mIconLabel;
 };
 
 /*******************************************************************************
@@ -176,23 +140,23 @@ public:
 
   // Getters
   const tl::optional<int>& getUnapprovedMessageCount() const noexcept {
-    return mUnapprovedMessageCount;
+    return mModel->getUnapprovedMessageCount();
   }
 
   // Setters
   void setReadOnly(bool readOnly) noexcept;
   void setHandler(IF_RuleCheckHandler* handler) noexcept;
   void setMessages(const tl::optional<RuleCheckMessageList>& messages) noexcept;
-  void setApprovals(const QSet<SExpression>& approvals) noexcept;
+  void setApprovals(const QSet<RuleCheckApproval>& approvals) noexcept;
 
   // Operator Overloadings
   RuleCheckListWidget& operator=(const RuleCheckListWidget& rhs) = delete;
 
 private:  // Methods
-  void updateList() noexcept;
-  void currentItemChanged(QListWidgetItem* current,
-                          QListWidgetItem* previous) noexcept;
-  void itemDoubleClicked(QListWidgetItem* item) noexcept;
+  void updateState() noexcept;
+  void currentChanged(const QModelIndex& current,
+                      const QModelIndex& previous) noexcept;
+  void doubleClicked(const QModelIndex& index) noexcept;
   bool ruleCheckFixAvailable(
       std::shared_ptr<const RuleCheckMessage> msg) noexcept override;
   void ruleCheckFixRequested(
@@ -207,13 +171,13 @@ private:  // Methods
       std::shared_ptr<const RuleCheckMessage> msg) noexcept override;
 
 private:  // Data
-  QScopedPointer<QListWidget> mListWidget;
+  QScopedPointer<RuleCheckMessageListModel> mModel;
+  QScopedPointer<RuleCheckListItemDelegate> mDelegate;
+  QScopedPointer<QLineEdit> mFilterEdit;
+  QScopedPointer<QTimer> mFilterDelayTimer;  ///< Debounces filter edits
+  QScopedPointer<QListView> mListView;
   bool mReadOnly;
   IF_RuleCheckHandler* mHandler;
-  tl::optional<RuleCheckMessageList> mMessages;
-  RuleCheckMessageList mDisplayedMessages;
-  QSet<SExpression> mApprovals;
-  tl::optional<int> mUnapprovedMessageCount;
 };
 
 /*******************************************************************************
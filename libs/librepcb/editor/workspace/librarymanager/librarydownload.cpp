@@ -24,8 +24,12 @@
 
 #include <librepcb/core/fileio/fileutils.h>
 #include <librepcb/core/library/library.h>
+#include <librepcb/core/library/librarymanifest.h>
 #include <librepcb/core/network/filedownload.h>
+#include <librepcb/core/network/networkrequest.h>
+#include <librepcb/core/utils/toolbox.h>
 
+#include <QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -43,7 +47,10 @@ LibraryDownload::LibraryDownload(const QUrl& urlToZip,
   : QObject(nullptr),
     mDestDir(destDir),
     mTempDestDir(destDir.toStr() % ".tmp"),
-    mTempZipFile(mDestDir.toStr() % ".zip") {
+    mTempZipFile(mDestDir.toStr() % ".zip"),
+    mStarted(false),
+    mAbortRequested(false),
+    mTotalFileCount(0) {
   mFileDownload.reset(new FileDownload(urlToZip, mTempZipFile));
   mFileDownload->setZipExtractionDirectory(mTempDestDir);
   connect(mFileDownload.data(), &FileDownload::progressState, this,
@@ -58,6 +65,8 @@ LibraryDownload::LibraryDownload(const QUrl& urlToZip,
           &LibraryDownload::downloadSucceeded, Qt::QueuedConnection);
   connect(this, &LibraryDownload::abortRequested, mFileDownload.data(),
           &FileDownload::abort, Qt::QueuedConnection);
+  connect(&mManifestWatcher, &QFutureWatcher<ManifestComparison>::finished,
+          this, &LibraryDownload::manifestCompared);
 }
 
 LibraryDownload::~LibraryDownload() noexcept {
@@ -88,16 +97,26 @@ void LibraryDownload::setExpectedChecksum(
   }
 }
 
+void LibraryDownload::setManifestUrl(const QUrl& url) noexcept {
+  if (!mStarted) {
+    mManifestUrl = url;
+  } else {
+    qCritical() << "Calling LibraryDownload::setManifestUrl() after "
+                   "start() is not allowed!";
+  }
+}
+
 /*******************************************************************************
  *  Public Slots
  ******************************************************************************/
 
 void LibraryDownload::start() noexcept {
-  if (!mFileDownload) {
+  if (mStarted) {
     qCritical()
         << "Calling LibraryDownload::start() multiple times is not allowed!";
     return;
   }
+  mStarted = true;
 
   // Delete the temporary destination directory if it already exists. It might
   // be left there after a failed or aborted download attempt.
@@ -121,12 +140,28 @@ void LibraryDownload::start() noexcept {
     }
   }
 
-  // Release ownership of the FileDownload object because it will be deleted by
-  // itself after the download finished!
-  mFileDownload.take()->start();
+  // If the library is already installed, try to update only the modified
+  // elements. Otherwise download the whole library.
+  if (mManifestUrl.isValid() &&
+      Library::isValidElementDirectory<Library>(mDestDir)) {
+    emit progressState(tr("Download library manifest..."));
+    NetworkRequest* request = new NetworkRequest(mManifestUrl);
+    connect(request, &NetworkRequest::dataReceived, this,
+            &LibraryDownload::manifestReceived, Qt::QueuedConnection);
+    connect(request, &NetworkRequest::errored, this,
+            &LibraryDownload::manifestErrored, Qt::QueuedConnection);
+    connect(request, &NetworkRequest::aborted, this,
+            &LibraryDownload::downloadAborted, Qt::QueuedConnection);
+    connect(this, &LibraryDownload::abortRequested, request,
+            &NetworkRequest::abort, Qt::QueuedConnection);
+    request->start();
+  } else {
+    startZipDownload();
+  }
 }
 
 void LibraryDownload::abort() noexcept {
+  mAbortRequested = true;
   emit abortRequested();
 }
 
@@ -195,6 +230,155 @@ void LibraryDownload::downloadSucceeded() noexcept {
   emit finished(true, QString());
 }
 
+void LibraryDownload::startZipDownload() noexcept {
+  // Release ownership of the FileDownload object because it will be deleted by
+  // itself after the download finished!
+  mModifiedPaths = tl::nullopt;
+  mFileDownload.take()->start();
+}
+
+void LibraryDownload::manifestReceived(const QByteArray& data) noexcept {
+  if (mAbortRequested) {
+    emit finished(false, QString());
+    return;
+  }
+
+  // Hashing all files of the installed library takes some time, thus the
+  // comparison is done in a worker thread to keep the UI responsive.
+  emit progressState(tr("Compare library manifest..."));
+  const FilePath destDir = mDestDir;
+  mManifestWatcher.setFuture(QtConcurrent::run(
+      [data, destDir]() { return compareManifest(data, destDir); }));
+}
+
+void LibraryDownload::manifestErrored(const QString& errMsg) noexcept {
+  qWarning() << "Failed to download library manifest, downloading the whole "
+                "library instead:"
+             << errMsg;
+  if (mAbortRequested) {
+    emit finished(false, QString());
+  } else {
+    startZipDownload();
+  }
+}
+
+void LibraryDownload::manifestCompared() noexcept {
+  if (mAbortRequested) {
+    emit finished(false, QString());
+    return;
+  }
+
+  const ManifestComparison result = mManifestWatcher.result();
+  if (result.error) {
+    qWarning() << "Failed to compare library manifest, downloading the whole "
+                  "library instead:"
+               << *result.error;
+    startZipDownload();
+    return;
+  }
+
+  mModifiedItems = result.modifiedItems;
+  mPendingFiles = result.files;
+  mTotalFileCount = mPendingFiles.count();
+  qInfo().nospace() << "Incremental library update: " << mModifiedItems.count()
+                    << " modified items, " << mTotalFileCount
+                    << " files to download.";
+  emit progressState(tr("Download modified library elements..."));
+  downloadNextFile();
+}
+
+LibraryDownload::ManifestComparison LibraryDownload::compareManifest(
+    const QByteArray& data, const FilePath& dir) noexcept {
+  ManifestComparison result;
+  try {
+    const LibraryManifest remote = LibraryManifest::parse(data);  // can throw
+    if (!remote.getFiles().contains(".librepcb-lib")) {
+      throw RuntimeError(__FILE__, __LINE__,
+                         "The manifest does not describe a library.");
+    }
+    const LibraryManifest local =
+        LibraryManifest::fromDirectory(dir);  // can throw
+    const QSet<QString> modifiedItems = remote.getModifiedItems(local);
+    result.modifiedItems = Toolbox::toList(modifiedItems);
+    result.modifiedItems.sort();
+    foreach (const QString& filePath, remote.getFilesOfItems(modifiedItems)) {
+      result.files.append(
+          std::make_pair(filePath, remote.getFiles().value(filePath)));
+    }
+  } catch (const Exception& e) {
+    result.error = e.getMsg();
+  }
+  return result;
+}
+
+void LibraryDownload::downloadNextFile() noexcept {
+  if (mAbortRequested) {
+    emit finished(false, QString());
+    return;
+  }
+  if (mPendingFiles.isEmpty()) {
+    applyIncrementalUpdate();
+    return;
+  }
+
+  emit progressPercent((100 * (mTotalFileCount - mPendingFiles.count())) /
+                       (mTotalFileCount + 1));
+  const std::pair<QString, QByteArray> file = mPendingFiles.takeFirst();
+  QUrl relativeUrl;
+  relativeUrl.setPath(file.first);
+  FileDownload* download = new FileDownload(mManifestUrl.resolved(relativeUrl),
+                                            mTempDestDir.getPathTo(file.first));
+  download->setExpectedChecksum(QCryptographicHash::Sha256, file.second);
+  connect(download, &FileDownload::errored, this,
+          &LibraryDownload::downloadErrored, Qt::QueuedConnection);
+  connect(download, &FileDownload::aborted, this,
+          &LibraryDownload::downloadAborted, Qt::QueuedConnection);
+  connect(download, &FileDownload::succeeded, this,
+          &LibraryDownload::downloadNextFile, Qt::QueuedConnection);
+  connect(this, &LibraryDownload::abortRequested, download,
+          &FileDownload::abort, Qt::QueuedConnection);
+  download->start();
+}
+
+void LibraryDownload::applyIncrementalUpdate() noexcept {
+  // Replace each modified item by its downloaded version, or remove it if it
+  // does not exist anymore.
+  QSet<FilePath> modifiedPaths;
+  try {
+    foreach (const QString& item, mModifiedItems) {
+      const FilePath src = mTempDestDir.getPathTo(item);
+      const FilePath dst = mDestDir.getPathTo(item);
+      if (dst.isExistingDir()) {
+        FileUtils::removeDirRecursively(dst);  // can throw
+      } else if (dst.isExistingFile()) {
+        FileUtils::removeFile(dst);  // can throw
+      }
+      if (src.isExistingDir() || src.isExistingFile()) {
+        FileUtils::makePath(dst.getParentDir());  // can throw
+        FileUtils::move(src, dst);  // can throw
+      }
+      modifiedPaths.insert(dst);
+    }
+  } catch (const Exception& e) {
+    // The library might be in an inconsistent state now, but retrying the
+    // update will fix it since the manifest comparison detects all differences.
+    emit finished(false, e.getMsg());
+    return;
+  }
+
+  // clean up
+  try {
+    if (mTempDestDir.isExistingDir()) {
+      FileUtils::removeDirRecursively(mTempDestDir);  // can throw
+    }
+  } catch (...) {
+  }
+
+  mModifiedPaths = modifiedPaths;
+  emit progressPercent(100);
+  emit finished(true, QString());
+}
+
 FilePath LibraryDownload::getPathToLibDir() noexcept {
   if (Library::isValidElementDirectory<Library>(mTempDestDir)) {
     return mTempDestDir;
@@ -24,6 +24,7 @@
  *  Includes
  ******************************************************************************/
 #include <librepcb/core/fileio/filepath.h>
+#include <optional/tl/optional.hpp>
 
 #include <QtCore>
 
@@ -42,6 +43,11 @@ namespace editor {
 
 /**
  * @brief The LibraryDownload class
+ *
+ * Downloads a library as a ZIP file and installs it into the destination
+ * directory. If a manifest URL is set (see #setManifestUrl()) and the library
+ * is already installed, only the modified library elements are downloaded
+ * instead (incremental update).
  */
 class LibraryDownload final : public QObject {
   Q_OBJECT
@@ -56,6 +62,18 @@ public:
   // Getters
   const FilePath& getDestinationDir() const noexcept { return mDestDir; }
 
+  /**
+   * @brief Get the paths which were modified by an incremental update
+   *
+   * @return  Absolute paths of all added, removed or modified library elements
+   *          (and other files) if the library was updated incrementally,
+   *          `tl::nullopt` if the whole library was (re-)installed. Only
+   *          valid after #finished() was emitted with success.
+   */
+  const tl::optional<QSet<FilePath>>& getModifiedPaths() const noexcept {
+    return mModifiedPaths;
+  }
+
   // Setters
 
   /**
@@ -69,6 +87,19 @@ public:
   void setExpectedChecksum(QCryptographicHash::Algorithm algorithm,
                            const QByteArray& checksum) noexcept;
 
+  /**
+   * @brief Set the URL of the library manifest to allow incremental updates
+   *
+   * If the library is already installed, the manifest (see
+   * ::librepcb::LibraryManifest) is downloaded and compared with the installed
+   * files. Then only the modified items are downloaded, from URLs relative to
+   * the manifest URL. If the manifest cannot be downloaded or is invalid, the
+   * whole ZIP file is downloaded instead.
+   *
+   * @param url   URL of the manifest file.
+   */
+  void setManifestUrl(const QUrl& url) noexcept;
+
   // Operator Overloadings
   LibraryDownload& operator=(const LibraryDownload& rhs) = delete;
 
@@ -91,10 +122,26 @@ signals:
   void finished(bool success, const QString& errMsg);
   void abortRequested();  // internal signal!
 
+private:  // Types
+  /// Result of comparing the remote manifest with the installed library
+  struct ManifestComparison {
+    QStringList modifiedItems;  ///< Sorted items to be replaced
+    QList<std::pair<QString, QByteArray>> files;  ///< Path & SHA-256
+    tl::optional<QString> error;  ///< Error message on failure
+  };
+
 private:  // Methods
   void downloadErrored(const QString& errMsg) noexcept;
   void downloadAborted() noexcept;
   void downloadSucceeded() noexcept;
+  void startZipDownload() noexcept;
+  void manifestReceived(const QByteArray& data) noexcept;
+  void manifestErrored(const QString& errMsg) noexcept;
+  void manifestCompared() noexcept;
+  static ManifestComparison compareManifest(const QByteArray& data,
+                                            const FilePath& dir) noexcept;
+  void downloadNextFile() noexcept;
+  void applyIncrementalUpdate() noexcept;
   FilePath getPathToLibDir() noexcept;
 
 private:  // Data
@@ -102,6 +149,16 @@ private:  // Data
   FilePath mDestDir;
   FilePath mTempDestDir;
   FilePath mTempZipFile;
+  bool mStarted;
+  bool mAbortRequested;
+
+  // Incremental update
+  QUrl mManifestUrl;
+  QFutureWatcher<ManifestComparison> mManifestWatcher;  ///< Worker thread
+  QStringList mModifiedItems;  ///< Sorted items to be replaced
+  QList<std::pair<QString, QByteArray>> mPendingFiles;  ///< Path & SHA-256
+  int mTotalFileCount;
+  tl::optional<QSet<FilePath>> mModifiedPaths;
 };
 
 /*******************************************************************************
@@ -131,6 +131,7 @@ void OnlineLibraryListWidgetItem::startDownloadIfSelected() noexcept {
     qint64 zipSize = mJsonObject.value("download_size").toInt(-1);
     QByteArray zipSha256 =
         mJsonObject.value("download_sha256").toString().toUtf8();
+    QUrl manifestUrl = QUrl(mJsonObject.value("manifest_url").toString());
 
     // determine destination directory
     QString libDirName = mUuid->toStr() % ".lplib";
@@ -146,6 +147,9 @@ void OnlineLibraryListWidgetItem::startDownloadIfSelected() noexcept {
       mLibraryDownload->setExpectedChecksum(QCryptographicHash::Sha256,
                                             QByteArray::fromHex(zipSha256));
     }
+    if (manifestUrl.isValid()) {
+      mLibraryDownload->setManifestUrl(manifestUrl);
+    }
     connect(mLibraryDownload.data(), &LibraryDownload::progressPercent,
             mUi->prgProgress, &QProgressBar::setValue, Qt::QueuedConnection);
     connect(mLibraryDownload.data(), &LibraryDownload::finished, this,
@@ -174,10 +178,17 @@ void OnlineLibraryListWidgetItem::downloadFinished(
   mUi->prgProgress->setVisible(false);
 
   // delete download helper
+  const tl::optional<QSet<FilePath>> modifiedPaths =
+      success ? mLibraryDownload->getModifiedPaths() : tl::nullopt;
   mLibraryDownload.reset();
 
-  // start library scanner to index the new library
-  mWorkspace.getLibraryDb().startLibraryRescan();
+  // start library scanner to index the new library (or only the modified
+  // elements after an incremental update)
+  if (modifiedPaths) {
+    mWorkspace.getLibraryDb().startLibraryElementsRescan(*modifiedPaths);
+  } else {
+    mWorkspace.getLibraryDb().startLibraryRescan();
+  }
 }
 
 void OnlineLibraryListWidgetItem::iconReceived(
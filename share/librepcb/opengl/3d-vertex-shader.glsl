@@ -4,6 +4,7 @@ precision mediump float;
 #endif
 
 uniform mat4 mvp_matrix;
+uniform mat4 model_matrix;
 
 attribute vec4 a_position;
 attribute vec4 a_color;
@@ -12,5 +13,5 @@ varying vec4 v_color;
 
 void main() {
     v_color = a_color;
-    gl_Position = mvp_matrix * a_position;
+    gl_Position = mvp_matrix * model_matrix * a_position;
 }
@@ -0,0 +1,253 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmark.h"
+
+#include <librepcb/core/application.h>
+#include <librepcb/core/exceptions.h>
+
+#include <QtCore>
+
+#include <algorithm>
+#include <exception>
+#include <iostream>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Class BenchmarkState
+ ******************************************************************************/
+
+BenchmarkState::BenchmarkState(qint64 minTimeNs, int minIterations,
+                               int maxIterations) noexcept
+  : mMinTimeNs(minTimeNs),
+    mMinIterations(minIterations),
+    mMaxIterations(maxIterations),
+    mTimer(),
+    mRunning(false),
+    mIterationStartNs(0),
+    mPauseStartNs(-1),
+    mPausedNs(0),
+    mTotalNs(0),
+    mIterationTimesNs() {
+}
+
+BenchmarkState::~BenchmarkState() noexcept {
+}
+
+bool BenchmarkState::keepRunning() noexcept {
+  if (mRunning) {
+    resumeTiming();  // In case the iteration ended while paused.
+    const qint64 elapsed =
+        mTimer.nsecsElapsed() - mIterationStartNs - mPausedNs;
+    mIterationTimesNs.append(elapsed);
+    mTotalNs += elapsed;
+  } else {
+    mRunning = true;
+    mTimer.start();
+  }
+
+  const int iterations = mIterationTimesNs.count();
+  if ((iterations >= mMaxIterations) ||
+      ((iterations >= mMinIterations) && (mTotalNs >= mMinTimeNs))) {
+    return false;
+  }
+
+  mPausedNs = 0;
+  mIterationStartNs = mTimer.nsecsElapsed();
+  return true;
+}
+
+void BenchmarkState::pauseTiming() noexcept {
+  if (mPauseStartNs < 0) {
+    mPauseStartNs = mTimer.nsecsElapsed();
+  }
+}
+
+void BenchmarkState::resumeTiming() noexcept {
+  if (mPauseStartNs >= 0) {
+    mPausedNs += mTimer.nsecsElapsed() - mPauseStartNs;
+    mPauseStartNs = -1;
+  }
+}
+
+/*******************************************************************************
+ *  Class Benchmark
+ ******************************************************************************/
+
+bool Benchmark::add(const QString& name, Function func) noexcept {
+  Q_ASSERT(!registry().contains(name));
+  registry().insert(name, func);
+  return true;
+}
+
+QStringList Benchmark::getNames() noexcept {
+  return registry().keys();
+}
+
+const Benchmark::Config& Benchmark::getConfig() noexcept {
+  return config();
+}
+
+QList<Benchmark::Result> Benchmark::run(const Config& cfg,
+                                        QStringList& failed) noexcept {
+  config() = cfg;
+  QList<Result> results;
+  for (auto it = registry().begin(); it != registry().end(); ++it) {
+    if (!cfg.filter.match(it.key()).hasMatch()) {
+      continue;
+    }
+    std::cout << qPrintable(it.key().leftJustified(40)) << std::flush;
+    BenchmarkState state(cfg.minTimeMs * 1000000, cfg.minIterations,
+                         cfg.maxIterations);
+    try {
+      it.value()(state);
+    } catch (const Exception& e) {
+      std::cout << "FAILED: " << qPrintable(e.getMsg()) << std::endl;
+      failed.append(it.key());
+      continue;
+    } catch (const std::exception& e) {
+      std::cout << "FAILED: " << e.what() << std::endl;
+      failed.append(it.key());
+      continue;
+    } catch (...) {
+      std::cout << "FAILED: Unknown exception" << std::endl;
+      failed.append(it.key());
+      continue;
+    }
+    QVector<qint64> times = state.getIterationTimesNs();
+    if (times.isEmpty()) {
+      std::cout << "SKIPPED" << std::endl;
+      continue;
+    }
+    std::sort(times.begin(), times.end());
+    qint64 sum = 0;
+    foreach (qint64 t, times) { sum += t; }
+    const Result result{it.key(),        times.count(),
+                        times.first(),   times.at(times.count() / 2),
+                        sum / times.count(), times.last()};
+    std::cout << qPrintable(formatTime(result.medianNs).rightJustified(12))
+              << "  (" << result.iterations << " iterations)" << std::endl;
+    results.append(result);
+  }
+  return results;
+}
+
+QJsonDocument Benchmark::toJson(const QList<Result>& results) noexcept {
+  QJsonObject context;
+  context["version"] = Application::getVersion();
+  context["git_revision"] = Application::getGitRevision();
+  context["date"] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+  context["qt_version"] = QString(qVersion());
+  context["cpu_architecture"] = QSysInfo::currentCpuArchitecture();
+  context["threads"] = QThread::idealThreadCount();
+
+  QJsonArray benchmarks;
+  foreach (const Result& result, results) {
+    QJsonObject obj;
+    obj["name"] = result.name;
+    obj["iterations"] = result.iterations;
+    obj["min_ns"] = result.minNs;
+    obj["median_ns"] = result.medianNs;
+    obj["mean_ns"] = result.meanNs;
+    obj["max_ns"] = result.maxNs;
+    benchmarks.append(obj);
+  }
+
+  QJsonObject root;
+  root["context"] = context;
+  root["benchmarks"] = benchmarks;
+  return QJsonDocument(root);
+}
+
+void Benchmark::compare(const QList<Result>& results,
+                        const QJsonDocument& baseline) noexcept {
+  QHash<QString, qint64> baselineMedians;
+  foreach (const QJsonValue& value,
+           baseline.object().value("benchmarks").toArray()) {
+    const QJsonObject obj = value.toObject();
+    baselineMedians.insert(obj.value("name").toString(),
+                           obj.value("median_ns").toVariant().toLongLong());
+  }
+
+  std::cout << "\nComparison of medians against baseline ("
+            << qPrintable(baseline.object()
+                              .value("context")
+                              .toObject()
+                              .value("git_revision")
+                              .toString())
+            << "):" << std::endl;
+  foreach (const Result& result, results) {
+    const qint64 base = baselineMedians.value(result.name, 0);
+    std::cout << qPrintable(result.name.leftJustified(40));
+    if (base > 0) {
+      const qreal change = (qreal(result.medianNs) / base - 1) * 100;
+      std::cout << qPrintable(formatTime(base).rightJustified(12)) << " -> "
+                << qPrintable(formatTime(result.medianNs).rightJustified(12))
+                << qPrintable(QString(" (%1%2%)")
+                                  .arg(change >= 0 ? "+" : "")
+                                  .arg(change, 0, 'f', 1))
+                << std::endl;
+    } else {
+      std::cout << "(not in baseline)" << std::endl;
+    }
+  }
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+QMap<QString, Benchmark::Function>& Benchmark::registry() noexcept {
+  // Function-local static to be independent of the initialization order of
+  // the static benchmark registrations.
+  static QMap<QString, Function> registry;
+  return registry;
+}
+
+Benchmark::Config& Benchmark::config() noexcept {
+  static Config config;
+  return config;
+}
+
+QString Benchmark::formatTime(qint64 ns) noexcept {
+  if (ns >= 1000000000) {
+    return QString::number(ns / 1e9, 'f', 3) % " s";
+  } else if (ns >= 1000000) {
+    return QString::number(ns / 1e6, 'f', 3) % " ms";
+  } else if (ns >= 1000) {
+    return QString::number(ns / 1e3, 'f', 3) % " us";
+  } else {
+    return QString::number(ns) % " ns";
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
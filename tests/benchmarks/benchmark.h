@@ -0,0 +1,163 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_BENCHMARKS_BENCHMARK_H
+#define LIBREPCB_BENCHMARKS_BENCHMARK_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/core/fileio/filepath.h>
+
+#include <QtCore>
+
+#include <functional>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Class BenchmarkState
+ ******************************************************************************/
+
+/**
+ * @brief Controls the measurement loop of a single benchmark
+ *
+ * A benchmark function performs its setup, then runs the code to measure in
+ * a `while (state.keepRunning()) { ... }` loop. Only the time spent inside
+ * the loop body is measured, except while the timing is paused.
+ */
+class BenchmarkState final {
+public:
+  // Constructors / Destructor
+  BenchmarkState() = delete;
+  BenchmarkState(const BenchmarkState& other) = delete;
+  BenchmarkState(qint64 minTimeNs, int minIterations,
+                 int maxIterations) noexcept;
+  ~BenchmarkState() noexcept;
+
+  // Getters
+  const QVector<qint64>& getIterationTimesNs() const noexcept {
+    return mIterationTimesNs;
+  }
+
+  // General Methods
+  bool keepRunning() noexcept;
+  void pauseTiming() noexcept;
+  void resumeTiming() noexcept;
+
+  // Operator Overloadings
+  BenchmarkState& operator=(const BenchmarkState& rhs) = delete;
+
+private:  // Data
+  const qint64 mMinTimeNs;
+  const int mMinIterations;
+  const int mMaxIterations;
+  QElapsedTimer mTimer;
+  bool mRunning;
+  qint64 mIterationStartNs;
+  qint64 mPauseStartNs;
+  qint64 mPausedNs;
+  qint64 mTotalNs;
+  QVector<qint64> mIterationTimesNs;
+};
+
+/*******************************************************************************
+ *  Class Benchmark
+ ******************************************************************************/
+
+/**
+ * @brief Registry and runner of all benchmarks
+ *
+ * Benchmarks are registered with the #LIBREPCB_BENCHMARK macro and run by
+ * #run(), which prints a summary and reports the names of failed benchmarks.
+ * The results can be written as JSON with #toJson() and compared against the
+ * JSON of another commit with #compare().
+ */
+class Benchmark final {
+public:
+  // Types
+  typedef std::function<void(BenchmarkState&)> Function;
+
+  struct Config {
+    QRegularExpression filter;
+    qint64 minTimeMs = 500;
+    int minIterations = 1;
+    int maxIterations = 1000000;
+    FilePath projectFile;  ///< Project for macro benchmarks (optional)
+    int syntheticDevices = 200;  ///< Size of the generated project
+    FilePath librariesDir;  ///< Libraries for the library scan benchmark
+  };
+
+  struct Result {
+    QString name;
+    int iterations;
+    qint64 minNs;
+    qint64 medianNs;
+    qint64 meanNs;
+    qint64 maxNs;
+  };
+
+  // Constructors / Destructor
+  Benchmark() = delete;
+  Benchmark(const Benchmark& other) = delete;
+  ~Benchmark() = delete;
+
+  // General Methods
+  static bool add(const QString& name, Function func) noexcept;
+  static QStringList getNames() noexcept;
+  static const Config& getConfig() noexcept;
+  static QList<Result> run(const Config& config,
+                           QStringList& failed) noexcept;
+  static QJsonDocument toJson(const QList<Result>& results) noexcept;
+  static void compare(const QList<Result>& results,
+                      const QJsonDocument& baseline) noexcept;
+
+  // Operator Overloadings
+  Benchmark& operator=(const Benchmark& rhs) = delete;
+
+private:  // Methods
+  static QMap<QString, Function>& registry() noexcept;
+  static Config& config() noexcept;
+  static QString formatTime(qint64 ns) noexcept;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
+
+/**
+ * @brief Define and register a benchmark named `group/name`
+ */
+#define LIBREPCB_BENCHMARK(group, name)                                        \
+  static void benchmark_##group##_##name(                                      \
+      ::librepcb::benchmarks::BenchmarkState& state);                          \
+  static const bool sBenchmarkRegistered_##group##_##name =                    \
+      ::librepcb::benchmarks::Benchmark::add(                                  \
+          #group "/" #name, &benchmark_##group##_##name);                      \
+  static void benchmark_##group##_##name(                                      \
+      ::librepcb::benchmarks::BenchmarkState& state)
+
+#endif
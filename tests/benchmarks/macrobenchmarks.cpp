@@ -0,0 +1,237 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmark.h"
+
+#include <librepcb/core/exceptions.h>
+#include <librepcb/core/fileio/fileutils.h>
+#include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/board/boardfabricationoutputsettings.h>
+#include <librepcb/core/project/board/boardgerberexport.h>
+#include <librepcb/core/project/board/boardplanefragmentsbuilder.h>
+#include <librepcb/core/project/board/drc/boarddesignrulecheck.h>
+#include <librepcb/core/project/project.h>
+#include <librepcb/core/project/projectloader.h>
+#include <librepcb/core/project/syntheticprojectgenerator.h>
+#include <librepcb/core/utils/scopeguard.h>
+#include <librepcb/core/workspace/theme.h>
+#include <librepcb/core/workspace/workspacelibraryscanner.h>
+#include <librepcb/editor/graphics/defaultgraphicslayerprovider.h>
+#include <librepcb/editor/project/boardeditor/boardgraphicsscene.h>
+#include <librepcb/editor/widgets/graphicsview.h>
+
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Helpers
+ ******************************************************************************/
+
+static FilePath getProjectFile() {
+  const Benchmark::Config& config = Benchmark::getConfig();
+  if (config.projectFile.isValid()) {
+    return config.projectFile;
+  }
+
+  // Generate the project only once, all benchmarks share it.
+  static QTemporaryDir tmpDir;
+  const FilePath fp = FilePath(tmpDir.path()).getPathTo("synthetic.lpp");
+  if (!fp.isExistingFile()) {
+    SyntheticProjectGenerator::Settings settings;
+    settings.deviceCount = config.syntheticDevices;
+    settings.netCount = config.syntheticDevices;
+    settings.traceCount = config.syntheticDevices * 3;
+    settings.viaCount = config.syntheticDevices;
+    SyntheticProjectGenerator generator(settings);
+    std::shared_ptr<TransactionalFileSystem> fs =
+        TransactionalFileSystem::openRW(fp.getParentDir());  // can throw
+    std::unique_ptr<Project> project = generator.generate(
+        std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(fs)),
+        fp.getFilename());  // can throw
+    project->save();  // can throw
+    fs->save();  // can throw
+  }
+  return fp;
+}
+
+static std::unique_ptr<Project> openProject() {
+  const FilePath fp = getProjectFile();  // can throw
+  if (!fp.isExistingFile()) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       QString("Project file not found: %1")
+                           .arg(fp.toNative()));
+  }
+  std::shared_ptr<TransactionalFileSystem> fs =
+      TransactionalFileSystem::openRO(fp.getParentDir());
+  ProjectLoader loader;
+  return loader.open(
+      std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(fs)),
+      fp.getFilename());  // can throw
+}
+
+static Board& getFirstBoard(Project& project) {
+  if (project.getBoards().isEmpty()) {
+    throw RuntimeError(__FILE__, __LINE__, "The project contains no board.");
+  }
+  return *project.getBoards().first();
+}
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+LIBREPCB_BENCHMARK(Project, Open) {
+  while (state.keepRunning()) {
+    std::unique_ptr<Project> project = openProject();  // can throw
+    state.pauseTiming();  // Don't measure the destruction.
+    project.reset();
+    state.resumeTiming();
+  }
+}
+
+LIBREPCB_BENCHMARK(Board, RebuildPlanes) {
+  std::unique_ptr<Project> project = openProject();  // can throw
+  Board& board = getFirstBoard(*project);  // can throw
+  while (state.keepRunning()) {
+    BoardPlaneFragmentsBuilder builder;
+    builder.runAndApply(board);  // can throw
+  }
+}
+
+LIBREPCB_BENCHMARK(Board, RebuildAirWires) {
+  std::unique_ptr<Project> project = openProject();  // can throw
+  Board& board = getFirstBoard(*project);  // can throw
+  while (state.keepRunning()) {
+    board.forceAirWiresRebuild();
+  }
+}
+
+LIBREPCB_BENCHMARK(Board, DesignRuleCheck) {
+  std::unique_ptr<Project> project = openProject();  // can throw
+  Board& board = getFirstBoard(*project);  // can throw
+  while (state.keepRunning()) {
+    BoardDesignRuleCheck drc;
+    drc.start(board, board.getDrcSettings(), false);
+    const BoardDesignRuleCheck::Result result = drc.waitForFinished();
+    if (!result.errors.isEmpty()) {
+      throw RuntimeError(__FILE__, __LINE__, result.errors.join("\n"));
+    }
+  }
+}
+
+LIBREPCB_BENCHMARK(Board, RenderPanZoom) {
+  std::unique_ptr<Project> project = openProject();  // can throw
+  Board& board = getFirstBoard(*project);  // can throw
+  BoardPlaneFragmentsBuilder builder;
+  builder.runAndApply(board);  // can throw
+  Theme theme;
+  editor::DefaultGraphicsLayerProvider layerProvider(theme);
+  editor::BoardGraphicsScene scene(
+      board, layerProvider, std::make_shared<QSet<const NetSignal*>>());
+  editor::GraphicsView view;
+  view.resize(1280, 720);
+  view.setScene(&scene);
+  QImage image(view.size(), QImage::Format_ARGB32_Premultiplied);
+
+  // Script: Zoom out to the whole board, zoom in step by step towards the
+  // center, then pan across the board at the highest zoom level. Every step
+  // is rendered like a repaint of the board editor.
+  const QRectF boardRect = scene.itemsBoundingRect();
+  QVector<QRectF> script;
+  for (int i = 0; i < 8; ++i) {
+    const qreal factor = std::pow(0.7, i);
+    QRectF rect(0, 0, boardRect.width() * factor, boardRect.height() * factor);
+    rect.moveCenter(boardRect.center());
+    script.append(rect);
+  }
+  const QRectF zoomedRect = script.last();
+  for (int i = -8; i <= 8; ++i) {
+    script.append(zoomedRect.translated(i * boardRect.width() / 20,
+                                        i * boardRect.height() / 40));
+  }
+
+  while (state.keepRunning()) {
+    foreach (const QRectF& rect, script) {
+      view.setVisibleSceneRect(rect);
+      QPainter painter(&image);
+      view.render(&painter);
+    }
+  }
+}
+
+LIBREPCB_BENCHMARK(Board, GerberExport) {
+  std::unique_ptr<Project> project = openProject();  // can throw
+  Board& board = getFirstBoard(*project);  // can throw
+  const FilePath outDir = FilePath::getRandomTempPath();
+  auto outDirGuard = scopeGuard(
+      [&outDir]() { QDir(outDir.toStr()).removeRecursively(); });
+  BoardFabricationOutputSettings settings =
+      board.getFabricationOutputSettings();
+  settings.setOutputBasePath(outDir.toStr() % "/{{PROJECT}}");
+  while (state.keepRunning()) {
+    BoardGerberExport exporter(board);
+    exporter.exportPcbLayers(settings);  // can throw
+  }
+}
+
+LIBREPCB_BENCHMARK(Library, WorkspaceScan) {
+  const FilePath tmpDir = FilePath::getRandomTempPath();
+  auto tmpDirGuard = scopeGuard(
+      [&tmpDir]() { QDir(tmpDir.toStr()).removeRecursively(); });
+  FilePath librariesDir = Benchmark::getConfig().librariesDir;
+  if (!librariesDir.isValid()) {
+    // Scan a library from the test data.
+    const FilePath src(TEST_DATA_DIR "/libraries/Populated Library.lplib");
+    librariesDir = tmpDir.getPathTo("libraries");
+    FileUtils::copyDirRecursively(
+        src, librariesDir.getPathTo("local/" % src.getFilename()));
+  }
+  WorkspaceLibraryScanner scanner(librariesDir,
+                                  tmpDir.getPathTo("library-cache.sqlite"));
+  QString error;
+  QObject::connect(&scanner, &WorkspaceLibraryScanner::scanFailed, &scanner,
+                   [&error](const QString& msg) { error = msg; });
+  while (state.keepRunning()) {
+    QEventLoop loop;
+    QObject::connect(&scanner, &WorkspaceLibraryScanner::scanFinished, &loop,
+                     &QEventLoop::quit, Qt::QueuedConnection);
+    scanner.startScan();
+    loop.exec();
+    if (!error.isEmpty()) {
+      throw RuntimeError(__FILE__, __LINE__, error);
+    }
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
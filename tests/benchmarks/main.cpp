@@ -0,0 +1,174 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmark.h"
+
+#include <librepcb/core/application.h>
+#include <librepcb/core/debug.h>
+#include <librepcb/core/exceptions.h>
+#include <librepcb/core/fileio/fileutils.h>
+
+#include <QtCore>
+#include <QtWidgets>
+
+#include <iostream>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+using namespace librepcb;
+using namespace librepcb::benchmarks;
+
+/*******************************************************************************
+ *  The Benchmark Program
+ ******************************************************************************/
+
+int main(int argc, char* argv[]) {
+  // Initialize a common locale for all benchmarks.
+  QLocale::setDefault(QLocale(QLocale::English, QLocale::UnitedStates));
+
+  // Many classes rely on a QApplication instance, so we create it here.
+  QApplication app(argc, argv);
+  QApplication::setOrganizationName("LibrePCB");
+  QApplication::setOrganizationDomain("librepcb.org");
+  QApplication::setApplicationName("LibrePCB-Benchmarks");
+
+  // Disable the whole debug output, it would distort the measurements.
+  Debug::instance()->setDebugLevelLogFile(Debug::DebugLevel_t::Nothing);
+  Debug::instance()->setDebugLevelStderr(Debug::DebugLevel_t::Nothing);
+
+  // Perform global initialization tasks.
+  Application::loadBundledFonts();
+
+  // Parse command line arguments.
+  QCommandLineParser parser;
+  parser.setApplicationDescription("LibrePCB Benchmarks");
+  parser.addHelpOption();
+  const QCommandLineOption listOption("list", "List all benchmarks and exit.");
+  const QCommandLineOption filterOption(
+      "filter", "Only run benchmarks whose name matches the regex <filter>.",
+      "filter");
+  const QCommandLineOption jsonOption(
+      "json", "Write the results as JSON to <file>.", "file");
+  const QCommandLineOption compareOption(
+      "compare", "Compare the results with a previously written JSON <file>.",
+      "file");
+  const QCommandLineOption minTimeOption(
+      "min-time", "Minimum measurement time per benchmark (default: 500).",
+      "ms", "500");
+  const QCommandLineOption maxIterationsOption(
+      "max-iterations", "Maximum number of iterations per benchmark.", "n",
+      "1000000");
+  const QCommandLineOption projectOption(
+      "project",
+      "Project file used for the project benchmarks (default: a generated "
+      "project, see '--devices').",
+      "lpp");
+  const QCommandLineOption devicesOption(
+      "devices", "Number of devices of the generated project (default: 200).",
+      "n", "200");
+  const QCommandLineOption librariesOption(
+      "libraries",
+      "Directory containing '*.lplib' libraries to be scanned by the library "
+      "benchmarks (default: a library from the test data).",
+      "dir");
+  parser.addOption(listOption);
+  parser.addOption(filterOption);
+  parser.addOption(jsonOption);
+  parser.addOption(compareOption);
+  parser.addOption(minTimeOption);
+  parser.addOption(maxIterationsOption);
+  parser.addOption(projectOption);
+  parser.addOption(devicesOption);
+  parser.addOption(librariesOption);
+  parser.process(app);
+
+  if (parser.isSet(listOption)) {
+    foreach (const QString& name, Benchmark::getNames()) {
+      std::cout << qPrintable(name) << std::endl;
+    }
+    return 0;
+  }
+
+  Benchmark::Config config;
+  config.filter = QRegularExpression(parser.value(filterOption));
+  if (!config.filter.isValid()) {
+    std::cerr << "Invalid filter: "
+              << qPrintable(config.filter.errorString()) << std::endl;
+    return 1;
+  }
+  config.minTimeMs = parser.value(minTimeOption).toLongLong();
+  config.maxIterations = qMax(parser.value(maxIterationsOption).toInt(), 1);
+  if (parser.isSet(projectOption)) {
+    config.projectFile =
+        FilePath(QFileInfo(parser.value(projectOption)).absoluteFilePath());
+  }
+  config.syntheticDevices = qMax(parser.value(devicesOption).toInt(), 1);
+  if (parser.isSet(librariesOption)) {
+    config.librariesDir =
+        FilePath(QFileInfo(parser.value(librariesOption)).absoluteFilePath());
+  }
+
+  // Load the baseline before running, to fail early on invalid files.
+  QJsonDocument baseline;
+  if (parser.isSet(compareOption)) {
+    try {
+      const FilePath fp(
+          QFileInfo(parser.value(compareOption)).absoluteFilePath());
+      QJsonParseError error;
+      baseline = QJsonDocument::fromJson(FileUtils::readFile(fp), &error);
+      if (baseline.isNull()) {
+        throw RuntimeError(__FILE__, __LINE__, error.errorString());
+      }
+    } catch (const Exception& e) {
+      std::cerr << "Failed to load baseline: " << qPrintable(e.getMsg())
+                << std::endl;
+      return 1;
+    }
+  }
+
+  // Run the benchmarks.
+  QStringList failed;
+  const QList<Benchmark::Result> results = Benchmark::run(config, failed);
+
+  // Output the results.
+  if (parser.isSet(jsonOption)) {
+    try {
+      const FilePath fp(QFileInfo(parser.value(jsonOption)).absoluteFilePath());
+      FileUtils::writeFile(fp, Benchmark::toJson(results).toJson());
+    } catch (const Exception& e) {
+      std::cerr << "Failed to write JSON: " << qPrintable(e.getMsg())
+                << std::endl;
+      return 1;
+    }
+  }
+  if (!baseline.isNull()) {
+    Benchmark::compare(results, baseline);
+  }
+  if (!failed.isEmpty()) {
+    std::cerr << "\n"
+              << failed.count() << " benchmark(s) failed: "
+              << qPrintable(failed.join(", ")) << std::endl;
+    return 1;
+  }
+  return 0;
+}
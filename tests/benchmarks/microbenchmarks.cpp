@@ -0,0 +1,167 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmark.h"
+
+#include <librepcb/core/application.h>
+#include <librepcb/core/font/strokefont.h>
+#include <librepcb/core/geometry/path.h>
+#include <librepcb/core/serialization/sexpression.h>
+#include <librepcb/core/types/alignment.h>
+#include <librepcb/core/types/uuid.h>
+#include <librepcb/core/utils/clipperhelpers.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Helpers
+ ******************************************************************************/
+
+static QByteArray createSExpression(int items) noexcept {
+  QByteArray content = "(librepcb_board " %
+      Uuid::createRandom().toStr().toUtf8() % "\n";
+  for (int i = 0; i < items; ++i) {
+    content += " (via " % Uuid::createRandom().toStr().toUtf8() %
+        " (from top_cu) (to bot_cu)\n  (position " %
+        QByteArray::number(i * 0.127, 'f', 3) % " " %
+        QByteArray::number(i * 0.254, 'f', 3) %
+        ") (size 0.7) (drill 0.3) (exposure off)\n )\n";
+  }
+  content += ")\n";
+  return content;
+}
+
+static QVector<Path> createTracks(int count) noexcept {
+  QVector<Path> paths;
+  for (int i = 0; i < count; ++i) {
+    const Length x(i * 500000);
+    paths.append(Path({
+        Vertex(Point(x, 0), Angle::deg0()),
+        Vertex(Point(x + 2000000, 3000000), Angle::deg90()),
+        Vertex(Point(x + 5000000, 3000000), Angle::deg0()),
+    }));
+  }
+  return paths;
+}
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+LIBREPCB_BENCHMARK(SExpression, Parse) {
+  const QByteArray content = createSExpression(10000);
+  const FilePath fp("/benchmark/board.lp");
+  while (state.keepRunning()) {
+    std::unique_ptr<SExpression> root = SExpression::parse(content, fp);
+    Q_UNUSED(root);
+  }
+}
+
+LIBREPCB_BENCHMARK(SExpression, Serialize) {
+  const std::unique_ptr<SExpression> root =
+      SExpression::parse(createSExpression(10000), FilePath("/benchmark/b.lp"));
+  while (state.keepRunning()) {
+    const QByteArray content = root->toByteArray();
+    Q_UNUSED(content);
+  }
+}
+
+LIBREPCB_BENCHMARK(Geometry, PathToOutlineStrokes) {
+  const QVector<Path> tracks = createTracks(1000);
+  const PositiveLength width(250000);
+  while (state.keepRunning()) {
+    foreach (const Path& track, tracks) {
+      const QVector<Path> outlines = track.toOutlineStrokes(width);
+      Q_UNUSED(outlines);
+    }
+  }
+}
+
+LIBREPCB_BENCHMARK(Geometry, ClipperOffset) {
+  const QVector<Path> tracks = createTracks(1000);
+  const PositiveLength tolerance(5000);
+  ClipperLib::Paths input;
+  foreach (const Path& track, tracks) {
+    input.push_back(ClipperHelpers::convert(track, tolerance));
+  }
+  while (state.keepRunning()) {
+    ClipperLib::Paths paths = input;
+    ClipperHelpers::offset(paths, Length(100000), tolerance);
+  }
+}
+
+LIBREPCB_BENCHMARK(Geometry, ClipperUnite) {
+  const PositiveLength tolerance(5000);
+  ClipperLib::Paths input;
+  for (int i = 0; i < 1000; ++i) {
+    const Point pos(Length((i % 40) * 700000), Length((i / 40) * 700000));
+    input.push_back(ClipperHelpers::convert(
+        Path::circle(PositiveLength(1000000)).translated(pos), tolerance));
+  }
+  while (state.keepRunning()) {
+    ClipperLib::Paths paths = input;
+    ClipperHelpers::unite(paths, ClipperLib::pftNonZero);
+  }
+}
+
+LIBREPCB_BENCHMARK(Types, UuidHash) {
+  QVector<Uuid> uuids;
+  for (int i = 0; i < 10000; ++i) {
+    uuids.append(Uuid::createRandom());
+  }
+  while (state.keepRunning()) {
+    QSet<Uuid> set;
+    foreach (const Uuid& uuid, uuids) { set.insert(uuid); }
+  }
+}
+
+LIBREPCB_BENCHMARK(Font, StrokeText) {
+  const StrokeFont& font = Application::getDefaultStrokeFont();
+  const QString text =
+      "The quick brown fox jumps over the lazy dog\n0123456789 {{NAME}}";
+  {
+    // Warm up, i.e. wait until the font is loaded.
+    Point bottomLeft, topRight;
+    font.stroke(text, PositiveLength(1000000), Length(0), Length(0),
+                Alignment(), bottomLeft, topRight);
+  }
+  while (state.keepRunning()) {
+    Point bottomLeft, topRight;
+    const QVector<Path> paths =
+        font.stroke(text, PositiveLength(1000000), Length(0), Length(0),
+                    Alignment(), bottomLeft, topRight);
+    Q_UNUSED(paths);
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
@@ -0,0 +1,77 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import os
+import pytest
+
+"""
+Test command "generate-project"
+"""
+
+
+def test_generate_and_open(cli):
+    path = cli.abspath('synthetic/synthetic.lpp')
+    code, stdout, stderr = cli.run('generate-project', '--devices=20',
+                                   '--nets=10', '--traces=0', '--vias=0',
+                                   '--planes=3', '--layers=6', path)
+    assert stderr == ''
+    assert stdout == \
+        "Generate project '{path}'...\n" \
+        " - 20 devices, 10 nets, 0 traces, 0 vias, 3 planes on 6 copper " \
+        "layers\n" \
+        "Save project...\n" \
+        "SUCCESS\n".format(path=path)
+    assert code == 0
+
+    # The generated project must be valid and canonical.
+    code, stdout, stderr = cli.run('open-project', '--strict', path)
+    assert stderr == ''
+    assert stdout == \
+        "Open project '{path}'...\n" \
+        "SUCCESS\n".format(path=path)
+    assert code == 0
+
+
+def test_same_seed_generates_same_project(cli):
+    contents = []
+    for name in ['a', 'b']:
+        path = cli.abspath('{}/synthetic.lpp'.format(name))
+        code, stdout, stderr = cli.run('generate-project', '--seed=42',
+                                       '--devices=50', path)
+        assert stderr == ''
+        assert code == 0
+        with open(cli.abspath('{}/boards/synthetic/board.lp'.format(name)),
+                  'rb') as f:
+            contents.append(f.read())
+    assert contents[0] == contents[1]
+
+
+def test_existing_project_fails(cli):
+    path = cli.abspath('synthetic/synthetic.lpp')
+    code, stdout, stderr = cli.run('generate-project', '--devices=1', path)
+    assert code == 0
+    code, stdout, stderr = cli.run('generate-project', '--devices=1', path)
+    assert 'already contains a LibrePCB project' in stderr
+    assert code == 1
+
+
+@pytest.mark.parametrize("argument", [
+    '--seed=abc',
+    '--devices=0',
+    '--devices=1O',
+    '--pads=1',
+    '--nets=0',
+    '--traces=-1',
+    '--vias=x',
+    '--planes=-1',
+    '--layers=1',
+])
+def test_invalid_settings(cli, argument):
+    path = cli.abspath('synthetic/synthetic.lpp')
+    code, stdout, stderr = cli.run('generate-project', argument, path)
+    option, value = argument.split('=')
+    assert stderr.startswith(
+        "ERROR: Invalid value '{}' for '{}', expected ".format(value, option))
+    assert stdout == "Finished with errors!\n"
+    assert code == 1
+    assert not os.path.exists(path)
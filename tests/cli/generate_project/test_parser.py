@@ -0,0 +1,67 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+"""
+Test command "generate-project" (basic parser tests)
+"""
+
+HELP_TEXT = """\
+Usage: {executable} [options] generate-project [command_options] project
+LibrePCB Command Line Interface
+
+Options:
+  -h, --help           Print this message.
+  -V, --version        Displays version information.
+  -v, --verbose        Verbose output.
+  --trace-file <file>  Record the duration of internal operations and write
+                       them to this file in the Chrome trace event format
+                       (viewable with https://ui.perfetto.dev).
+  --seed <n>           Seed of the random generator (default: 0).
+  --devices <n>        Number of devices (default: 100).
+  --pads <n>           Number of pads per synthetic device (default: 8).
+  --nets <n>           Number of nets (default: 100).
+  --traces <n>         Maximum number of traces (default: 300).
+  --vias <n>           Maximum number of vias (default: 100).
+  --planes <n>         Number of planes (default: 2).
+  --layers <n>         Number of copper layers (default: 4).
+  --library <dir>      Take devices from this library (*.lplib) instead of
+                       generating synthetic ones. Can be given multiple times,
+                       e.g. for each library of the workspace.
+
+Arguments:
+  generate-project     Generate a large synthetic project for scaling tests.
+  project              Path to the project file to create (*.lpp).
+"""
+
+ERROR_TEXT = """\
+{error}
+Usage: {executable} [options] generate-project [command_options] project
+Help: {executable} generate-project --help
+"""
+
+
+def test_help(cli):
+    code, stdout, stderr = cli.run('generate-project', '--help')
+    assert stderr == ''
+    assert stdout == HELP_TEXT.format(executable=cli.executable)
+    assert code == 0
+
+
+def test_no_arguments(cli):
+    code, stdout, stderr = cli.run('generate-project')
+    assert stderr == ERROR_TEXT.format(
+        executable=cli.executable,
+        error="Missing arguments: project",
+    )
+    assert stdout == ''
+    assert code == 1
+
+
+def test_invalid_argument(cli):
+    code, stdout, stderr = cli.run('generate-project', '--invalid-argument')
+    assert stderr == ERROR_TEXT.format(
+        executable=cli.executable,
+        error="Unknown option 'invalid-argument'.",
+    )
+    assert stdout == ''
+    assert code == 1
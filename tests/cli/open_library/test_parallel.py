@@ -0,0 +1,137 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import os
+import params
+import re
+import shutil
+import subprocess
+
+"""
+Test command "open-library --jobs", "--shard", "--changed-since",
+"--changed-files"
+"""
+
+
+def process_counts(stdout):
+    return [int(n) for n in re.findall(r'^Process (\d+) ', stdout, re.M)]
+
+
+def test_output_independent_of_jobs(cli):
+    library = params.POPULATED_LIBRARY
+    cli.add_library(library.dir)
+    for subdir in ['sym', 'pkg', 'cmp']:
+        shutil.rmtree(cli.abspath(os.path.join(library.dir, subdir)))
+    results = [cli.run('open-library', '--all', '--check', '--jobs', jobs,
+                       library.dir) for jobs in ['1', '2', '16']]
+    assert results[0][0] == 1
+    assert results[0][2] != ''
+    assert results[1] == results[0]
+    assert results[2] == results[0]
+
+
+def test_invalid_jobs(cli):
+    library = params.POPULATED_LIBRARY
+    cli.add_library(library.dir)
+    for jobs in ['0', '-1', 'foo']:
+        code, stdout, stderr = cli.run('open-library', '--all', '--jobs',
+                                       jobs, library.dir)
+        assert stderr == "ERROR: Invalid number of jobs '{}', expected a " \
+            "positive integer.\n".format(jobs)
+        assert stdout == "Finished with errors!\n"
+        assert code == 1
+
+
+def test_shards(cli):
+    library = params.POPULATED_LIBRARY
+    cli.add_library(library.dir)
+    counts = []
+    for shard in ['1/3', '2/3', '3/3']:
+        code, stdout, stderr = cli.run('open-library', '--all', '--shard',
+                                       shard, library.dir)
+        assert stderr == ''
+        assert code == 0
+        counts.append(process_counts(stdout))
+    assert [sum(c) for c in zip(*counts)] == [
+        library.cmpcat, library.pkgcat, library.sym, library.pkg,
+        library.cmp, library.dev]
+    assert max(sum(c) for c in counts) - min(sum(c) for c in counts) <= 1
+
+
+def test_invalid_shard(cli):
+    library = params.POPULATED_LIBRARY
+    cli.add_library(library.dir)
+    code, stdout, stderr = cli.run('open-library', '--all', '--shard', '3/2',
+                                   library.dir)
+    assert stderr == \
+        "ERROR: Invalid shard '3/2', expected 'i/n' with 1 <= i <= n.\n"
+    assert stdout == "Finished with errors!\n"
+    assert code == 1
+
+
+def test_changed_files(cli):
+    library = params.POPULATED_LIBRARY
+    cli.add_library(library.dir)
+    listfile = cli.abspath('changed.txt')
+    with open(listfile, 'w') as f:
+        f.write('dev/f83a5ae8-7f42-42be-9dd6-e762f4da2ec2/device.lp\n')
+        f.write('dev/f83a5ae8-7f42-42be-9dd6-e762f4da2ec2/device.lp\n')
+        f.write('\n')
+    code, stdout, stderr = cli.run('open-library', '--all', '--check',
+                                   '--changed-files', listfile, library.dir)
+    assert stderr == \
+        "  - Crystal ABM3 (f83a5ae8-7f42-42be-9dd6-e762f4da2ec2):\n" \
+        "    - [HINT] No part numbers added\n"
+    assert stdout == \
+        "Open library '{library.dir}'...\n" \
+        "Process 0 component categories...\n" \
+        "Process 0 package categories...\n" \
+        "Process 0 symbols...\n" \
+        "Process 0 packages...\n" \
+        "Process 0 components...\n" \
+        "Process 1 devices...\n" \
+        "Finished with errors!\n".format(library=library)
+    assert code == 1
+
+
+def test_changed_since(cli):
+    library = params.POPULATED_LIBRARY
+    cli.add_library(library.dir)
+    libdir = cli.abspath(library.dir)
+
+    def git(*args):
+        subprocess.check_call(['git', '-c', 'user.name=test',
+                               '-c', 'user.email=test@example.com'] +
+                              list(args), cwd=libdir)
+    git('init', '-q')
+    git('add', '-A')
+    git('commit', '-q', '-m', 'Initial commit')
+    device = 'dev/f83a5ae8-7f42-42be-9dd6-e762f4da2ec2/device.lp'
+    with open(os.path.join(libdir, device), 'a') as f:
+        f.write('\n')
+    code, stdout, stderr = cli.run('open-library', '--all', '--check',
+                                   '--changed-since', 'HEAD', library.dir)
+    assert stderr == \
+        "  - Crystal ABM3 (f83a5ae8-7f42-42be-9dd6-e762f4da2ec2):\n" \
+        "    - [HINT] No part numbers added\n"
+    assert stdout == \
+        "Open library '{library.dir}'...\n" \
+        "Process 0 component categories...\n" \
+        "Process 0 package categories...\n" \
+        "Process 0 symbols...\n" \
+        "Process 0 packages...\n" \
+        "Process 0 components...\n" \
+        "Process 1 devices...\n" \
+        "Finished with errors!\n".format(library=library)
+    assert code == 1
+
+
+def test_changed_since_invalid_revision(cli):
+    library = params.POPULATED_LIBRARY
+    cli.add_library(library.dir)
+    code, stdout, stderr = cli.run('open-library', '--all', '--changed-since',
+                                   'nonexistent-rev', library.dir)
+    assert stderr.startswith(
+        "ERROR: Failed to determine files changed since 'nonexistent-rev': ")
+    assert stdout.endswith("Finished with errors!\n")
+    assert code == 1
@@ -10,25 +10,42 @@ Usage: {executable} [options] open-library [command_options] library
 LibrePCB Command Line Interface
 
 Options:
-  -h, --help     Print this message.
-  -V, --version  Displays version information.
-  -v, --verbose  Verbose output.
-  --all          Perform the selected action(s) on all elements contained in
-                 the opened library.
-  --check        Run the library element check, print all non-approved messages
-                 and report failure (exit code = 1) if there are non-approved
-                 messages.
-  --minify-step  Minify the STEP models of all packages. Only works in
-                 conjunction with '--all'. Pass '--save' to write the minified
-                 files to disk.
-  --save         Save library (and contained elements if '--all' is given)
-                 before closing them (useful to upgrade file format).
-  --strict       Fail if the opened files are not strictly canonical, i.e.
-                 there would be changes when saving the library elements.
+  -h, --help                  Print this message.
+  -V, --version               Displays version information.
+  -v, --verbose               Verbose output.
+  --trace-file <file>         Record the duration of internal operations and
+                              write them to this file in the Chrome trace event
+                              format (viewable with https://ui.perfetto.dev).
+  --all                       Perform the selected action(s) on all elements
+                              contained in the opened library.
+  --check                     Run the library element check, print all
+                              non-approved messages and report failure (exit
+                              code = 1) if there are non-approved messages.
+  --minify-step               Minify the STEP models of all packages. Only
+                              works in conjunction with '--all'. Pass '--save'
+                              to write the minified files to disk.
+  --save                      Save library (and contained elements if '--all'
+                              is given) before closing them (useful to upgrade
+                              file format).
+  --strict                    Fail if the opened files are not strictly
+                              canonical, i.e. there would be changes when saving
+                              the library elements.
+  --jobs <n>                  Number of library elements to process in parallel
+                              (default: number of CPU cores). The console output
+                              is the same for any value.
+  --shard <i/n>               Only process the i-th of n equally sized parts of
+                              the library elements (e.g. '2/4'), to split
+                              '--all' across multiple machines.
+  --changed-since <revision>  Only process library elements containing files
+                              which were modified since the given Git revision
+                              (requires 'git' to be installed).
+  --changed-files <file>      Only process library elements containing any of
+                              the files listed in the given text file (one path
+                              per line, relative to the library directory).
 
 Arguments:
-  open-library   Open a library to execute library-related tasks.
-  library        Path to library directory (*.lplib).
+  open-library                Open a library to execute library-related tasks.
+  library                     Path to library directory (*.lplib).
 """
 
 ERROR_TEXT = """\
@@ -0,0 +1,29 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import params
+import pytest
+
+"""
+Test command "open-project --memory-report"
+"""
+
+
+@pytest.mark.parametrize("project", [params.PROJECT_WITH_TWO_BOARDS_LPPZ_PARAM])
+def test_memory_report(cli, project):
+    cli.add_project(project.dir, as_lppz=project.is_lppz)
+    code, stdout, stderr = cli.run('open-project', '--memory-report',
+                                   project.path)
+    assert stderr == ''
+    assert code == 0
+    lines = stdout.splitlines()
+    index = lines.index('Memory report (approximate):')
+    report = lines[index + 1:lines.index('SUCCESS')]
+    assert report[-1].startswith('  Total: ')
+    categories = [line.split(':')[0].strip() for line in report]
+    assert 'Circuit' in categories
+    assert 'Library' in categories
+    assert 'Symbols' in categories
+    assert 'Devices' in categories
+    assert len([c for c in categories if c.startswith("Board '")]) == 2
+    assert len([c for c in categories if c.startswith("Schematic '")]) >= 1
@@ -15,6 +15,10 @@ Options:
   -h, --help                         Print this message.
   -V, --version                      Displays version information.
   -v, --verbose                      Verbose output.
+  --trace-file <file>                Record the duration of internal operations
+                                     and write them to this file in the Chrome
+                                     trace event format (viewable with
+                                     https://ui.perfetto.dev).
   --erc                              Run the electrical rule check, print all
                                      non-approved warnings/errors and report
                                      failure (exit code = 1) if there are
@@ -95,6 +99,10 @@ Options:
                                      canonical, i.e. there would be changes when
                                      saving the project. Note that this option
                                      is not available for *.lppz files.
+  --memory-report                    Print the approximate memory usage of the
+                                     project after all other actions, broken
+                                     down by schematics, boards and library
+                                     elements.
 
 Arguments:
   open-project                       Open a project to execute project-related
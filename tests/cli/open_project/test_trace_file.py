@@ -0,0 +1,31 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import json
+
+import params
+import pytest
+
+"""
+Test command "open-project --trace-file"
+"""
+
+
+@pytest.mark.parametrize("project", [params.PROJECT_WITH_TWO_BOARDS_LPPZ_PARAM])
+def test_trace_file(cli, project):
+    cli.add_project(project.dir, as_lppz=project.is_lppz)
+    trace_file = cli.abspath('trace.json')
+    code, stdout, stderr = cli.run('open-project', '--drc',
+                                   '--trace-file=' + trace_file, project.path)
+    assert stderr == ''
+    assert code == 0
+    with open(trace_file, 'r') as f:
+        trace = json.load(f)
+    events = [e for e in trace['traceEvents'] if e['ph'] == 'X']
+    names = set(e['name'] for e in events)
+    assert 'open' in names
+    assert 'loadBoard' in names
+    assert 'checkCopperCopperClearances' in names
+    for event in events:
+        assert event['dur'] >= 0
+
@@ -10,23 +10,26 @@ Usage: {executable} [options] open-step [command_options] file
 LibrePCB Command Line Interface
 
 Options:
-  -h, --help        Print this message.
-  -V, --version     Displays version information.
-  -v, --verbose     Verbose output.
-  --minify          Minify the STEP model before validating it. Use in
-                    conjunction with '--save-to' to save the output of the
-                    operation.
-  --tesselate       Tesselate the loaded STEP model to check if LibrePCB is
-                    able to render it. Reports failure (exit code = 1) if no
-                    content is detected.
-  --save-to <file>  Write the (modified) STEP file to this output location (may
-                    be equal to the opened file path). Only makes sense in
-                    conjunction with '--minify'.
+  -h, --help           Print this message.
+  -V, --version        Displays version information.
+  -v, --verbose        Verbose output.
+  --trace-file <file>  Record the duration of internal operations and write
+                       them to this file in the Chrome trace event format
+                       (viewable with https://ui.perfetto.dev).
+  --minify             Minify the STEP model before validating it. Use in
+                       conjunction with '--save-to' to save the output of the
+                       operation.
+  --tesselate          Tesselate the loaded STEP model to check if LibrePCB is
+                       able to render it. Reports failure (exit code = 1) if no
+                       content is detected.
+  --save-to <file>     Write the (modified) STEP file to this output location
+                       (may be equal to the opened file path). Only makes sense
+                       in conjunction with '--minify'.
 
 Arguments:
-  open-step         Open a STEP model to execute STEP-related tasks outside of
-                    a library.
-  file              Path to the STEP file (*.step).
+  open-step            Open a STEP model to execute STEP-related tasks outside
+                       of a library.
+  file                 Path to the STEP file (*.step).
 """
 
 ERROR_TEXT = """\
@@ -14,17 +14,21 @@ Usage: {executable} [options] command
 LibrePCB Command Line Interface
 
 Options:
-  -h, --help     Print this message.
-  -V, --version  Displays version information.
-  -v, --verbose  Verbose output.
+  -h, --help           Print this message.
+  -V, --version        Displays version information.
+  -v, --verbose        Verbose output.
+  --trace-file <file>  Record the duration of internal operations and write
+                       them to this file in the Chrome trace event format
+                       (viewable with https://ui.perfetto.dev).
 
 Arguments:
-  command        The command to execute (see list below).
+  command              The command to execute (see list below).
 
 Commands:
-  open-library   Open a library to execute library-related tasks.
-  open-project   Open a project to execute project-related tasks.
-  open-step      Open a STEP model to execute STEP-related tasks outside of a library.
+  generate-project  Generate a large synthetic project for scaling tests.
+  open-library      Open a library to execute library-related tasks.
+  open-project      Open a project to execute project-related tasks.
+  open-step         Open a STEP model to execute STEP-related tasks outside of a library.
 
 List command-specific options:
   {executable} <command> --help
@@ -0,0 +1,140 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/3d/meshcache.h>
+#include <librepcb/core/fileio/fileutils.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class MeshCacheTest : public ::testing::Test {
+protected:
+  FilePath mTmpDir;
+
+  MeshCacheTest() : mTmpDir(FilePath::getRandomTempPath()) {}
+
+  virtual ~MeshCacheTest() { QDir(mTmpDir.toStr()).removeRecursively(); }
+
+  static MeshCache::Mesh createMesh() {
+    MeshCache::Mesh mesh;
+    mesh.insert(std::make_tuple(0.1, 0.2, 0.3),
+                {QVector3D(1, 2, 3), QVector3D(4, 5, 6), QVector3D(7, 8, 9)});
+    mesh.insert(std::make_tuple(1.0, 1.0, 1.0), {});
+    return mesh;
+  }
+
+  void setFileAge(const QByteArray& key, int days) {
+    QFile file(mTmpDir.getPathTo(QString::fromLatin1(key) + ".mesh").toStr());
+    ASSERT_TRUE(file.open(QIODevice::ReadWrite));
+    ASSERT_TRUE(
+        file.setFileTime(QDateTime::currentDateTimeUtc().addDays(-days),
+                         QFileDevice::FileModificationTime));
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(MeshCacheTest, testCalcKey) {
+  EXPECT_EQ(MeshCache::calcKey("foo"), MeshCache::calcKey("foo"));
+  EXPECT_NE(MeshCache::calcKey("foo"), MeshCache::calcKey("bar"));
+  // Tesselation parameters must be part of the key.
+  EXPECT_NE(QCryptographicHash::hash("foo", QCryptographicHash::Sha256).toHex(),
+            MeshCache::calcKey("foo"));
+}
+
+TEST_F(MeshCacheTest, testSerializeEmpty) {
+  const QByteArray data = MeshCache::serialize(MeshCache::Mesh());
+  tl::optional<MeshCache::Mesh> mesh =
+      MeshCache::deserialize(data.constData(), data.size());
+  ASSERT_TRUE(mesh.has_value());
+  EXPECT_TRUE(mesh->isEmpty());
+}
+
+TEST_F(MeshCacheTest, testSerialize) {
+  const QByteArray data = MeshCache::serialize(createMesh());
+  tl::optional<MeshCache::Mesh> mesh =
+      MeshCache::deserialize(data.constData(), data.size());
+  ASSERT_TRUE(mesh.has_value());
+  EXPECT_TRUE(*mesh == createMesh());
+}
+
+TEST_F(MeshCacheTest, testStoreRemovesLeastRecentlyUsed) {
+  const QByteArray key1 = MeshCache::calcKey("1");
+  const QByteArray key2 = MeshCache::calcKey("2");
+  const QByteArray key3 = MeshCache::calcKey("3");
+  MeshCache cache(mTmpDir, MeshCache::serialize(createMesh()).size() * 2);
+  cache.store(key1, createMesh());
+  setFileAge(key1, 3);
+  cache.store(key2, createMesh());
+  setFileAge(key2, 2);
+  EXPECT_TRUE(cache.load(key1).has_value());  // Marks key1 as used.
+  cache.store(key3, createMesh());
+  EXPECT_TRUE(cache.load(key1).has_value());
+  EXPECT_FALSE(cache.load(key2).has_value());
+  EXPECT_TRUE(cache.load(key3).has_value());
+}
+
+TEST_F(MeshCacheTest, testDeserializeTruncated) {
+  const QByteArray data = MeshCache::serialize(createMesh());
+  for (int i = 0; i < data.size(); ++i) {
+    EXPECT_FALSE(MeshCache::deserialize(data.constData(), i).has_value());
+  }
+}
+
+TEST_F(MeshCacheTest, testDeserializeInvalid) {
+  const QByteArray data = "Hello World! This is not a mesh.";
+  EXPECT_FALSE(
+      MeshCache::deserialize(data.constData(), data.size()).has_value());
+}
+
+TEST_F(MeshCacheTest, testLoadNonExisting) {
+  MeshCache cache(mTmpDir);
+  EXPECT_FALSE(cache.load(MeshCache::calcKey("foo")).has_value());
+}
+
+TEST_F(MeshCacheTest, testStoreAndLoad) {
+  const QByteArray key = MeshCache::calcKey("foo");
+  MeshCache cache(mTmpDir);
+  cache.store(key, createMesh());
+  tl::optional<MeshCache::Mesh> mesh = cache.load(key);
+  ASSERT_TRUE(mesh.has_value());
+  EXPECT_TRUE(*mesh == createMesh());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -72,6 +72,24 @@ TEST_P(AttributeSubstitutorTest, testData) {
       << "Actual value: '" << qPrintable(output) << "'";
 }
 
+TEST_P(AttributeSubstitutorTest, testDataRepeated) {
+  const AttributeSubstitutorTestData& data = GetParam();
+
+  // Substituting the same text again must lead to the same result (templates
+  // are cached internally).
+  AttributeSubstitutor::substitute(data.input, &lookup);
+  QString output = AttributeSubstitutor::substitute(data.input, &lookup);
+  EXPECT_EQ(data.output, output)
+      << "Actual value: '" << qPrintable(output) << "'";
+}
+
+TEST(AttributeSubstitutorFilterTest, testFilterAppliedToOuterValuesOnly) {
+  auto filter = [](const QString& str) { return "<" + str.toUpper() + ">"; };
+  QString output = AttributeSubstitutor::substitute(
+      "a {{KEY_4}} b {{NONEXISTENT}} {{'c'}}", &lookup, filter);
+  EXPECT_EQ("a <RECURSIVE NORMAL VALUE VALUE> b <> <C>", output.toStdString());
+}
+
 /*******************************************************************************
  *  Test Data
  ******************************************************************************/
@@ -295,6 +295,69 @@ TEST_F(GraphicsExportTest, testExportPdfWithAutoScaling) {
   EXPECT_TRUE(outFile.isExistingFile());
 }
 
+TEST_F(GraphicsExportTest, testExportReusesRecordings) {
+  // Use unique page sizes to not get recordings cached by other tests.
+  auto createPage = [](const Length& x) {
+    return std::make_shared<GraphicsPagePainterMock>(
+        x, Length(0), Length(123456789), Length(98765432));
+  };
+  std::shared_ptr<GraphicsPagePainterMock> page1 = createPage(Length(0));
+  std::shared_ptr<GraphicsPagePainterMock> page2 = createPage(Length(1000));
+  std::shared_ptr<GraphicsExportSettings> settings =
+      std::make_shared<GraphicsExportSettings>();
+  GraphicsExport::Pages pages = {
+      std::make_pair(page1, settings),
+      std::make_pair(page2, settings),
+  };
+
+  // Each page is painted only once.
+  GraphicsExport e1;
+  e1.startExport(pages, getFilePath("out1.pdf"));
+  EXPECT_EQ("", e1.waitForFinished().errorMsg.toStdString());
+  EXPECT_EQ(1, page1->getPaintCount());
+  EXPECT_EQ(1, page2->getPaintCount());
+
+  // Unmodified pages are not painted again, even with equal settings.
+  GraphicsExport e2;
+  pages[1].second = std::make_shared<GraphicsExportSettings>(*settings);
+  e2.startExport(pages, getFilePath("out2.pdf"));
+  EXPECT_EQ("", e2.waitForFinished().errorMsg.toStdString());
+  EXPECT_EQ(1, page1->getPaintCount());
+  EXPECT_EQ(1, page2->getPaintCount());
+  EXPECT_TRUE(getFilePath("out2.pdf").isExistingFile());
+
+  // Pages with modified settings are painted again.
+  pages[1].second->setMirror(!pages[1].second->getMirror());
+  e2.startExport(pages, getFilePath("out3.pdf"));
+  EXPECT_EQ("", e2.waitForFinished().errorMsg.toStdString());
+  EXPECT_EQ(1, page1->getPaintCount());
+  EXPECT_EQ(2, page2->getPaintCount());
+}
+
+TEST_F(GraphicsExportTest, testExportReusesRecordingsOfNewPainters) {
+  // Output jobs create new painter objects for every run, so the cache
+  // must be hit by page content, not by painter identity.
+  auto createPage = []() {
+    return std::make_shared<GraphicsPagePainterMock>(
+        Length(0), Length(0), Length(87654321), Length(12345678));
+  };
+  std::shared_ptr<GraphicsExportSettings> settings =
+      std::make_shared<GraphicsExportSettings>();
+
+  std::shared_ptr<GraphicsPagePainterMock> page1 = createPage();
+  GraphicsExport e1;
+  e1.startExport({std::make_pair(page1, settings)}, getFilePath("out1.pdf"));
+  EXPECT_EQ("", e1.waitForFinished().errorMsg.toStdString());
+  EXPECT_EQ(1, page1->getPaintCount());
+
+  std::shared_ptr<GraphicsPagePainterMock> page2 = createPage();
+  GraphicsExport e2;
+  e2.startExport({std::make_pair(page2, settings)}, getFilePath("out2.pdf"));
+  EXPECT_EQ("", e2.waitForFinished().errorMsg.toStdString());
+  EXPECT_EQ(0, page2->getPaintCount());
+  EXPECT_TRUE(getFilePath("out2.pdf").isExistingFile());
+}
+
 TEST_F(GraphicsExportTest, testGetSupportedExtensions) {
   // Note that the result is platform dependent, thus only checking the
   // most important extensions.
@@ -28,6 +28,8 @@
 
 #include <QtCore>
 
+#include <atomic>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -42,19 +44,30 @@ class GraphicsPagePainterMock : public GraphicsPagePainter {
   Point mPos;
   Length mWidth;
   Length mHeight;
+  mutable std::atomic<int> mPaintCount;
 
 public:
   GraphicsPagePainterMock(const Length& x = Length(0),
                           const Length& y = Length(),
                           const Length& width = Length(200000000),
                           const Length& height = Length(100000000)) noexcept
-    : mPos(x, y), mWidth(width), mHeight(height) {}
+    : mPos(x, y), mWidth(width), mHeight(height), mPaintCount(0) {}
 
   virtual ~GraphicsPagePainterMock() noexcept {}
 
+  int getPaintCount() const noexcept { return mPaintCount; }
+
+  QByteArray getContentHash() const noexcept override {
+    return QString("%1 %2 %3 %4")
+        .arg(mPos.getX().toNmString(), mPos.getY().toNmString(),
+             mWidth.toNmString(), mHeight.toNmString())
+        .toUtf8();
+  }
+
   void paint(QPainter& painter,
              const GraphicsExportSettings& settings) const noexcept override {
     Q_UNUSED(settings);
+    ++mPaintCount;
 
     Point topLeft(mPos.getX() - mWidth / 2, mPos.getY() + mHeight / 2);
     Point bottomRight(mPos.getX() + mWidth / 2, mPos.getY() - mHeight / 2);
@@ -552,6 +552,115 @@ TEST_F(TransactionalFileSystemTest, testRestoreAutosave) {
   EXPECT_EQ("new file", FileUtils::readFile(fs2.getAbsPath(".dot/file.txt")));
 }
 
+TEST_F(TransactionalFileSystemTest, testAutosaveWritesOnlyModifiedFiles) {
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  fs.write("a.txt", "a");
+  fs.write("b.txt", "b");
+  fs.autosave();
+
+  // Find the files written by the autosave.
+  const FilePath autosaveDir = mPopulatedDir.getPathTo(".autosave");
+  const QStringList dirs =
+      QDir(autosaveDir.toStr()).entryList(QDir::Dirs | QDir::NoDotAndDotDot);
+  ASSERT_EQ(1, dirs.count());
+  const FilePath filesDir = autosaveDir.getPathTo(dirs.first());
+  EXPECT_EQ("a", FileUtils::readFile(filesDir.getPathTo("a.txt")));
+  EXPECT_EQ("b", FileUtils::readFile(filesDir.getPathTo("b.txt")));
+
+  // Modify the autosaved file on disk to detect whether it is written again.
+  FileUtils::writeFile(filesDir.getPathTo("b.txt"), "untouched");
+
+  // Writing the same content again must not mark the file as modified.
+  fs.write("a.txt", "new a");
+  fs.write("b.txt", "b");
+  fs.autosave();
+  EXPECT_EQ(dirs, QDir(autosaveDir.toStr())
+                      .entryList(QDir::Dirs | QDir::NoDotAndDotDot));
+  EXPECT_EQ("new a", FileUtils::readFile(filesDir.getPathTo("a.txt")));
+  EXPECT_EQ("untouched", FileUtils::readFile(filesDir.getPathTo("b.txt")));
+}
+
+TEST_F(TransactionalFileSystemTest, testAutosaveWithOverlay) {
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  fs.write("a.txt", "a");
+  fs.autosave({{"a.txt", "overlay a"}, {"/b.txt", "overlay b"}});
+
+  // The overlay must not be stored in the file system itself.
+  EXPECT_EQ("a", fs.read("a.txt"));
+  EXPECT_FALSE(fs.fileExists("b.txt"));
+
+  // Find the files written by the autosave.
+  const FilePath autosaveDir = mPopulatedDir.getPathTo(".autosave");
+  const QStringList dirs =
+      QDir(autosaveDir.toStr()).entryList(QDir::Dirs | QDir::NoDotAndDotDot);
+  ASSERT_EQ(1, dirs.count());
+  const FilePath filesDir = autosaveDir.getPathTo(dirs.first());
+  EXPECT_EQ("overlay a", FileUtils::readFile(filesDir.getPathTo("a.txt")));
+  EXPECT_EQ("overlay b", FileUtils::readFile(filesDir.getPathTo("b.txt")));
+
+  // Modify the autosaved file on disk to detect whether it is written again.
+  FileUtils::writeFile(filesDir.getPathTo("b.txt"), "untouched");
+
+  // An unmodified overlay file must not be written again, and a file which is
+  // no longer overlaid must be written with the file system content.
+  fs.autosave({{"b.txt", "overlay b"}});
+  EXPECT_EQ("a", FileUtils::readFile(filesDir.getPathTo("a.txt")));
+  EXPECT_EQ("untouched", FileUtils::readFile(filesDir.getPathTo("b.txt")));
+
+  // remove lock because we can't get a stale lock without crashing the app
+  FileUtils::removeFile(mPopulatedDir.getPathTo(".lock"));
+
+  // open another file system on the same directory to restore the autosave
+  TransactionalFileSystem fs2(mPopulatedDir, true,
+                              &TransactionalFileSystem::RestoreMode::yes);
+  EXPECT_TRUE(fs2.isRestoredFromAutosave());
+  EXPECT_EQ("a", fs2.read("a.txt"));
+  EXPECT_EQ("untouched", fs2.read("b.txt"));
+}
+
+TEST_F(TransactionalFileSystemTest, testRestoreMultipleAutosaves) {
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  fs.write("x.txt", "x");
+  fs.autosave();
+  fs.write("y.txt", "y");
+  fs.autosave();
+  fs.write("y.txt", "new y");
+  fs.removeFile("x.txt");
+  fs.removeFile("1.txt");
+  fs.autosave();
+
+  // remove lock because we can't get a stale lock without crashing the app
+  FileUtils::removeFile(mPopulatedDir.getPathTo(".lock"));
+
+  // open another file system on the same directory to restore the autosave
+  TransactionalFileSystem fs2(mPopulatedDir, true,
+                              &TransactionalFileSystem::RestoreMode::yes);
+  EXPECT_TRUE(fs2.isRestoredFromAutosave());
+  EXPECT_FALSE(fs2.fileExists("x.txt"));
+  EXPECT_FALSE(fs2.fileExists("1.txt"));
+  EXPECT_EQ("new y", fs2.read("y.txt"));
+  EXPECT_EQ("2", fs2.read("2.txt"));
+}
+
+TEST_F(TransactionalFileSystemTest, testAutosaveAfterSave) {
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  fs.write("x.txt", "x");
+  fs.autosave();
+  fs.save();
+  fs.write("y.txt", "y");
+  fs.autosave();
+
+  // remove lock because we can't get a stale lock without crashing the app
+  FileUtils::removeFile(mPopulatedDir.getPathTo(".lock"));
+
+  // open another file system on the same directory to restore the autosave
+  TransactionalFileSystem fs2(mPopulatedDir, true,
+                              &TransactionalFileSystem::RestoreMode::yes);
+  EXPECT_TRUE(fs2.isRestoredFromAutosave());
+  EXPECT_EQ("x", fs2.read("x.txt"));
+  EXPECT_EQ("y", fs2.read("y.txt"));
+}
+
 TEST_F(TransactionalFileSystemTest, testRestoredBackupAfterFailedSave) {
   FilePath backupDir = mPopulatedDir.getPathTo(".backup");
 
@@ -766,6 +875,34 @@ TEST_F(TransactionalFileSystemTest, testReleaseLock) {
   EXPECT_THROW(fs.save(), Exception);  // Failed because it's read-only.
 }
 
+TEST_F(TransactionalFileSystemTest, testOpenMapped) {
+  const QByteArray largeContent(1024 * 1024, 'x');
+  FileUtils::writeFile(mPopulatedDir.getPathTo("large.txt"), largeContent);
+
+  std::shared_ptr<TransactionalFileSystem> fs =
+      TransactionalFileSystem::openMapped(mPopulatedDir);
+  EXPECT_TRUE(fs->isMemoryMapped());
+  EXPECT_FALSE(fs->isWritable());
+  EXPECT_EQ(largeContent, fs->read("large.txt"));
+  EXPECT_EQ(largeContent, fs->read("large.txt"));  // Already mapped.
+  EXPECT_EQ("1a", fs->read("1/1a.txt"));  // Small file, not mapped.
+  EXPECT_TRUE(fs->readIfExists("nonexisting.txt").isNull());
+
+  // Modifications are kept in memory, but can't be saved.
+  fs->write("large.txt", "modified");
+  EXPECT_EQ("modified", fs->read("large.txt"));
+  EXPECT_THROW(fs->save(), Exception);
+  EXPECT_EQ(largeContent,
+            FileUtils::readFile(mPopulatedDir.getPathTo("large.txt")));
+
+  // Detached copies of mapped content outlive the file system.
+  fs->discardChanges();
+  QByteArray copy = fs->read("large.txt");
+  copy.detach();
+  fs.reset();
+  EXPECT_EQ(largeContent, copy);
+}
+
 /*******************************************************************************
  *  Parametrized getSubDirs() Tests
  ******************************************************************************/
@@ -0,0 +1,92 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/geometry/padgeometry.h>
+#include <librepcb/core/utils/clipperhelpers.h>
+#include <librepcb/core/utils/transform.h>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class PadGeometryTest : public ::testing::Test {};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(PadGeometryTest, testToClipperOutlines) {
+  const PadGeometry geometry = PadGeometry::roundedRect(
+      PositiveLength(2000000), PositiveLength(1000000),
+      UnsignedLimitedRatio(Ratio::fromPercent(50)), PadHoleList{});
+  const Transform transform(Point(100000, 200000), Angle::deg90(), true);
+  const Length offset(50000);
+  const PositiveLength tolerance(5000);
+
+  const ClipperLib::Paths expected = ClipperHelpers::convert(
+      transform.map(geometry.withOffset(offset).toOutlines()), tolerance);
+  const auto outlines =
+      geometry.toClipperOutlines(transform, offset, tolerance);
+  EXPECT_EQ(expected, outlines->paths);
+  EXPECT_EQ(-450000, outlines->boundingBox.left);
+  EXPECT_EQ(-850000, outlines->boundingBox.top);
+  EXPECT_EQ(650000, outlines->boundingBox.right);
+  EXPECT_EQ(1250000, outlines->boundingBox.bottom);
+}
+
+TEST_F(PadGeometryTest, testToClipperOutlinesIsCached) {
+  const PadGeometry geometry = PadGeometry::roundedRect(
+      PositiveLength(2000000), PositiveLength(1000000),
+      UnsignedLimitedRatio(Ratio::fromPercent(0)), PadHoleList{});
+  const PadGeometry copy(geometry);
+  const Transform transform(Point(100000, 200000), Angle::deg0(), false);
+  const PositiveLength tolerance(5000);
+
+  const PadGeometry::ClipperCacheStatistics stats1 =
+      PadGeometry::getClipperCacheStatistics();
+  const auto outlines1 =
+      geometry.toClipperOutlines(transform, Length(0), tolerance);
+  const auto outlines2 =
+      copy.toClipperOutlines(transform, Length(0), tolerance);
+  const auto outlines3 =
+      geometry.toClipperOutlines(transform, Length(1), tolerance);
+  const PadGeometry::ClipperCacheStatistics stats2 =
+      PadGeometry::getClipperCacheStatistics();
+  EXPECT_EQ(outlines1.get(), outlines2.get());  // Shared between copies.
+  EXPECT_NE(outlines1.get(), outlines3.get());  // Different offset.
+  EXPECT_EQ(stats1.hits + 1, stats2.hits);
+  EXPECT_EQ(stats1.misses + 2, stats2.misses);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,145 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/exceptions.h>
+#include <librepcb/core/fileio/fileutils.h>
+#include <librepcb/core/library/librarymanifest.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class LibraryManifestTest : public ::testing::Test {
+protected:
+  static QByteArray hash(const QByteArray& content) {
+    return QCryptographicHash::hash(content, QCryptographicHash::Sha256);
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(LibraryManifestTest, testSerializeAndParse) {
+  const LibraryManifest manifest(QHash<QString, QByteArray>{
+      {"library.lp", hash("lib")},
+      {".librepcb-lib", hash("1")},
+      {"sym/foo/symbol.lp", hash("sym")},
+  });
+  const QByteArray content = manifest.serialize();
+  EXPECT_EQ(hash("1").toHex() + "  .librepcb-lib\n" + hash("lib").toHex() +
+                "  library.lp\n" + hash("sym").toHex() +
+                "  sym/foo/symbol.lp\n",
+            content);
+  EXPECT_EQ(manifest, LibraryManifest::parse(content));
+}
+
+TEST_F(LibraryManifestTest, testParseBinaryModeAndUncleanPaths) {
+  const QByteArray content = "\n" + hash("a").toHex().toUpper() +
+      " *./sym/foo//symbol.lp\r\n" + hash("b").toHex() + "  library.lp\n";
+  const LibraryManifest manifest = LibraryManifest::parse(content);
+  EXPECT_EQ((QHash<QString, QByteArray>{{"sym/foo/symbol.lp", hash("a")},
+                                        {"library.lp", hash("b")}}),
+            manifest.getFiles());
+}
+
+TEST_F(LibraryManifestTest, testParseInvalid) {
+  const QByteArray h = hash("").toHex();
+  EXPECT_THROW(LibraryManifest::parse("foo  bar\n"), Exception);
+  EXPECT_THROW(LibraryManifest::parse(h + "  \n"), Exception);
+  EXPECT_THROW(LibraryManifest::parse(h + "  /etc/passwd\n"), Exception);
+  EXPECT_THROW(LibraryManifest::parse(h + "  ../foo\n"), Exception);
+  EXPECT_THROW(LibraryManifest::parse(h + "  sym/../../foo\n"), Exception);
+  EXPECT_THROW(LibraryManifest::parse(h + "  .\n"), Exception);
+  EXPECT_THROW(LibraryManifest::parse(h + "  a\n" + h + "  ./a\n"), Exception);
+}
+
+TEST_F(LibraryManifestTest, testGetModifiedItems) {
+  const LibraryManifest local(QHash<QString, QByteArray>{
+      {"library.lp", hash("lib")},
+      {"sym/removed/symbol.lp", hash("sym")},
+      {"sym/modified/symbol.lp", hash("old")},
+      {"sym/modified/.librepcb-sym", hash("1")},
+      {"pkg/unmodified/package.lp", hash("pkg")},
+      {"pkg/unmodified/.librepcb-pkg", hash("1")},
+  });
+  const LibraryManifest remote(QHash<QString, QByteArray>{
+      {"library.lp", hash("lib")},
+      {"readme.md", hash("new")},
+      {"sym/modified/symbol.lp", hash("new")},
+      {"sym/modified/.librepcb-sym", hash("1")},
+      {"pkg/unmodified/package.lp", hash("pkg")},
+      {"pkg/unmodified/.librepcb-pkg", hash("1")},
+      {"cmp/added/component.lp", hash("cmp")},
+  });
+  const QSet<QString> items = remote.getModifiedItems(local);
+  EXPECT_EQ((QSet<QString>{"readme.md", "sym/removed", "sym/modified",
+                           "cmp/added"}),
+            items);
+  EXPECT_EQ(items, local.getModifiedItems(remote));
+  EXPECT_EQ((QStringList{"cmp/added/component.lp", "readme.md",
+                         "sym/modified/.librepcb-sym",
+                         "sym/modified/symbol.lp"}),
+            remote.getFilesOfItems(items));
+  EXPECT_TRUE(remote.getModifiedItems(remote).isEmpty());
+}
+
+TEST_F(LibraryManifestTest, testGetItemOfFile) {
+  EXPECT_EQ("library.lp", LibraryManifest::getItemOfFile("library.lp"));
+  EXPECT_EQ("sym/foo", LibraryManifest::getItemOfFile("sym/foo/symbol.lp"));
+  EXPECT_EQ("pkgcat/foo",
+            LibraryManifest::getItemOfFile("pkgcat/foo/sub/file.txt"));
+  EXPECT_EQ("sym/foo", LibraryManifest::getItemOfFile("sym/foo"));
+  EXPECT_EQ("resources/foo/bar.png",
+            LibraryManifest::getItemOfFile("resources/foo/bar.png"));
+}
+
+TEST_F(LibraryManifestTest, testFromDirectory) {
+  const FilePath dir = FilePath::getRandomTempPath();
+  FileUtils::writeFile(dir.getPathTo(".librepcb-lib"), "1");
+  FileUtils::writeFile(dir.getPathTo("sym/foo/symbol.lp"), "sym");
+  const LibraryManifest manifest = LibraryManifest::fromDirectory(dir);
+  EXPECT_EQ((QHash<QString, QByteArray>{{".librepcb-lib", hash("1")},
+                                        {"sym/foo/symbol.lp", hash("sym")}}),
+            manifest.getFiles());
+  EXPECT_TRUE(
+      LibraryManifest::fromDirectory(dir.getPathTo("nonexistent"))
+          .getFiles()
+          .isEmpty());
+  FileUtils::removeDirRecursively(dir);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
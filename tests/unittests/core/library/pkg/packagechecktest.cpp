@@ -0,0 +1,120 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/library/pkg/package.h>
+#include <librepcb/core/library/pkg/packagecheck.h>
+#include <librepcb/core/library/pkg/packagecheckmessages.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class PackageCheckTest : public ::testing::Test {
+protected:
+  struct Check : public PackageCheck {
+    using PackageCheck::findOverlappingRects;
+  };
+
+  static std::shared_ptr<FootprintPad> createPad(const Point& pos) {
+    return std::make_shared<FootprintPad>(
+        Uuid::createRandom(), tl::nullopt, pos, Angle::deg0(),
+        FootprintPad::Shape::RoundedRect, PositiveLength(1000000),
+        PositiveLength(1000000), UnsignedLimitedRatio(Ratio::fromPercent(0)),
+        Path(), MaskConfig::automatic(), MaskConfig::off(), UnsignedLength(0),
+        FootprintPad::ComponentSide::Top, FootprintPad::Function::Unspecified,
+        PadHoleList{});
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(PackageCheckTest, testFindOverlappingRects) {
+  const QVector<QRectF> rects = {
+      QRectF(10, 0, 2, 2),  // Overlaps with #2 and touches #3.
+      QRectF(-5, -5, 1, 1),  // Isolated.
+      QRectF(11, 1, 5, 5),  // Overlaps with #0.
+      QRectF(8, 2, 2, 2),  // Touches #0.
+      QRectF(10, 20, 2, 2),  // Same x range as #0, but far away in y.
+  };
+  const QVector<std::pair<int, int>> expected = {
+      std::make_pair(0, 2),
+      std::make_pair(0, 3),
+  };
+  EXPECT_EQ(expected, Check::findOverlappingRects(rects));
+}
+
+TEST_F(PackageCheckTest, testFindOverlappingRectsEmpty) {
+  EXPECT_TRUE(Check::findOverlappingRects({}).isEmpty());
+}
+
+TEST_F(PackageCheckTest, testPadsClearanceToPads) {
+  Package pkg(Uuid::createRandom(), Version::fromString("1"), "",
+              ElementName("Test"), "", "", Package::AssemblyType::Smt);
+  std::shared_ptr<Footprint> footprint = std::make_shared<Footprint>(
+      Uuid::createRandom(), ElementName("default"), "");
+  pkg.getFootprints().append(footprint);
+
+  // Pads of 1x1mm: a/b overlap, b/c are 0.1mm apart, d is far away.
+  auto a = createPad(Point(0, 0));
+  auto b = createPad(Point(500000, 0));
+  auto c = createPad(Point(1600000, 0));
+  auto d = createPad(Point(0, 10000000));
+  footprint->getPads().append(a);
+  footprint->getPads().append(b);
+  footprint->getPads().append(c);
+  footprint->getPads().append(d);
+
+  QList<std::pair<std::shared_ptr<const FootprintPad>,
+                  std::shared_ptr<const FootprintPad>>>
+      overlaps, violations;
+  foreach (const auto& msg, PackageCheck(pkg).runChecks()) {
+    if (auto m = msg->as<MsgOverlappingPads>()) {
+      overlaps.append(std::make_pair(m->getPad1(), m->getPad2()));
+    } else if (auto m = msg->as<MsgPadClearanceViolation>()) {
+      violations.append(std::make_pair(m->getPad1(), m->getPad2()));
+    }
+  }
+  ASSERT_EQ(1, overlaps.count());
+  EXPECT_EQ(a, overlaps.first().first);
+  EXPECT_EQ(b, overlaps.first().second);
+  ASSERT_EQ(1, violations.count());
+  EXPECT_EQ(b, violations.first().first);
+  EXPECT_EQ(c, violations.first().second);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
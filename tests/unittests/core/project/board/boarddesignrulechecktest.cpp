@@ -76,10 +76,11 @@ TEST(BoardDesignRuleCheckTest, testMessages) {
     const BoardDesignRuleCheck::Result result = drc.waitForFinished();
 
     // Filter messages, get approvals and check uniqueness of their approval.
-    QSet<SExpression> approvals;
+    QSet<RuleCheckApproval> approvals;
     for (const auto& msg : result.messages) {
       // Skip some messages.
-      const QString msgType = msg->getApproval().getChild("@0").getValue();
+      const QString msgType =
+          msg->getApproval().getNode().getChild("@0").getValue();
       if (whitelist.contains(msgType)) {
         if (!whitelist[msgType].contains(*board->getName())) {
           continue;
@@ -90,7 +91,8 @@ TEST(BoardDesignRuleCheckTest, testMessages) {
       if (approvals.contains(msg->getApproval())) {
         std::cout << "  * Ambiguous approval for message '"
                   << msg->getMessage().toStdString() << "':\n"
-                  << msg->getApproval().toByteArray().toStdString() << "\n";
+                  << msg->getApproval().getNode().toByteArray().toStdString()
+                  << "\n";
         ADD_FAILURE();
       }
 
@@ -99,18 +101,19 @@ TEST(BoardDesignRuleCheckTest, testMessages) {
 
     // Build actual approvals.
     std::unique_ptr<SExpression> actual = SExpression::createList("node");
-    foreach (const SExpression& node, Toolbox::sortedQSet(approvals)) {
+    foreach (const RuleCheckApproval& approval,
+             Toolbox::sortedQSet(approvals)) {
       actual->ensureLineBreak();
-      actual->appendChild(node);
+      actual->appendChild(approval.getNode());
     }
     actual->ensureLineBreak();
 
     // Build expected approvals.
     std::unique_ptr<SExpression> expected = SExpression::createList("node");
-    foreach (const SExpression& node,
+    foreach (const RuleCheckApproval& approval,
              Toolbox::sortedQSet(board->getDrcMessageApprovals())) {
       expected->ensureLineBreak();
-      expected->appendChild(node);
+      expected->appendChild(approval.getNode());
     }
     expected->ensureLineBreak();
 
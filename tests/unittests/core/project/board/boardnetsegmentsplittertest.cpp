@@ -0,0 +1,152 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/project/board/boardnetsegmentsplitter.h>
+#include <librepcb/core/types/layer.h>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class BoardNetSegmentSplitterTest : public ::testing::Test {
+protected:
+  static std::shared_ptr<Junction> createJunction() noexcept {
+    return std::make_shared<Junction>(Uuid::createRandom(), Point(0, 0));
+  }
+
+  static std::shared_ptr<Via> createVia() noexcept {
+    return std::make_shared<Via>(Uuid::createRandom(), Layer::topCopper(),
+                                 Layer::botCopper(), Point(0, 0),
+                                 PositiveLength(800000),
+                                 PositiveLength(300000), MaskConfig::off());
+  }
+
+  static std::shared_ptr<Trace> createTrace(const TraceAnchor& start,
+                                            const TraceAnchor& end) noexcept {
+    return std::make_shared<Trace>(Uuid::createRandom(), Layer::topCopper(),
+                                   PositiveLength(100000), start, end);
+  }
+
+  static TraceAnchor anchor(const Junction& junction) noexcept {
+    return TraceAnchor::junction(junction.getUuid());
+  }
+
+  static TraceAnchor anchor(const Via& via) noexcept {
+    return TraceAnchor::via(via.getUuid());
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(BoardNetSegmentSplitterTest, testEmpty) {
+  BoardNetSegmentSplitter splitter;
+  EXPECT_EQ(0, splitter.split().count());
+}
+
+TEST_F(BoardNetSegmentSplitterTest, testSegmentsAndItemOrder) {
+  QVector<std::shared_ptr<Junction>> j;
+  for (int i = 0; i < 6; ++i) {
+    j.append(createJunction());
+  }
+  QVector<std::shared_ptr<Via>> v{createVia(), createVia()};
+
+  // Segment 1: J0-J1, J3-J4, J1-J3, J1-J2 (visited depth-first from J0).
+  // Segment 2: V0-J5.
+  // Segment 3: V1 (not connected to any trace).
+  QVector<std::shared_ptr<Trace>> t{
+      createTrace(anchor(*j[0]), anchor(*j[1])),
+      createTrace(anchor(*j[3]), anchor(*j[4])),
+      createTrace(anchor(*v[0]), anchor(*j[5])),
+      createTrace(anchor(*j[1]), anchor(*j[3])),
+      createTrace(anchor(*j[1]), anchor(*j[2])),
+  };
+
+  BoardNetSegmentSplitter splitter;
+  for (int i : {5, 4, 3, 2, 1, 0}) {
+    splitter.addJunction(*j[i]);
+  }
+  for (const auto& via : v) {
+    splitter.addVia(*via, false);
+  }
+  for (const auto& trace : t) {
+    splitter.addTrace(*trace);
+  }
+  const QList<BoardNetSegmentSplitter::Segment> segments = splitter.split();
+  ASSERT_EQ(3, segments.count());
+
+  EXPECT_EQ((std::vector<Uuid>{j[0]->getUuid(), j[1]->getUuid(),
+                               j[2]->getUuid(), j[3]->getUuid(),
+                               j[4]->getUuid()}),
+            segments[0].junctions.getUuids());
+  EXPECT_EQ(0, segments[0].vias.count());
+  EXPECT_EQ((std::vector<Uuid>{t[0]->getUuid(), t[3]->getUuid(),
+                               t[4]->getUuid(), t[1]->getUuid()}),
+            segments[0].traces.getUuids());
+
+  EXPECT_EQ((std::vector<Uuid>{j[5]->getUuid()}),
+            segments[1].junctions.getUuids());
+  EXPECT_EQ((std::vector<Uuid>{v[0]->getUuid()}), segments[1].vias.getUuids());
+  EXPECT_EQ((std::vector<Uuid>{t[2]->getUuid()}),
+            segments[1].traces.getUuids());
+
+  EXPECT_EQ(0, segments[2].junctions.count());
+  EXPECT_EQ((std::vector<Uuid>{v[1]->getUuid()}), segments[2].vias.getUuids());
+  EXPECT_EQ(0, segments[2].traces.count());
+}
+
+TEST_F(BoardNetSegmentSplitterTest, testLongChainDoesNotRecurse) {
+  // A recursive implementation would overflow the stack with this.
+  const int count = 100000;
+  BoardNetSegmentSplitter splitter;
+  std::shared_ptr<Junction> previous = createJunction();
+  splitter.addJunction(*previous);
+  std::vector<Uuid> traces;
+  for (int i = 0; i < count; ++i) {
+    std::shared_ptr<Junction> next = createJunction();
+    std::shared_ptr<Trace> trace =
+        createTrace(anchor(*previous), anchor(*next));
+    splitter.addJunction(*next);
+    splitter.addTrace(*trace);
+    traces.push_back(trace->getUuid());
+    previous = next;
+  }
+  const QList<BoardNetSegmentSplitter::Segment> segments = splitter.split();
+  ASSERT_EQ(1, segments.count());
+  EXPECT_EQ(count + 1, segments[0].junctions.count());
+  EXPECT_EQ(traces, segments[0].traces.getUuids());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
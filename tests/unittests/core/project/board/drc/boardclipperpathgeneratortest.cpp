@@ -0,0 +1,239 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/project/board/drc/boardclipperpathgenerator.h>
+#include <librepcb/core/types/layer.h>
+#include <librepcb/core/utils/clipperhelpers.h>
+
+#include <QtCore>
+
+#include <cmath>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+/**
+ * Compares BoardClipperPathGenerator against the previous implementation,
+ * which united each added area immediately with all the areas added before.
+ */
+class BoardClipperPathGeneratorTest : public ::testing::Test {
+protected:
+  using Data = BoardDesignRuleCheckData;
+
+  struct Reference {
+    PositiveLength maxArcTolerance;
+    ClipperLib::Paths paths;
+
+    void unite(const ClipperLib::Paths& area,
+               ClipperLib::PolyFillType fillType) {
+      ClipperHelpers::unite(paths, area, ClipperLib::pftEvenOdd, fillType);
+    }
+    void addVia(const Data::Via& via) {
+      unite({ClipperHelpers::convert(
+                Path::circle(via.size).translated(via.position),
+                maxArcTolerance)},
+            ClipperLib::pftEvenOdd);
+    }
+    void addTrace(const Data::Trace& trace) {
+      unite({ClipperHelpers::convert(
+                Path::obround(trace.startPosition, trace.endPosition,
+                              trace.width),
+                maxArcTolerance)},
+            ClipperLib::pftEvenOdd);
+    }
+    void addPolygon(const Path& path, const PositiveLength& lineWidth,
+                    bool filled) {
+      unite(ClipperHelpers::convert(path.toOutlineStrokes(lineWidth),
+                                    maxArcTolerance),
+            ClipperLib::pftNonZero);
+      if (filled) {
+        unite({ClipperHelpers::convert(path, maxArcTolerance)},
+              ClipperLib::pftEvenOdd);
+      }
+    }
+  };
+
+  static Data::Via createVia(const Point& pos, const PositiveLength& size) {
+    return Data::Via{Uuid::createRandom(),
+                     pos,
+                     size,
+                     PositiveLength(300000),
+                     &Layer::topCopper(),
+                     &Layer::botCopper(),
+                     tl::nullopt,
+                     false,
+                     false,
+                     tl::nullopt,
+                     tl::nullopt};
+  }
+
+  static Data::Trace createTrace(const Point& start, const Point& end,
+                                 const PositiveLength& width) {
+    return Data::Trace{Uuid::createRandom(), start, end, width,
+                       &Layer::topCopper()};
+  }
+
+  static qreal calcArea(const ClipperLib::Paths& paths) {
+    qreal area = 0;
+    for (const ClipperLib::Path& path : paths) {
+      area += ClipperLib::Area(path);
+    }
+    return area;
+  }
+
+  static qreal calcPerimeter(const ClipperLib::Paths& paths) {
+    qreal perimeter = 0;
+    for (const ClipperLib::Path& path : paths) {
+      for (std::size_t i = 0; i < path.size(); ++i) {
+        const ClipperLib::IntPoint& p1 = path.at(i);
+        const ClipperLib::IntPoint& p2 = path.at((i + 1) % path.size());
+        perimeter += std::hypot(qreal(p2.X - p1.X), qreal(p2.Y - p1.Y));
+      }
+    }
+    return perimeter;
+  }
+
+  static qreal calcXorArea(const ClipperLib::Paths& a,
+                           const ClipperLib::Paths& b) {
+    ClipperLib::Clipper c;
+    c.AddPaths(a, ClipperLib::ptSubject, true);
+    c.AddPaths(b, ClipperLib::ptClip, true);
+    ClipperLib::Paths result;
+    c.Execute(ClipperLib::ctXor, result, ClipperLib::pftNonZero,
+              ClipperLib::pftNonZero);
+    return std::abs(calcArea(result));
+  }
+
+  // The documented tolerance: Each vertex may only be moved by Clipper's
+  // integer rounding (1nm), so the areas may differ by at most the perimeter
+  // times 1nm.
+  static void expectEquivalent(const ClipperLib::Paths& expected,
+                               const ClipperLib::Paths& actual) {
+    const qreal tolerance = calcPerimeter(expected) * 1;
+    EXPECT_GT(calcArea(expected), 0);
+    EXPECT_NEAR(calcArea(expected), calcArea(actual), tolerance);
+    EXPECT_LE(calcXorArea(expected, actual), tolerance);
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(BoardClipperPathGeneratorTest, testEmpty) {
+  BoardClipperPathGenerator gen(PositiveLength(5000));
+  EXPECT_TRUE(gen.getPaths().empty());
+}
+
+TEST_F(BoardClipperPathGeneratorTest, testSingleArea) {
+  const PositiveLength tolerance(5000);
+  const Data::Via via =
+      createVia(Point(1000000, 2000000), PositiveLength(800000));
+  Reference ref{tolerance, {}};
+  ref.addVia(via);
+  BoardClipperPathGenerator gen(tolerance);
+  gen.addVia(via);
+  ClipperLib::Paths paths;
+  gen.takePathsTo(paths);
+  expectEquivalent(ref.paths, paths);
+  EXPECT_TRUE(gen.getPaths().empty());
+}
+
+TEST_F(BoardClipperPathGeneratorTest, testAreaEquivalentToIncrementalUnion) {
+  const PositiveLength tolerance(5000);
+  Reference ref{tolerance, {}};
+  BoardClipperPathGenerator gen(tolerance);
+
+  // A grid of overlapping traces with vias on some of the crossings, which
+  // results in many holes.
+  const Length pitch(1000000);
+  const int count = 12;
+  for (int i = 0; i < count; ++i) {
+    const Data::Trace horizontal =
+        createTrace(Point(0, pitch * i), Point(pitch * (count - 1), pitch * i),
+                    PositiveLength(250000));
+    const Data::Trace vertical =
+        createTrace(Point(pitch * i, 0), Point(pitch * i, pitch * (count - 1)),
+                    PositiveLength(150000));
+    ref.addTrace(horizontal);
+    ref.addTrace(vertical);
+    gen.addTrace(horizontal);
+    gen.addTrace(vertical);
+    for (int k = i % 2; k < count; k += 2) {
+      const Data::Via via =
+          createVia(Point(pitch * i, pitch * k), PositiveLength(600000));
+      ref.addVia(via);
+      gen.addVia(via);
+    }
+  }
+
+  // Overlapping polygons, one of them with an arc, and one filled polygon
+  // lying in a hole of the trace grid.
+  const Path ring = Path::circle(PositiveLength(7000000))
+                        .translated(Point(pitch * 6, pitch * 6));
+  ref.addPolygon(ring, PositiveLength(400000), false);
+  gen.addPolygon(ring, UnsignedLength(400000), false);
+  const Path rect =
+      Path::rect(Point(pitch * -2, pitch * -2), Point(pitch * 3, pitch * 3));
+  ref.addPolygon(rect, PositiveLength(200000), false);
+  gen.addPolygon(rect, UnsignedLength(200000), false);
+  const Path filled = Path::centeredRect(PositiveLength(400000),
+                                         PositiveLength(400000))
+                          .translated(Point(pitch / 2, pitch / 2));
+  ref.addPolygon(filled, PositiveLength(100000), true);
+  gen.addPolygon(filled, UnsignedLength(100000), true);
+
+  expectEquivalent(ref.paths, gen.getPaths());
+}
+
+TEST_F(BoardClipperPathGeneratorTest, testAddAfterGetPaths) {
+  const PositiveLength tolerance(5000);
+  Reference ref{tolerance, {}};
+  BoardClipperPathGenerator gen(tolerance);
+  const Data::Trace trace = createTrace(Point(0, 0), Point(5000000, 0),
+                                        PositiveLength(500000));
+  ref.addTrace(trace);
+  gen.addTrace(trace);
+  expectEquivalent(ref.paths, gen.getPaths());
+
+  // Areas added later must be united with the already united paths.
+  const Data::Via via = createVia(Point(5000000, 0), PositiveLength(1000000));
+  ref.addVia(via);
+  gen.addVia(via);
+  expectEquivalent(ref.paths, gen.getPaths());
+  EXPECT_EQ(std::size_t(1), gen.getPaths().size());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
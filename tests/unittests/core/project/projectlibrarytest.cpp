@@ -26,6 +26,7 @@
 #include <librepcb/core/library/sym/symbol.h>
 #include <librepcb/core/project/projectlibrary.h>
 
+#include <QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -254,6 +255,62 @@ TEST_F(ProjectLibraryTest, testSavingToExistingEmptyDirectory) {
   EXPECT_TRUE(mNewSymbolFile.exists());
 }
 
+TEST_F(ProjectLibraryTest, testAddElementsLazily) {
+  const Uuid uuid = mExistingSymbol->getUuid();
+  mExistingSymbol.reset();  // Not needed, will be loaded from file system.
+  ProjectLibrary lib(std::unique_ptr<TransactionalDirectory>(
+      new TransactionalDirectory(mLibFs)));
+  lib.addElementsLazily();
+  Symbol* sym = lib.getSymbol(uuid);
+  ASSERT_NE(nullptr, sym);
+  EXPECT_EQ("Existing Symbol",
+            sym->getNames().getDefaultValue()->toStdString());
+  EXPECT_EQ(sym, lib.getSymbol(uuid));
+  EXPECT_EQ(nullptr, lib.getSymbol(Uuid::createRandom()));
+  EXPECT_EQ(1, lib.getSymbols().count());
+  EXPECT_EQ(sym, lib.getSymbols().value(uuid));
+  EXPECT_NO_THROW(lib.throwLoadError());
+}
+
+TEST_F(ProjectLibraryTest, testAddElementsLazilyLoadError) {
+  const Uuid uuid = mExistingSymbol->getUuid();
+  mExistingSymbol.reset();  // Not needed, will be loaded from file system.
+  mLibFs->write(QString("sym/%1/symbol.lp").arg(uuid.toStr()), "(broken");
+  mLibFs->save();
+  ProjectLibrary lib(std::unique_ptr<TransactionalDirectory>(
+      new TransactionalDirectory(mLibFs)));
+  lib.addElementsLazily();
+  EXPECT_NO_THROW(lib.throwLoadError());  // Not loaded yet.
+  EXPECT_EQ(nullptr, lib.getSymbol(uuid));
+  EXPECT_THROW(lib.throwLoadError(), Exception);
+  EXPECT_EQ(0, lib.getSymbols().count());
+}
+
+TEST_F(ProjectLibraryTest, testAddElementsLazilyConcurrentAccess) {
+  const Uuid uuid = mExistingSymbol->getUuid();
+  mExistingSymbol.reset();  // Not needed, will be loaded from file system.
+  ProjectLibrary lib(std::unique_ptr<TransactionalDirectory>(
+      new TransactionalDirectory(mLibFs)));
+  lib.addElementsLazily();
+  QVector<QFuture<Symbol*>> futures;
+  for (int i = 0; i < 8; ++i) {
+    futures.append(
+        QtConcurrent::run([&lib, uuid]() { return lib.getSymbol(uuid); }));
+  }
+  Symbol* sym = futures.first().result();
+  ASSERT_NE(nullptr, sym);
+  foreach (const QFuture<Symbol*>& future, futures) {
+    EXPECT_EQ(sym, future.result());
+  }
+}
+
+TEST_F(ProjectLibraryTest, testAddExistingSymbolAfterAddElementsLazily) {
+  ProjectLibrary lib(std::unique_ptr<TransactionalDirectory>(
+      new TransactionalDirectory(mLibFs)));
+  lib.addElementsLazily();
+  EXPECT_THROW(lib.addSymbol(*mExistingSymbol), Exception);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -0,0 +1,133 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/project/schematic/schematicnetsegmentsplitter.h>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class SchematicNetSegmentSplitterTest : public ::testing::Test {
+protected:
+  static std::shared_ptr<Junction> createJunction() noexcept {
+    return std::make_shared<Junction>(Uuid::createRandom(), Point(0, 0));
+  }
+
+  static std::shared_ptr<NetLine> createNetLine(
+      const NetLineAnchor& start, const NetLineAnchor& end) noexcept {
+    return std::make_shared<NetLine>(Uuid::createRandom(), UnsignedLength(0),
+                                     start, end);
+  }
+
+  static NetLineAnchor anchor(const Junction& junction) noexcept {
+    return NetLineAnchor::junction(junction.getUuid());
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(SchematicNetSegmentSplitterTest, testEmpty) {
+  SchematicNetSegmentSplitter splitter;
+  EXPECT_EQ(0, splitter.split().count());
+}
+
+TEST_F(SchematicNetSegmentSplitterTest, testSegmentsAndItemOrder) {
+  QVector<std::shared_ptr<Junction>> j;
+  for (int i = 0; i < 6; ++i) {
+    j.append(createJunction());
+  }
+  const NetLineAnchor pin =
+      NetLineAnchor::pin(Uuid::createRandom(), Uuid::createRandom());
+
+  // Segment 1: J0-J1, J3-J4, J1-J3, J1-J2 (visited depth-first from J0).
+  // Segment 2: Pin-J5.
+  QVector<std::shared_ptr<NetLine>> l{
+      createNetLine(anchor(*j[0]), anchor(*j[1])),
+      createNetLine(anchor(*j[3]), anchor(*j[4])),
+      createNetLine(pin, anchor(*j[5])),
+      createNetLine(anchor(*j[1]), anchor(*j[3])),
+      createNetLine(anchor(*j[1]), anchor(*j[2])),
+  };
+
+  SchematicNetSegmentSplitter splitter;
+  for (int i : {5, 4, 3, 2, 1, 0}) {
+    splitter.addJunction(*j[i]);
+  }
+  for (const auto& netline : l) {
+    splitter.addNetLine(*netline);
+  }
+  const QList<SchematicNetSegmentSplitter::Segment> segments =
+      splitter.split();
+  ASSERT_EQ(2, segments.count());
+
+  EXPECT_EQ((std::vector<Uuid>{j[0]->getUuid(), j[1]->getUuid(),
+                               j[2]->getUuid(), j[3]->getUuid(),
+                               j[4]->getUuid()}),
+            segments[0].junctions.getUuids());
+  EXPECT_EQ((std::vector<Uuid>{l[0]->getUuid(), l[3]->getUuid(),
+                               l[4]->getUuid(), l[1]->getUuid()}),
+            segments[0].netlines.getUuids());
+
+  EXPECT_EQ((std::vector<Uuid>{j[5]->getUuid()}),
+            segments[1].junctions.getUuids());
+  EXPECT_EQ((std::vector<Uuid>{l[2]->getUuid()}),
+            segments[1].netlines.getUuids());
+}
+
+TEST_F(SchematicNetSegmentSplitterTest, testLongChainDoesNotRecurse) {
+  // A recursive implementation would overflow the stack with this.
+  const int count = 100000;
+  SchematicNetSegmentSplitter splitter;
+  std::shared_ptr<Junction> previous = createJunction();
+  splitter.addJunction(*previous);
+  std::vector<Uuid> netlines;
+  for (int i = 0; i < count; ++i) {
+    std::shared_ptr<Junction> next = createJunction();
+    std::shared_ptr<NetLine> netline =
+        createNetLine(anchor(*previous), anchor(*next));
+    splitter.addJunction(*next);
+    splitter.addNetLine(*netline);
+    netlines.push_back(netline->getUuid());
+    previous = next;
+  }
+  const QList<SchematicNetSegmentSplitter::Segment> segments =
+      splitter.split();
+  ASSERT_EQ(1, segments.count());
+  EXPECT_EQ(count + 1, segments[0].junctions.count());
+  EXPECT_EQ(netlines, segments[0].netlines.getUuids());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
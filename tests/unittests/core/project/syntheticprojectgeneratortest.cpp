@@ -0,0 +1,150 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/board/items/bi_device.h>
+#include <librepcb/core/project/board/items/bi_netsegment.h>
+#include <librepcb/core/project/board/items/bi_plane.h>
+#include <librepcb/core/project/circuit/circuit.h>
+#include <librepcb/core/project/project.h>
+#include <librepcb/core/project/projectloader.h>
+#include <librepcb/core/project/syntheticprojectgenerator.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class SyntheticProjectGeneratorTest : public ::testing::Test {
+protected:
+  FilePath mTmpDir;
+
+  SyntheticProjectGeneratorTest() : mTmpDir(FilePath::getRandomTempPath()) {}
+
+  virtual ~SyntheticProjectGeneratorTest() {
+    QDir(mTmpDir.toStr()).removeRecursively();
+  }
+
+  std::unique_ptr<Project> generate(
+      const SyntheticProjectGenerator::Settings& settings,
+      const QString& dirName) {
+    std::shared_ptr<TransactionalFileSystem> fs =
+        TransactionalFileSystem::openRW(mTmpDir.getPathTo(dirName));
+    SyntheticProjectGenerator generator(settings);
+    std::unique_ptr<Project> project = generator.generate(
+        std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(fs)),
+        "project.lpp");
+    project->save();
+    fs->save();
+    return project;
+  }
+
+  static QList<Uuid> getUuids(const Board& board) {
+    return board.getDeviceInstances().keys() + board.getNetSegments().keys() +
+        board.getPlanes().keys();
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(SyntheticProjectGeneratorTest, testCounts) {
+  SyntheticProjectGenerator::Settings settings;
+  settings.deviceCount = 30;
+  settings.padsPerDevice = 6;
+  settings.netCount = 20;
+  settings.traceCount = 50;
+  settings.viaCount = 10;
+  settings.planeCount = 3;
+  settings.copperLayerCount = 6;
+  std::unique_ptr<Project> project = generate(settings, "project");
+
+  ASSERT_EQ(1, project->getBoards().count());
+  const Board& board = *project->getBoards().first();
+  EXPECT_EQ(30, project->getCircuit().getComponentInstances().count());
+  EXPECT_EQ(20, project->getCircuit().getNetSignals().count());
+  EXPECT_EQ(30, board.getDeviceInstances().count());
+  EXPECT_EQ(3, board.getPlanes().count());
+  EXPECT_EQ(6, board.getCopperLayers().count());
+  int traces = 0;
+  int vias = 0;
+  foreach (const BI_NetSegment* segment, board.getNetSegments()) {
+    traces += segment->getNetLines().count();
+    vias += segment->getVias().count();
+  }
+  EXPECT_EQ(50, traces);  // Enough pads available to use all traces.
+  EXPECT_EQ(10, vias);
+  foreach (const BI_Device* device, board.getDeviceInstances()) {
+    EXPECT_EQ(6, device->getPads().count());
+  }
+}
+
+TEST_F(SyntheticProjectGeneratorTest, testDeterministic) {
+  SyntheticProjectGenerator::Settings settings;
+  settings.seed = 42;
+  std::unique_ptr<Project> p1 = generate(settings, "p1");
+  std::unique_ptr<Project> p2 = generate(settings, "p2");
+  settings.seed = 43;
+  std::unique_ptr<Project> p3 = generate(settings, "p3");
+
+  EXPECT_EQ(getUuids(*p1->getBoards().first()),
+            getUuids(*p2->getBoards().first()));
+  EXPECT_NE(getUuids(*p1->getBoards().first()),
+            getUuids(*p3->getBoards().first()));
+}
+
+TEST_F(SyntheticProjectGeneratorTest, testOpenGeneratedProject) {
+  SyntheticProjectGenerator::Settings settings;
+  settings.deviceCount = 10;
+  const int segments = generate(settings, "project")
+                           ->getBoards()
+                           .first()
+                           ->getNetSegments()
+                           .count();
+
+  std::shared_ptr<TransactionalFileSystem> fs =
+      TransactionalFileSystem::openRO(mTmpDir.getPathTo("project"));
+  ProjectLoader loader;
+  std::unique_ptr<Project> project = loader.open(
+      std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(fs)),
+      "project.lpp");
+  ASSERT_EQ(1, project->getBoards().count());
+  EXPECT_EQ(10, project->getBoards().first()->getDeviceInstances().count());
+  EXPECT_EQ(segments, project->getBoards().first()->getNetSegments().count());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,113 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/library/librarybaseelementcheckmessages.h>
+#include <librepcb/core/rulecheck/rulecheckapproval.h>
+#include <librepcb/core/serialization/sexpression.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class RuleCheckApprovalTest : public ::testing::Test {
+protected:
+  static RuleCheckApproval parse(const QString& str) {
+    return RuleCheckApproval(*SExpression::parse(str.toUtf8(), FilePath()));
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(RuleCheckApprovalTest, testEqualNodes) {
+  const RuleCheckApproval a = parse("(approved foo (name \"A\"))");
+  const RuleCheckApproval b = parse("(approved foo (name \"A\"))");
+  EXPECT_TRUE(a == b);
+  EXPECT_FALSE(a != b);
+  EXPECT_EQ(qHash(a), qHash(b));
+  EXPECT_EQ(a.getNode(), b.getNode());
+}
+
+TEST_F(RuleCheckApprovalTest, testDifferentNodes) {
+  const QList<RuleCheckApproval> approvals = {
+      parse("(approved foo)"),
+      parse("(approved bar)"),
+      parse("(approved foo (name \"A\"))"),
+      parse("(approved foo (name \"B\"))"),
+      parse("(approved foo (name A))"),  // Token instead of string.
+      parse("(approved foo (name \"A\") (name \"A\"))"),
+      parse("(approved foo\n (name \"A\")\n)"),  // Line breaks.
+      parse("(approved (foo))"),
+  };
+  for (int i = 0; i < approvals.count(); ++i) {
+    for (int k = 0; k < approvals.count(); ++k) {
+      EXPECT_EQ(i == k, approvals.at(i) == approvals.at(k)) << i << "/" << k;
+    }
+  }
+}
+
+TEST_F(RuleCheckApprovalTest, testOrderIsNodeOrder) {
+  const RuleCheckApproval a = parse("(approved aaa)");
+  const RuleCheckApproval b = parse("(approved bbb)");
+  EXPECT_EQ(a.getNode() < b.getNode(), a < b);
+  EXPECT_EQ(b.getNode() < a.getNode(), b < a);
+}
+
+TEST_F(RuleCheckApprovalTest, testSetOperations) {
+  const QSet<RuleCheckApproval> set1 = {parse("(approved a)"),
+                                        parse("(approved b)")};
+  const QSet<RuleCheckApproval> set2 = {parse("(approved b)"),
+                                        parse("(approved c)")};
+  EXPECT_EQ(QSet<RuleCheckApproval>({parse("(approved a)")}), set1 - set2);
+  EXPECT_EQ(QSet<RuleCheckApproval>({parse("(approved b)")}), set1 & set2);
+  EXPECT_EQ(3, (set1 | set2).count());
+}
+
+TEST_F(RuleCheckApprovalTest, testGetAllApprovalsOfMessages) {
+  const RuleCheckMessageList messages = {
+      std::make_shared<MsgMissingAuthor>(),
+      std::make_shared<MsgMissingAuthor>(),
+      std::make_shared<MsgNameNotTitleCase>(ElementName("foo")),
+  };
+  const QSet<RuleCheckApproval> approvals =
+      RuleCheckMessage::getAllApprovals(messages);
+  EXPECT_EQ(2, approvals.count());
+  EXPECT_TRUE(approvals.contains(messages.at(1)->getApproval()));
+  EXPECT_TRUE(approvals.contains(messages.at(2)->getApproval()));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
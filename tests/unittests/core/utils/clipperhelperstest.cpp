@@ -34,7 +34,17 @@ namespace tests {
  *  Test Class
  ******************************************************************************/
 
-class ClipperHelpersTest : public ::testing::Test {};
+class ClipperHelpersTest : public ::testing::Test {
+protected:
+  static void expectNearlyEqual(const ClipperLib::Path& expected,
+                                const ClipperLib::Path& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_NEAR(expected.at(i).X, actual.at(i).X, 1);
+      EXPECT_NEAR(expected.at(i).Y, actual.at(i).Y, 1);
+    }
+  }
+};
 
 /*******************************************************************************
  *  Test Methods
@@ -59,6 +69,51 @@ TEST_F(ClipperHelpersTest, testConvertPathWithApproximate) {
       outputStr.toStdString());
 }
 
+TEST_F(ClipperHelpersTest, testConvertCircle) {
+  const PositiveLength diameter(1234567);
+  const PositiveLength maxArcTolerance(5000);
+  const Point center1(1000000, -2000000);
+  const Point center2(-3333333, 4444444);
+  const ClipperHelpers::ShapeCacheStatistics before =
+      ClipperHelpers::getShapeCacheStatistics();
+  expectNearlyEqual(
+      ClipperHelpers::convert(Path::circle(diameter).translated(center1),
+                              maxArcTolerance),
+      ClipperHelpers::convertCircle(center1, diameter, maxArcTolerance));
+  expectNearlyEqual(
+      ClipperHelpers::convert(Path::circle(diameter).translated(center2),
+                              maxArcTolerance),
+      ClipperHelpers::convertCircle(center2, diameter, maxArcTolerance));
+  const ClipperHelpers::ShapeCacheStatistics after =
+      ClipperHelpers::getShapeCacheStatistics();
+  EXPECT_EQ(before.misses + 1, after.misses);
+  EXPECT_EQ(before.hits + 1, after.hits);
+}
+
+TEST_F(ClipperHelpersTest, testConvertObround) {
+  const PositiveLength width(250000);
+  const PositiveLength maxArcTolerance(5000);
+  const Point start1(1000000, 2000000);
+  const Point start2(-7654321, 1234567);
+  const Point vector(3000000, -1500000);
+  const ClipperHelpers::ShapeCacheStatistics before =
+      ClipperHelpers::getShapeCacheStatistics();
+  expectNearlyEqual(
+      ClipperHelpers::convert(Path::obround(start1, start1 + vector, width),
+                              maxArcTolerance),
+      ClipperHelpers::convertObround(start1, start1 + vector, width,
+                                     maxArcTolerance));
+  expectNearlyEqual(
+      ClipperHelpers::convert(Path::obround(start2, start2 + vector, width),
+                              maxArcTolerance),
+      ClipperHelpers::convertObround(start2, start2 + vector, width,
+                                     maxArcTolerance));
+  const ClipperHelpers::ShapeCacheStatistics after =
+      ClipperHelpers::getShapeCacheStatistics();
+  EXPECT_EQ(before.misses + 1, after.misses);
+  EXPECT_EQ(before.hits + 1, after.hits);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -0,0 +1,123 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/core/utils/memoryreport.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class MemoryReportTest : public ::testing::Test {};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(MemoryReportTest, testEmpty) {
+  MemoryReport report;
+  EXPECT_EQ(0, report.getEntries().count());
+  EXPECT_EQ(0, report.getTotalBytes());
+  EXPECT_EQ(QStringList(), report.toLines());
+}
+
+TEST_F(MemoryReportTest, testAddAccumulates) {
+  MemoryReport report;
+  report.add("Board/Planes", 100);
+  report.add("Board/Devices", 50, 2);
+  report.add("Board/Planes", 200);
+  ASSERT_EQ(2, report.getEntries().count());
+  EXPECT_EQ("Board/Planes", report.getEntries().at(0).category.toStdString());
+  EXPECT_EQ(300, report.getEntries().at(0).bytes);
+  EXPECT_EQ(2, report.getEntries().at(0).count);
+  EXPECT_EQ(50, report.getEntries().at(1).bytes);
+  EXPECT_EQ(2, report.getEntries().at(1).count);
+}
+
+TEST_F(MemoryReportTest, testGetTotalBytes) {
+  MemoryReport report;
+  report.add("Board", 1);
+  report.add("Board/Planes", 10);
+  report.add("Board/Planes/Fragments", 100);
+  report.add("Boards", 1000);
+  EXPECT_EQ(1111, report.getTotalBytes());
+  EXPECT_EQ(111, report.getTotalBytes("Board"));
+  EXPECT_EQ(110, report.getTotalBytes("Board/Planes"));
+  EXPECT_EQ(1000, report.getTotalBytes("Boards"));
+  EXPECT_EQ(0, report.getTotalBytes("Schematic"));
+}
+
+TEST_F(MemoryReportTest, testToLines) {
+  MemoryReport report;
+  report.add("Library/Symbols", 2048, 4);
+  report.add("Board/Planes", 512);
+  report.add("Library/Devices", 1024, 2);
+  const QStringList expected = {
+      "> Library: 3.0 KiB",  //
+      ">   Symbols: 2.0 KiB (4)",  //
+      ">   Devices: 1.0 KiB (2)",  //
+      "> Board: 512 B",  //
+      ">   Planes: 512 B",  //
+  };
+  EXPECT_EQ(expected.join("\n").toStdString(),
+            report.toLines("> ").join("\n").toStdString());
+}
+
+TEST_F(MemoryReportTest, testFormatBytes) {
+  EXPECT_EQ("0 B", MemoryReport::formatBytes(0).toStdString());
+  EXPECT_EQ("1023 B", MemoryReport::formatBytes(1023).toStdString());
+  EXPECT_EQ("1.0 KiB", MemoryReport::formatBytes(1024).toStdString());
+  EXPECT_EQ("1.5 MiB",
+            MemoryReport::formatBytes(1024 * 1024 * 3 / 2).toStdString());
+  EXPECT_EQ("2.0 GiB",
+            MemoryReport::formatBytes(qint64(2) * 1024 * 1024 * 1024)
+                .toStdString());
+}
+
+TEST_F(MemoryReportTest, testEstimate) {
+  EXPECT_EQ(0, MemoryReport::estimate(QString()));
+  EXPECT_EQ(0, MemoryReport::estimate(QByteArray()));
+  EXPECT_EQ(0, MemoryReport::estimate(QVector<int>()));
+  const QByteArray data(1000, 'x');
+  EXPECT_GE(MemoryReport::estimate(data), 1000);
+  const QString str(1000, 'x');
+  EXPECT_GE(MemoryReport::estimate(str), 2000);
+  QVector<qint64> vector;
+  vector.reserve(100);
+  EXPECT_GE(MemoryReport::estimate(vector), 800);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,142 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/core/fileio/fileutils.h>
+#include <librepcb/core/utils/tracer.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class TracerTest : public ::testing::Test {
+protected:
+  FilePath mTmpDir;
+
+  TracerTest() : mTmpDir(FilePath::getRandomTempPath()) {}
+
+  virtual ~TracerTest() {
+    Tracer::stop();
+    QDir(mTmpDir.toStr()).removeRecursively();
+  }
+
+  QJsonArray readEvents(const FilePath& fp) {
+    const QJsonDocument doc = QJsonDocument::fromJson(FileUtils::readFile(fp));
+    QJsonArray events;
+    foreach (const QJsonValue& value, doc.object()["traceEvents"].toArray()) {
+      if (value.toObject().value("ph").toString() == "X") {
+        events.append(value);
+      }
+    }
+    return events;
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(TracerTest, testDisabledByDefault) {
+  EXPECT_FALSE(Tracer::isEnabled());
+  { LIBREPCB_TRACE_SCOPE("test", "ignored"); }
+  EXPECT_TRUE(Tracer::stop());
+  EXPECT_FALSE(mTmpDir.getPathTo("trace.json").isExistingFile());
+}
+
+TEST_F(TracerTest, testScopesAreWritten) {
+  const FilePath fp = mTmpDir.getPathTo("trace.json");
+  Tracer::start(fp);
+  EXPECT_TRUE(Tracer::isEnabled());
+  {
+    LIBREPCB_TRACE_SCOPE("test", "outer");
+    LIBREPCB_TRACE_SCOPE_DETAIL("test", "inner", QString("foo"));
+  }
+  EXPECT_TRUE(Tracer::stop());
+  EXPECT_FALSE(Tracer::isEnabled());
+
+  const QJsonArray events = readEvents(fp);
+  ASSERT_EQ(2, events.count());
+  // Inner scope is destroyed first.
+  const QJsonObject inner = events.at(0).toObject();
+  const QJsonObject outer = events.at(1).toObject();
+  EXPECT_EQ("inner", inner["name"].toString().toStdString());
+  EXPECT_EQ("test", inner["cat"].toString().toStdString());
+  EXPECT_EQ("foo", inner["args"].toObject()["detail"].toString().toStdString());
+  EXPECT_EQ("outer", outer["name"].toString().toStdString());
+  EXPECT_FALSE(outer.contains("args"));
+  EXPECT_LE(outer["ts"].toDouble(), inner["ts"].toDouble());
+  EXPECT_GE(outer["dur"].toDouble(), inner["dur"].toDouble());
+}
+
+TEST_F(TracerTest, testFunctionName) {
+  const FilePath fp = mTmpDir.getPathTo("trace.json");
+  Tracer::start(fp);
+  { LIBREPCB_TRACE_FUNCTION("test"); }
+  EXPECT_TRUE(Tracer::stop());
+
+  const QJsonArray events = readEvents(fp);
+  ASSERT_EQ(1, events.count());
+  EXPECT_EQ("TestBody",
+            events.at(0).toObject()["name"].toString().toStdString());
+}
+
+TEST_F(TracerTest, testScopeEndingAfterStopIsDiscarded) {
+  const FilePath fp = mTmpDir.getPathTo("trace.json");
+  Tracer::start(fp);
+  {
+    LIBREPCB_TRACE_SCOPE("test", "discarded");
+    EXPECT_TRUE(Tracer::stop());
+  }
+  EXPECT_EQ(0, readEvents(fp).count());
+}
+
+TEST_F(TracerTest, testEventsFromOtherThreads) {
+  const FilePath fp = mTmpDir.getPathTo("trace.json");
+  Tracer::start(fp);
+  std::unique_ptr<QThread> thread(
+      QThread::create([]() { LIBREPCB_TRACE_SCOPE("test", "thread"); }));
+  thread->start();
+  thread->wait();
+  { LIBREPCB_TRACE_SCOPE("test", "main"); }
+  EXPECT_TRUE(Tracer::stop());
+
+  const QJsonArray events = readEvents(fp);
+  ASSERT_EQ(2, events.count());
+  EXPECT_NE(events.at(0).toObject()["tid"].toInt(),
+            events.at(1).toObject()["tid"].toInt());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
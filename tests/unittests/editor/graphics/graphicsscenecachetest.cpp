@@ -0,0 +1,122 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/editor/graphics/graphicsscenecache.h>
+
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace editor {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class GraphicsSceneCacheTest : public ::testing::Test {
+protected:
+  typedef GraphicsSceneCache<QGraphicsScene> Cache;
+
+  static std::unique_ptr<QGraphicsScene> createScene(int items) {
+    std::unique_ptr<QGraphicsScene> scene(new QGraphicsScene());
+    for (int i = 0; i < items; ++i) {
+      scene->addRect(QRectF(i, i, 1, 1));
+    }
+    return scene;
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(GraphicsSceneCacheTest, testTakeReturnsInsertedScene) {
+  const Uuid uuid = Uuid::createRandom();
+  Cache cache(100);
+  std::unique_ptr<QGraphicsScene> scene = createScene(5);
+  QGraphicsScene* ptr = scene.get();
+  cache.insert(uuid, std::move(scene));
+  EXPECT_EQ(1, cache.getCount());
+  EXPECT_EQ(5, cache.getTotalCost());
+  EXPECT_EQ(ptr, cache.take(uuid).get());
+  EXPECT_EQ(0, cache.getCount());
+  EXPECT_EQ(nullptr, cache.take(uuid).get());
+}
+
+TEST_F(GraphicsSceneCacheTest, testLeastRecentlyUsedIsEvicted) {
+  const Uuid uuid1 = Uuid::createRandom();
+  const Uuid uuid2 = Uuid::createRandom();
+  const Uuid uuid3 = Uuid::createRandom();
+  Cache cache(25);
+  cache.insert(uuid1, createScene(10));
+  cache.insert(uuid2, createScene(10));
+  cache.insert(uuid1, cache.take(uuid1));  // Mark as recently used.
+  cache.insert(uuid3, createScene(10));
+  EXPECT_EQ(QList<Uuid>({uuid3, uuid1}), cache.getKeys());
+  EXPECT_EQ(20, cache.getTotalCost());
+}
+
+TEST_F(GraphicsSceneCacheTest, testSceneExceedingBudgetIsNotCached) {
+  const Uuid uuid = Uuid::createRandom();
+  Cache cache(5);
+  cache.insert(uuid, createScene(10));
+  EXPECT_FALSE(cache.contains(uuid));
+  EXPECT_EQ(0, cache.getTotalCost());
+}
+
+TEST_F(GraphicsSceneCacheTest, testReducingBudgetEvictsScenes) {
+  const Uuid uuid1 = Uuid::createRandom();
+  const Uuid uuid2 = Uuid::createRandom();
+  Cache cache(100);
+  cache.insert(uuid1, createScene(10));
+  cache.insert(uuid2, createScene(10));
+  cache.setMaxCost(15);
+  EXPECT_EQ(QList<Uuid>({uuid2}), cache.getKeys());
+  cache.setMaxCost(0);
+  EXPECT_EQ(0, cache.getCount());
+}
+
+TEST_F(GraphicsSceneCacheTest, testRemove) {
+  const Uuid uuid1 = Uuid::createRandom();
+  const Uuid uuid2 = Uuid::createRandom();
+  Cache cache(100);
+  cache.insert(uuid1, createScene(1));
+  cache.insert(uuid2, createScene(2));
+  cache.remove(uuid1);
+  EXPECT_EQ(QList<Uuid>({uuid2}), cache.getKeys());
+  cache.clear();
+  EXPECT_EQ(0, cache.getCount());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace editor
+}  // namespace librepcb
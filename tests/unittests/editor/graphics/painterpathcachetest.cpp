@@ -0,0 +1,78 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/core/geometry/path.h>
+#include <librepcb/editor/graphics/painterpathcache.h>
+
+#include <QtCore>
+#include <QtGui>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace editor {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class PainterPathCacheTest : public ::testing::Test {
+protected:
+  virtual ~PainterPathCacheTest() { PainterPathCache::clear(); }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(PainterPathCacheTest, testSameAsUncached) {
+  const Path path = Path::obround(PositiveLength(1000000), PositiveLength(2));
+  const QPainterPath expected = path.toQPainterPathPx();
+  EXPECT_EQ(expected, PainterPathCache::get(path));  // Not cached yet.
+  EXPECT_EQ(expected, PainterPathCache::get(path));  // Cached.
+}
+
+TEST_F(PainterPathCacheTest, testDifferentPaths) {
+  const Path path1 = Path::circle(PositiveLength(1000000));
+  const Path path2 = Path::circle(PositiveLength(2000000));
+  const QPainterPath painterPath1 = PainterPathCache::get(path1);
+  const QPainterPath painterPath2 = PainterPathCache::get(path2);
+  EXPECT_EQ(path1.toQPainterPathPx(), painterPath1);
+  EXPECT_EQ(path2.toQPainterPathPx(), painterPath2);
+  EXPECT_NE(painterPath1, painterPath2);
+}
+
+TEST_F(PainterPathCacheTest, testEmptyPath) {
+  EXPECT_TRUE(PainterPathCache::get(Path()).isEmpty());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace editor
+}  // namespace librepcb
@@ -0,0 +1,166 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/core/library/librarybaseelementcheckmessages.h>
+#include <librepcb/editor/modelview/rulecheckmessagelistmodel.h>
+
+#include <QSignalSpy>
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace editor {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class RuleCheckMessageListModelTest : public ::testing::Test {
+protected:
+  static std::shared_ptr<const RuleCheckMessage> msg(const QString& name) {
+    return std::make_shared<MsgNameNotTitleCase>(ElementName(name));
+  }
+
+  static QStringList getTexts(const RuleCheckMessageListModel& model) {
+    QStringList texts;
+    for (int i = 0; i < model.rowCount(); ++i) {
+      texts.append(model.data(model.index(i)).toString());
+    }
+    return texts;
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(RuleCheckMessageListModelTest, testNoMessages) {
+  RuleCheckMessageListModel model;
+  EXPECT_EQ(0, model.rowCount());
+  EXPECT_EQ(tl::nullopt, model.getUnapprovedMessageCount());
+
+  model.setMessages(RuleCheckMessageList{});
+  EXPECT_EQ(1, model.rowCount());  // Placeholder.
+  EXPECT_EQ(nullptr, model.getMessage(model.index(0)));
+  EXPECT_EQ(tl::make_optional(0), model.getUnapprovedMessageCount());
+}
+
+TEST_F(RuleCheckMessageListModelTest, testSorting) {
+  RuleCheckMessageList messages{msg("b 10"), msg("b 9"),
+                                std::make_shared<MsgMissingAuthor>(),
+                                msg("a")};
+  QSet<RuleCheckApproval> approvals{messages.at(1)->getApproval()};
+  RuleCheckMessageListModel model;
+  model.setMessages(messages);
+  model.setApprovals(approvals);
+  EXPECT_EQ(QStringList({messages.at(2)->getMessage(),  // Warning first.
+                         messages.at(3)->getMessage(),
+                         messages.at(0)->getMessage(),
+                         messages.at(1)->getMessage()}),  // Approved last.
+            getTexts(model));
+  EXPECT_EQ(false,
+            model.data(model.index(0), RuleCheckMessageListModel::ApprovedRole)
+                .toBool());
+  EXPECT_EQ(true,
+            model.data(model.index(3), RuleCheckMessageListModel::ApprovedRole)
+                .toBool());
+  EXPECT_EQ(tl::make_optional(3), model.getUnapprovedMessageCount());
+}
+
+TEST_F(RuleCheckMessageListModelTest, testFilter) {
+  RuleCheckMessageListModel model;
+  model.setMessages(
+      RuleCheckMessageList{msg("Foo"), msg("bar"), msg("FOOBAR")});
+  model.setFilter(" foo ");
+  EXPECT_EQ(2, model.rowCount());
+  EXPECT_EQ(tl::make_optional(3), model.getUnapprovedMessageCount());
+  model.setFilter("xyz");
+  EXPECT_EQ(0, model.rowCount());  // No placeholder if filtered.
+  model.setFilter(QString());
+  EXPECT_EQ(3, model.rowCount());
+}
+
+TEST_F(RuleCheckMessageListModelTest, testIncrementalUpdate) {
+  RuleCheckMessageListModel model;
+  model.setMessages(
+      RuleCheckMessageList{msg("a"), msg("b"), msg("c"), msg("d"), msg("e")});
+  QPersistentModelIndex indexD = model.index(3);
+
+  QSignalSpy spyReset(&model, &RuleCheckMessageListModel::modelReset);
+  QSignalSpy spyRemoved(&model, &RuleCheckMessageListModel::rowsRemoved);
+  QSignalSpy spyInserted(&model, &RuleCheckMessageListModel::rowsInserted);
+  model.setMessages(RuleCheckMessageList{msg("a"), msg("x"), msg("d"),
+                                         msg("e"), msg("f")});
+  EXPECT_EQ(0, spyReset.count());
+  EXPECT_EQ(1, spyRemoved.count());  // "b" and "c" in one block.
+  EXPECT_EQ(1, spyInserted.count());  // "f" and "x" in one block.
+  EXPECT_EQ(QStringList({msg("a")->getMessage(), msg("d")->getMessage(),
+                         msg("e")->getMessage(), msg("f")->getMessage(),
+                         msg("x")->getMessage()}),
+            getTexts(model));
+  EXPECT_EQ(1, indexD.row());  // Unchanged rows are kept.
+}
+
+TEST_F(RuleCheckMessageListModelTest, testIncrementalUpdateInterleaved) {
+  RuleCheckMessageListModel model;
+  model.setMessages(
+      RuleCheckMessageList{msg("a"), msg("c"), msg("e"), msg("g")});
+  QPersistentModelIndex indexG = model.index(3);
+
+  QSignalSpy spyRemoved(&model, &RuleCheckMessageListModel::rowsRemoved);
+  QSignalSpy spyInserted(&model, &RuleCheckMessageListModel::rowsInserted);
+  model.setMessages(RuleCheckMessageList{msg("h"), msg("g"), msg("d"),
+                                         msg("c"), msg("b")});
+  EXPECT_EQ(2, spyRemoved.count());  // "a" and "e".
+  EXPECT_EQ(3, spyInserted.count());  // "b", "d" and "h".
+  EXPECT_EQ(QStringList({msg("b")->getMessage(), msg("c")->getMessage(),
+                         msg("d")->getMessage(), msg("g")->getMessage(),
+                         msg("h")->getMessage()}),
+            getTexts(model));
+  EXPECT_EQ(3, indexG.row());
+}
+
+TEST_F(RuleCheckMessageListModelTest, testApprovalUpdatesRows) {
+  std::shared_ptr<const RuleCheckMessage> a = msg("a");
+  std::shared_ptr<const RuleCheckMessage> b = msg("b");
+  RuleCheckMessageListModel model;
+  model.setMessages(RuleCheckMessageList{a, b});
+  model.setApprovals(QSet<RuleCheckApproval>{a->getApproval()});
+  EXPECT_EQ(QStringList({b->getMessage(), a->getMessage()}), getTexts(model));
+  EXPECT_EQ(tl::make_optional(1), model.getUnapprovedMessageCount());
+  model.setApprovals(QSet<RuleCheckApproval>{});
+  EXPECT_EQ(QStringList({a->getMessage(), b->getMessage()}), getTexts(model));
+  EXPECT_EQ(tl::make_optional(2), model.getUnapprovedMessageCount());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace editor
+}  // namespace librepcb
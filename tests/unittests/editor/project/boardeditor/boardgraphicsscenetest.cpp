@@ -0,0 +1,130 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/board/items/bi_device.h>
+#include <librepcb/core/project/project.h>
+#include <librepcb/core/project/syntheticprojectgenerator.h>
+#include <librepcb/core/workspace/theme.h>
+#include <librepcb/editor/graphics/defaultgraphicslayerprovider.h>
+#include <librepcb/editor/graphics/graphicslayer.h>
+#include <librepcb/editor/project/boardeditor/boardgraphicsscene.h>
+#include <librepcb/editor/project/boardeditor/graphicsitems/bgi_device.h>
+
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace editor {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class BoardGraphicsSceneTest : public ::testing::Test {
+protected:
+  FilePath mTmpDir;
+  Theme mTheme;
+  DefaultGraphicsLayerProvider mLayerProvider;
+  std::unique_ptr<Project> mProject;
+
+  BoardGraphicsSceneTest()
+    : mTmpDir(FilePath::getRandomTempPath()), mLayerProvider(mTheme) {
+    SyntheticProjectGenerator::Settings settings;
+    settings.deviceCount = 1;
+    settings.traceCount = 0;
+    settings.viaCount = 0;
+    settings.planeCount = 0;
+    SyntheticProjectGenerator generator(settings);
+    mProject = generator.generate(
+        std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
+            TransactionalFileSystem::openRW(mTmpDir))),
+        "project.lpp");
+  }
+
+  virtual ~BoardGraphicsSceneTest() {
+    mProject.reset();
+    QDir(mTmpDir.toStr()).removeRecursively();
+  }
+
+  // Hide all layers except the grab area layers, if requested.
+  void setOnlyGrabAreasVisible(bool grabAreasVisible) noexcept {
+    foreach (const auto& layer, mLayerProvider.getAllLayers()) {
+      const bool isGrabArea =
+          (layer->getName() == Theme::Color::sBoardGrabAreasTop) ||
+          (layer->getName() == Theme::Color::sBoardGrabAreasBot);
+      layer->setVisible(grabAreasVisible && isGrabArea);
+    }
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(BoardGraphicsSceneTest, testFindDeviceByGrabAreaOnHiddenLayer) {
+  Board& board = *mProject->getBoards().first();
+  ASSERT_EQ(1, board.getDeviceInstances().count());
+  BI_Device* device = board.getDeviceInstances().first();
+  BoardGraphicsScene scene(board, mLayerProvider,
+                           std::make_shared<QSet<const NetSignal*>>());
+  setOnlyGrabAreasVisible(true);
+  const BGI_Device* item = scene.getDevices().value(device).get();
+  ASSERT_NE(nullptr, item);
+
+  // The corner of the grab area is far away from the origin cross, and all
+  // child items (i.e. the outline on the documentation layer) are hidden.
+  const QRectF grabArea = item->mapToScene(item->shape()).boundingRect();
+  const QRectF corner(grabArea.topLeft(), QSizeF(0.1, 0.1));
+  EXPECT_GT(grabArea.width(), Length(2000000).toPx());
+  EXPECT_TRUE(scene.findItemsInArea(corner).contains(item));
+}
+
+TEST_F(BoardGraphicsSceneTest, testDoNotFindDeviceByHiddenGrabArea) {
+  Board& board = *mProject->getBoards().first();
+  BI_Device* device = board.getDeviceInstances().first();
+  BoardGraphicsScene scene(board, mLayerProvider,
+                           std::make_shared<QSet<const NetSignal*>>());
+  setOnlyGrabAreasVisible(true);
+  const BGI_Device* item = scene.getDevices().value(device).get();
+  ASSERT_NE(nullptr, item);
+  const QRectF grabArea = item->mapToScene(item->shape()).boundingRect();
+  const QRectF corner(grabArea.topLeft(), QSizeF(0.1, 0.1));
+
+  // Once the grab area layer is hidden, only the origin cross remains.
+  setOnlyGrabAreasVisible(false);
+  EXPECT_FALSE(scene.findItemsInArea(corner).contains(item));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace editor
+}  // namespace librepcb
@@ -23,6 +23,7 @@
 #include <gtest/gtest.h>
 #include <librepcb/core/fileio/fileutils.h>
 #include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/library/librarymanifest.h>
 #include <librepcb/core/network/networkaccessmanager.h>
 #include <librepcb/editor/workspace/librarymanager/librarydownload.h>
 
@@ -52,6 +53,25 @@ public:
     fs->exportToZip(zip);
   }
 
+  static FilePath getFirstSubDir(const FilePath& dir) {
+    const QStringList subdirs =
+        QDir(dir.toStr()).entryList(QDir::Dirs | QDir::NoDotAndDotDot,
+                                    QDir::Name);
+    return subdirs.isEmpty() ? FilePath() : dir.getPathTo(subdirs.first());
+  }
+
+  static bool waitForFinished(QSignalSpy& spy) {
+    qint64 start = QDateTime::currentDateTime().toMSecsSinceEpoch();
+    auto currentTime = []() {
+      return QDateTime::currentDateTime().toMSecsSinceEpoch();
+    };
+    while ((spy.isEmpty()) && (currentTime() - start < 30000)) {
+      QThread::msleep(100);
+      qApp->processEvents();
+    }
+    return !spy.isEmpty();
+  }
+
 protected:
   static NetworkAccessManager* sDownloadManager;
 };
@@ -216,6 +236,88 @@ TEST_F(LibraryDownloadTest, testDownloadValidLibraryDestinationAlreadyExists) {
   EXPECT_FALSE(dstZip.isExistingFile());
 }
 
+TEST_F(LibraryDownloadTest, testIncrementalUpdate) {
+  // create temporary directory
+  FilePath dstDir = FilePath::getRandomTempPath();
+  FilePath dstLibDir = dstDir.getPathTo("my library");
+  FileUtils::makePath(dstDir);
+
+  // install the library
+  FilePath srcLibDir(TEST_DATA_DIR "/libraries/Populated Library.lplib");
+  FileUtils::copyDirRecursively(srcLibDir, dstLibDir);
+
+  // prepare a modified version of the library with a manifest
+  FilePath serverDir = dstDir.getPathTo("server");
+  FileUtils::copyDirRecursively(srcLibDir, serverDir);
+  FilePath removedSym = getFirstSubDir(serverDir.getPathTo("sym"));
+  FilePath modifiedPkg = getFirstSubDir(serverDir.getPathTo("pkg"));
+  ASSERT_TRUE(removedSym.isValid());
+  ASSERT_TRUE(modifiedPkg.isValid());
+  FileUtils::removeDirRecursively(removedSym);
+  FileUtils::writeFile(modifiedPkg.getPathTo("package.lp"), "modified");
+  FilePath manifest = dstDir.getPathTo("server/manifest.txt");
+  FileUtils::writeFile(
+      manifest, LibraryManifest::fromDirectory(serverDir).serialize());
+
+  // start the download with an invalid ZIP URL to make sure it is not used
+  LibraryDownload* dl = new LibraryDownload(
+      QUrl::fromLocalFile(dstDir.getPathTo("nonexistent.zip").toNative()),
+      dstLibDir);
+  dl->setManifestUrl(QUrl::fromLocalFile(manifest.toNative()));
+  QSignalSpy spyFinished(dl, SIGNAL(finished(bool, QString)));
+  dl->start();
+  ASSERT_TRUE(waitForFinished(spyFinished));
+
+  // check count and parameters of emitted signals
+  EXPECT_EQ(1, spyFinished.count());
+  EXPECT_TRUE(spyFinished.first()[0].toBool());  // success
+  EXPECT_TRUE(spyFinished.first()[1].toString().isNull())
+      << spyFinished.first()[1].toString().toStdString();  // error message
+
+  // check the installed library
+  FilePath dstRemovedSym =
+      dstLibDir.getPathTo("sym/" % removedSym.getFilename());
+  FilePath dstModifiedPkg =
+      dstLibDir.getPathTo("pkg/" % modifiedPkg.getFilename());
+  EXPECT_FALSE(dstRemovedSym.isExistingDir());
+  EXPECT_EQ("modified",
+            FileUtils::readFile(dstModifiedPkg.getPathTo("package.lp")));
+  EXPECT_FALSE(FilePath(dstLibDir.toStr() % ".tmp").isExistingDir());
+  ASSERT_TRUE(dl->getModifiedPaths().has_value());
+  EXPECT_EQ((QSet<FilePath>{dstRemovedSym, dstModifiedPkg}),
+            *dl->getModifiedPaths());
+}
+
+TEST_F(LibraryDownloadTest, testIncrementalUpdateWithoutManifest) {
+  // create temporary directory
+  FilePath dstDir = FilePath::getRandomTempPath();
+  FilePath dstLibDir = dstDir.getPathTo("my library");
+  FileUtils::makePath(dstDir);
+
+  // install the library and prepare library ZIP
+  FilePath srcLibDir(TEST_DATA_DIR "/libraries/Populated Library.lplib");
+  FileUtils::copyDirRecursively(srcLibDir, dstLibDir);
+  FilePath srcLibZip = dstDir.getPathTo("lib.zip");
+  createZip(srcLibDir, srcLibZip);
+
+  // start the download with a nonexistent manifest
+  LibraryDownload* dl =
+      new LibraryDownload(QUrl::fromLocalFile(srcLibZip.toNative()), dstLibDir);
+  dl->setManifestUrl(
+      QUrl::fromLocalFile(dstDir.getPathTo("manifest.txt").toNative()));
+  QSignalSpy spyFinished(dl, SIGNAL(finished(bool, QString)));
+  dl->start();
+  ASSERT_TRUE(waitForFinished(spyFinished));
+
+  // check that the whole library was downloaded instead
+  EXPECT_EQ(1, spyFinished.count());
+  EXPECT_TRUE(spyFinished.first()[0].toBool());  // success
+  EXPECT_TRUE(spyFinished.first()[1].toString().isNull())
+      << spyFinished.first()[1].toString().toStdString();  // error message
+  EXPECT_TRUE(dstLibDir.getPathTo(".librepcb-lib").isExistingFile());
+  EXPECT_FALSE(dl->getModifiedPaths().has_value());
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/